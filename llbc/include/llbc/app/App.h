@@ -98,6 +98,48 @@ struct LLBC_AppEvent
     explicit LLBC_AppEvent(int evType);
 };
 
+/**
+ * \brief The application config snapshot class encapsulation.
+ *        Snapshot is immutable, every reload will publish new snapshot, readers hold
+ *        the snapshot handle without lock, old snapshot freed when the last reader drops it.
+ */
+class LLBC_EXPORT LLBC_AppConfigSnapshot
+{
+public:
+    LLBC_AppConfigSnapshot(int cfgType, const LLBC_Variant &cfg, uint64 version);
+
+public:
+    /**
+     * Get config type.
+     * @return int - the config type(LLBC_AppConfigType::ENUM).
+     */
+    int GetConfigType() const;
+
+    /**
+     * Get config.
+     * @return const LLBC_Variant & - the config.
+     */
+    const LLBC_Variant &GetConfig() const;
+
+    /**
+     * Get snapshot version, every reload will increase the version.
+     * @return uint64 - the snapshot version.
+     */
+    uint64 GetVersion() const;
+
+    LLBC_DISABLE_ASSIGNMENT(LLBC_AppConfigSnapshot);
+
+private:
+    const int _cfgType;
+    const LLBC_Variant _cfg;
+    const uint64 _version;
+};
+
+/**
+ * \brief The application config snapshot handle.
+ */
+typedef std::shared_ptr<const LLBC_AppConfigSnapshot> LLBC_AppConfigSnapshotPtr;
+
 /**
  * \brief The application start phase encapsulation.
  */
@@ -241,16 +283,25 @@ public:
     bool HasConfig() const;
 
     /**
-     * Get application config.
+     * Get application config(copy-on-write shared copy of current config snapshot, not lock).
      * @return LLBC_Variant - the application config.
      */
     LLBC_Variant GetConfig() const;
 
     /**
      * Get application config(thread unsafety).
+     * Note: The returned reference is invalidated after application reloaded.
      * @return const LLBC_Variant & - the application config.
      */
-    const LLBC_Variant &GetConfigUnsafe() const { return _cfg; }
+    const LLBC_Variant &GetConfigUnsafe() const { return _cfgSnapshot->GetConfig(); }
+
+    /**
+     * Get application config snapshot(thread safety, not lock).
+     * Hot path can hold the snapshot handle and read config without lock/copy,
+     * the snapshot will not be modified by application reload.
+     * @return LLBC_AppConfigSnapshotPtr - the config snapshot handle, never be null.
+     */
+    LLBC_AppConfigSnapshotPtr GetConfigSnapshot() const;
 
     /**
      * Get application config type.
@@ -377,10 +428,16 @@ private:
      * Load/Reload application config.
      * @return int - return 0 if success, otherwise return -1.
      */
-    int ReloadConfig();
-    int ReloadIniConfig();
-    int ReloadXmlConfig();
-    int ReloadPropertyConfig();
+    int ReloadConfig(LLBC_Variant &cfg);
+    int ReloadIniConfig(LLBC_Variant &cfg);
+    int ReloadXmlConfig(LLBC_Variant &cfg);
+    int ReloadPropertyConfig(LLBC_Variant &cfg);
+
+    /**
+     * Publish new config snapshot.
+     * @param[in] cfg - the new config.
+     */
+    void PublishConfigSnapshot(const LLBC_Variant &cfg);
 
 private:
     void HandleEvents();
@@ -411,7 +468,7 @@ private:
     // Load/Reload data members.
     volatile int _loading; // Loading flag.
     mutable LLBC_SpinLock _loadLock; // Load lock.
-    LLBC_Variant _cfg; // Config.
+    LLBC_AppConfigSnapshotPtr _cfgSnapshot; // Config snapshot(use std::atomic_load/atomic_store to access).
     LLBC_String _cfgPath; // Application config path.
     LLBC_AppConfigType::ENUM _cfgType; // Application config type.
 
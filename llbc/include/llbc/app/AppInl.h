@@ -29,11 +29,38 @@ inline LLBC_AppEvent::LLBC_AppEvent(int evType)
 }
 
 
+inline LLBC_AppConfigSnapshot::LLBC_AppConfigSnapshot(int cfgType, const LLBC_Variant &cfg, uint64 version)
+: _cfgType(cfgType)
+, _cfg(cfg)
+, _version(version)
+{
+}
+
+inline int LLBC_AppConfigSnapshot::GetConfigType() const
+{
+    return _cfgType;
+}
+
+inline const LLBC_Variant &LLBC_AppConfigSnapshot::GetConfig() const
+{
+    return _cfg;
+}
+
+inline uint64 LLBC_AppConfigSnapshot::GetVersion() const
+{
+    return _version;
+}
+
 inline int LLBC_App::GetFPS() const
 {
     return _fps;
 }
 
+inline LLBC_AppConfigSnapshotPtr LLBC_App::GetConfigSnapshot() const
+{
+    return std::atomic_load(&_cfgSnapshot);
+}
+
 inline bool LLBC_App::IsStopped() const
 {
     return _startPhase == LLBC_AppStartPhase::Stopped;
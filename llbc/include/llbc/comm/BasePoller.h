@@ -34,6 +34,7 @@ class LLBC_Session;
 class LLBC_Service;
 class LLBC_PollerMgr;
 class LLBC_SessionOpts;
+class LLBC_RecvBufferPool;
 
 __LLBC_NS_END
 
@@ -90,6 +91,26 @@ public:
      */
     void SetPollerMgr(LLBC_PollerMgr *mgr);
 
+    /**
+     * Get recv buffer pool.
+     * @return LLBC_RecvBufferPool * - the recv buffer pool.
+     */
+    LLBC_RecvBufferPool *GetRecvBufferPool() const;
+
+    /**
+     * Set recv buffer pool.
+     * @param[in] recvBufPool - the recv buffer pool(owned by poller manager).
+     */
+    void SetRecvBufferPool(LLBC_RecvBufferPool *recvBufPool);
+
+    /**
+     * Set reactor mode, must be set before poller started.
+     * In reactor mode, poller thread itself wait io events and be woken up when events pushed.
+     * Note: Only epoll poller supported, other pollers ignore this option.
+     * @param[in] reactorMode - the reactor mode flag.
+     */
+    void SetReactorMode(bool reactorMode);
+
 public:
     /**
      * Startup poller to work.
@@ -119,6 +140,8 @@ protected:
     virtual void HandleEv_Monitor(LLBC_PollerEvent &ev);
     virtual void HandleEv_TakeOverSession(LLBC_PollerEvent &ev);
     virtual void HandleEv_CtrlProtocolStack(LLBC_PollerEvent &ev);
+    virtual void HandleEv_SharedSend(LLBC_PollerEvent &ev);
+    virtual void HandleEv_BatchSend(LLBC_PollerEvent &ev);
 
     /**
      * Create new session from socket.
@@ -173,6 +196,8 @@ protected:
     int _brotherCount;
     LLBC_Service *_svc;
     LLBC_PollerMgr *_pollerMgr;
+    LLBC_RecvBufferPool *_recvBufPool;
+    bool _reactorMode;
     
     typedef std::map<LLBC_SocketHandle, LLBC_Session *> _Sockets;
     _Sockets _sockets;
@@ -25,9 +25,12 @@
 #include "llbc/comm/Session.h"
 #include "llbc/comm/Packet.h"
 #include "llbc/comm/Coder.h"
+#include "llbc/comm/OpcodeDispatchTable.h"
 #include "llbc/comm/Component.h"
 #include "llbc/comm/PollerType.h"
 #include "llbc/comm/BasePoller.h"
+#include "llbc/comm/RecvBufferPool.h"
+#include "llbc/comm/EvBlockPool.h"
 #include "llbc/comm/Service.h"
 #include "llbc/comm/ServiceMgr.h"
 #include "llbc/comm/ServiceEventFirer.h"
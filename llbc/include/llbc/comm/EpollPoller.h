@@ -67,6 +67,13 @@ public:
      */
     void Cleanup() override;
 
+    /**
+     * Push message block to poller, in reactor mode, will wakeup the poller thread if it is waiting.
+     * @param[in] block - message block.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int Push(LLBC_MessageBlock *block) override;
+
 protected:
     /**
      * Queued event handlers.
@@ -78,6 +85,8 @@ protected:
     void HandleEv_Monitor(LLBC_PollerEvent &ev) override;
     void HandleEv_TakeOverSession(LLBC_PollerEvent &ev) override;
     void HandleEv_CtrlProtocolStack(LLBC_PollerEvent &ev) override;
+    void HandleEv_SharedSend(LLBC_PollerEvent &ev) override;
+    void HandleEv_BatchSend(LLBC_PollerEvent &ev) override;
 
     /**
      * Add session to poller.
@@ -105,6 +114,31 @@ private:
      */
     void MonitorSvc();
 
+    /**
+     * Create reactor wakeup eventfd and add it to epoll(reactor mode only).
+     */
+    int StartupReactorWakeup();
+
+    /**
+     * Close reactor wakeup eventfd.
+     */
+    void CloseReactorWakeup();
+
+    /**
+     * Wakeup the poller thread which waiting in epoll_wait()(reactor mode only).
+     */
+    void WakeupReactor();
+
+    /**
+     * The reactor mode poller thread service method.
+     */
+    void ReactorSvc();
+
+    /**
+     * Handle epoll events.
+     */
+    void HandleEpollEvents(const LLBC_EpollEvent *evs, int count);
+
     /**
      * Handle connecting sockets.
      */
@@ -119,6 +153,11 @@ private:
     LLBC_Handle _epoll;
     LLBC_PollerMonitor *_monitor;
 
+    LLBC_Handle _reactorWakeup;
+    volatile sint32 _reactorWaiting;
+
+    std::vector<int> _batchSendSessionIds;
+
     LLBC_EpollEvent _events[LLBC_CFG_COMM_MAX_EVENT_COUNT];
 };
 
@@ -0,0 +1,73 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2013 lailongwei<lailongwei@126.com>
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of 
+// this software and associated documentation files (the "Software"), to deal in 
+// the Software without restriction, including without limitation the rights to 
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of 
+// the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS 
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER 
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN 
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+
+#pragma once
+
+#include "llbc/core/Core.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The service/poller event block pool encapsulation.
+ *        Service events(see LLBC_SvcEvUtil) and poller events(see LLBC_PollerEvUtil) are constructed
+ *        in the pooled message block buffer, and the block will be recycled to pool after the event
+ *        handled(in any thread), so in steady state, build/destroy events no need any memory allocation.
+ */
+class LLBC_EXPORT LLBC_EvBlockPool
+{
+public:
+    /**
+     * Initialize event block pool.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    static int Initialize();
+
+    /**
+     * Finalize event block pool.
+     */
+    static void Finalize();
+
+public:
+    /**
+     * Acquire event block, the block buffer size is greater than or equal to given size.
+     * Note: If pool not initialized, will create a unpooled block.
+     * @param[in] size - the required buffer size.
+     * @return LLBC_MessageBlock * - the event block, use LLBC_Recycle() to release.
+     */
+    static LLBC_MessageBlock *Acquire(size_t size);
+
+    /**
+     * Get the pool statistics.
+     * @param[in] statFmt - object pool statistic format, default is CSV format.
+     * @return LLBC_String - the pool statistics.
+     */
+    static LLBC_String GetStatistics(int statFmt = LLBC_ObjPoolStatFormat::CSV);
+
+    /**
+     * Collect pool free blocks.
+     * @param[in] deep - deep collect flag.
+     */
+    static void Collect(bool deep);
+};
+
+__LLBC_NS_END
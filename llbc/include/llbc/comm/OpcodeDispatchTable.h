@@ -0,0 +1,142 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2013 lailongwei<lailongwei@126.com>
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of 
+// this software and associated documentation files (the "Software"), to deal in 
+// the Software without restriction, including without limitation the rights to 
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of 
+// the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS 
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER 
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN 
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+#include "llbc/core/Core.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The opcode dispatch table class encapsulation.
+ *
+ * Registration goes to an ordered map(the front-end), once all opcodes registered, call Compile()
+ * to compile the map into a dense array(if opcodes are dense enough) or an open addressing hash table,
+ * after compiled, Find() will not touch the map any more.
+ * Note: Insert()/Erase()/Clear() will invalidate the compiled table, must call Compile() again.
+ */
+template <typename ValueType>
+class LLBC_OpcodeDispatchTable
+{
+public:
+    typedef std::map<int, ValueType> Map;
+
+public:
+    LLBC_OpcodeDispatchTable();
+    ~LLBC_OpcodeDispatchTable();
+
+public:
+    /**
+     * Insert opcode->value pair.
+     * @param[in] opcode - the opcode.
+     * @param[in] value  - the value.
+     * @return bool - return true if success, otherwise return false(opcode repeat).
+     */
+    bool Insert(int opcode, const ValueType &value);
+
+    /**
+     * Get or insert opcode's value, like std::map::operator[].
+     * @param[in] opcode - the opcode.
+     * @return ValueType & - the value reference.
+     */
+    ValueType &operator[](int opcode);
+
+    /**
+     * Erase opcode.
+     * @param[in] opcode - the opcode.
+     * @return bool - return true if erased, otherwise return false(opcode not found).
+     */
+    bool Erase(int opcode);
+
+    /**
+     * Clear all opcodes.
+     */
+    void Clear();
+
+    /**
+     * Find opcode's value.
+     * @param[in] opcode - the opcode.
+     * @return const ValueType * - the value pointer, if not found, return nullptr.
+     */
+    const ValueType *Find(int opcode) const;
+
+public:
+    /**
+     * Compile the registered opcodes to dispatch table.
+     */
+    void Compile();
+
+    /**
+     * Check the dispatch table is compiled or not.
+     * @return bool - the compiled flag.
+     */
+    bool IsCompiled() const;
+
+    /**
+     * Check the compiled dispatch table is dense array or not.
+     * @return bool - return true if compiled to dense array, otherwise return false.
+     */
+    bool IsDense() const;
+
+    /**
+     * Get registered opcodes count.
+     * @return size_t - the registered opcodes count.
+     */
+    size_t GetSize() const;
+
+    /**
+     * Get the registration front-end map.
+     * @return const Map & - the front-end map.
+     */
+    const Map &GetMap() const;
+
+    LLBC_DISABLE_ASSIGNMENT(LLBC_OpcodeDispatchTable);
+
+private:
+    /**
+     * Invalidate the compiled dispatch table.
+     */
+    void Invalidate();
+
+    /**
+     * Hash opcode to hash table slot index.
+     */
+    size_t HashSlot(int opcode) const;
+
+private:
+    Map _map;
+
+    volatile sint32 _compiled;
+    bool _dense;
+
+    // Dense array: index = opcode - _denseBase.
+    int _denseBase;
+    std::vector<const ValueType *> _denseTable;
+
+    // Open addressing hash table(linear probing), slot value nullptr means empty slot.
+    uint32 _hashShift;
+    std::vector<std::pair<int, const ValueType *> > _hashTable;
+};
+
+__LLBC_NS_END
+
+#include "llbc/comm/OpcodeDispatchTableInl.h"
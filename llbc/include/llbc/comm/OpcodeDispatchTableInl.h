@@ -0,0 +1,194 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2013 lailongwei<lailongwei@126.com>
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of 
+// this software and associated documentation files (the "Software"), to deal in 
+// the Software without restriction, including without limitation the rights to 
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of 
+// the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS 
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER 
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN 
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+__LLBC_NS_BEGIN
+
+template <typename ValueType>
+LLBC_OpcodeDispatchTable<ValueType>::LLBC_OpcodeDispatchTable()
+: _compiled(0)
+, _dense(false)
+, _denseBase(0)
+, _hashShift(32)
+{
+}
+
+template <typename ValueType>
+LLBC_OpcodeDispatchTable<ValueType>::~LLBC_OpcodeDispatchTable()
+{
+}
+
+template <typename ValueType>
+bool LLBC_OpcodeDispatchTable<ValueType>::Insert(int opcode, const ValueType &value)
+{
+    Invalidate();
+    return _map.insert(std::make_pair(opcode, value)).second;
+}
+
+template <typename ValueType>
+ValueType &LLBC_OpcodeDispatchTable<ValueType>::operator[](int opcode)
+{
+    Invalidate();
+    return _map[opcode];
+}
+
+template <typename ValueType>
+bool LLBC_OpcodeDispatchTable<ValueType>::Erase(int opcode)
+{
+    Invalidate();
+    return _map.erase(opcode) != 0;
+}
+
+template <typename ValueType>
+void LLBC_OpcodeDispatchTable<ValueType>::Clear()
+{
+    Invalidate();
+    _map.clear();
+}
+
+template <typename ValueType>
+LLBC_FORCE_INLINE const ValueType *LLBC_OpcodeDispatchTable<ValueType>::Find(int opcode) const
+{
+    // Not compiled, find from front-end map.
+    if (UNLIKELY(!_compiled))
+    {
+        typename Map::const_iterator it = _map.find(opcode);
+        return it != _map.end() ? &it->second : nullptr;
+    }
+
+    // Compiled to dense array.
+    if (LIKELY(_dense))
+    {
+        const size_t index = static_cast<size_t>(static_cast<uint32>(opcode - _denseBase));
+        return index < _denseTable.size() ? _denseTable[index] : nullptr;
+    }
+
+    // Compiled to hash table.
+    if (UNLIKELY(_hashTable.empty()))
+        return nullptr;
+
+    const size_t mask = _hashTable.size() - 1;
+    for (size_t slot = HashSlot(opcode); ; slot = (slot + 1) & mask)
+    {
+        const std::pair<int, const ValueType *> &slotItem = _hashTable[slot];
+        if (!slotItem.second)
+            return nullptr;
+        else if (slotItem.first == opcode)
+            return slotItem.second;
+    }
+}
+
+template <typename ValueType>
+void LLBC_OpcodeDispatchTable<ValueType>::Compile()
+{
+    Invalidate();
+
+    _denseTable.clear();
+    _hashTable.clear();
+    if (!_map.empty())
+    {
+        // Dense array is selected if opcodes range not exceed the dense factor limit.
+        const int minOpcode = _map.begin()->first;
+        const int maxOpcode = _map.rbegin()->first;
+        const uint64 range = static_cast<uint64>(static_cast<sint64>(maxOpcode) - minOpcode + 1);
+        const uint64 denseLimit = MAX(static_cast<uint64>(_map.size()) * LLBC_CFG_COMM_OPCODE_DISPATCH_DENSE_FACTOR,
+                                      static_cast<uint64>(LLBC_CFG_COMM_OPCODE_DISPATCH_MIN_DENSE_RANGE));
+
+        _dense = range <= denseLimit;
+        if (_dense)
+        {
+            _denseBase = minOpcode;
+            _denseTable.resize(static_cast<size_t>(range), nullptr);
+            for (auto &item : _map)
+                _denseTable[static_cast<size_t>(static_cast<uint32>(item.first - minOpcode))] = &item.second;
+        }
+        else
+        {
+            // Hash table capacity: power of 2, and load factor <= 0.5.
+            uint32 bits = 1;
+            while ((static_cast<size_t>(1) << bits) < _map.size() * 2)
+                ++bits;
+
+            _hashShift = 32 - bits;
+            _hashTable.resize(static_cast<size_t>(1) << bits, std::make_pair(0, nullptr));
+
+            const size_t mask = _hashTable.size() - 1;
+            for (auto &item : _map)
+            {
+                size_t slot = HashSlot(item.first);
+                while (_hashTable[slot].second)
+                    slot = (slot + 1) & mask;
+
+                _hashTable[slot] = std::make_pair(item.first, &item.second);
+            }
+        }
+    }
+    else
+    {
+        _dense = true;
+        _denseBase = 0;
+    }
+
+    // Publish compiled table.
+    LLBC_AtomicSet(&_compiled, 1);
+}
+
+template <typename ValueType>
+inline bool LLBC_OpcodeDispatchTable<ValueType>::IsCompiled() const
+{
+    return _compiled != 0;
+}
+
+template <typename ValueType>
+inline bool LLBC_OpcodeDispatchTable<ValueType>::IsDense() const
+{
+    return _compiled && _dense;
+}
+
+template <typename ValueType>
+inline size_t LLBC_OpcodeDispatchTable<ValueType>::GetSize() const
+{
+    return _map.size();
+}
+
+template <typename ValueType>
+inline const typename LLBC_OpcodeDispatchTable<ValueType>::Map &LLBC_OpcodeDispatchTable<ValueType>::GetMap() const
+{
+    return _map;
+}
+
+template <typename ValueType>
+inline void LLBC_OpcodeDispatchTable<ValueType>::Invalidate()
+{
+    if (_compiled)
+        LLBC_AtomicSet(&_compiled, 0);
+}
+
+template <typename ValueType>
+LLBC_FORCE_INLINE size_t LLBC_OpcodeDispatchTable<ValueType>::HashSlot(int opcode) const
+{
+    // Fibonacci hashing, use the high bits of product.
+    return static_cast<size_t>((static_cast<uint32>(opcode) * 0x9E3779B1u) >> _hashShift);
+}
+
+__LLBC_NS_END
@@ -222,6 +222,15 @@ public:
      */
     LLBC_MessageBlock *DetachPayload();
 
+    /**
+     * Detach payload for prepend header, only available when the payload is owned by packet and
+     * the payload reserved headroom(see LLBC_CFG_COMM_PACKET_PAYLOAD_HEADROOM) >= headerLen.
+     * @param[in] headerLen - the will prepend header length.
+     * @return LLBC_MessageBlock * - the payload, read position already moved back headerLen bytes,
+     *                               if condition not satisfied, return nullptr.
+     */
+    LLBC_MessageBlock *DetachPayloadWithHeadroom(size_t headerLen);
+
     /**
     * Set payload data.
     * @param[in] payload - the new payload.
@@ -504,6 +513,11 @@ private:
      */
     void CleanupPayload();
 
+    /**
+     * Reserve payload headroom, only available when payload is empty.
+     */
+    void ReservePayloadHeadroom();
+
 private:
     size_t _length;
 
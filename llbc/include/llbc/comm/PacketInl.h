@@ -172,6 +172,20 @@ LLBC_FORCE_INLINE size_t LLBC_Packet::GetPayloadLength() const
     return _payload->GetReadableSize();
 }
 
+LLBC_FORCE_INLINE void LLBC_Packet::ReservePayloadHeadroom()
+{
+#if LLBC_CFG_COMM_PACKET_PAYLOAD_HEADROOM > 0
+    if (_payload->GetWritePos() != 0 || _payload->IsAttach())
+        return;
+
+    if (_payload->GetSize() < LLBC_CFG_COMM_PACKET_PAYLOAD_HEADROOM)
+        _payload->Allocate(LLBC_CFG_COMM_PACKET_PAYLOAD_HEADROOM - _payload->GetSize());
+
+    _payload->SetWritePos(LLBC_CFG_COMM_PACKET_PAYLOAD_HEADROOM);
+    _payload->SetReadPos(LLBC_CFG_COMM_PACKET_PAYLOAD_HEADROOM);
+#endif // LLBC_CFG_COMM_PACKET_PAYLOAD_HEADROOM > 0
+}
+
 LLBC_FORCE_INLINE LLBC_MessageBlock *LLBC_Packet::GetMutablePayload(size_t ensureCap)
 {
     if (!_payload)
@@ -179,12 +193,30 @@ LLBC_FORCE_INLINE LLBC_MessageBlock *LLBC_Packet::GetMutablePayload(size_t ensur
         if (_typedObjPool)
             _payload = _typedObjPool->GetObjPool()->Acquire<LLBC_MessageBlock>();
         else
-            _payload = new LLBC_MessageBlock(ensureCap);
+            _payload = new LLBC_MessageBlock(LLBC_CFG_COMM_PACKET_PAYLOAD_HEADROOM + ensureCap);
+
+        ReservePayloadHeadroom();
     }
 
     return _payload;
 }
 
+LLBC_FORCE_INLINE LLBC_MessageBlock *LLBC_Packet::DetachPayloadWithHeadroom(size_t headerLen)
+{
+    if (!_payload ||
+        _payloadDeleteDeleg ||
+        _payload->IsAttach() ||
+        _payload->GetReadPos() < headerLen)
+        return nullptr;
+
+    LLBC_MessageBlock *payload = _payload;
+    _payload = nullptr;
+
+    payload->SetReadPos(payload->GetReadPos() - headerLen);
+
+    return payload;
+}
+
 LLBC_FORCE_INLINE LLBC_MessageBlock * LLBC_Packet::DetachPayload()
 {
     LLBC_MessageBlock *payload = _payload;
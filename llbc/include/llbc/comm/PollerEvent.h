@@ -58,6 +58,10 @@ struct LLBC_HIDDEN LLBC_PollerEvent
         TakeOverSession,
         // Control protocol stack, generate by Service layer.
         CtrlProtocolStack,
+        // Send shared frame request(Multicast/Broadcast), generate by Service layer.
+        SharedSend,
+        // Send packets batch request(packets belong to same poller), generate by Service layer.
+        BatchSend,
 
         // Sentinel.
         End
@@ -65,6 +69,7 @@ struct LLBC_HIDDEN LLBC_PollerEvent
 
     Type type;
     int sessionId;
+    int acceptSessionId;
     LLBC_SockAddr_IN peerAddr;
     LLBC_SessionOpts *sessionOpts;
     union
@@ -79,6 +84,18 @@ struct LLBC_HIDDEN LLBC_PollerEvent
             int ctrlCmd;
             LLBC_Variant *ctrlData;
         } protocolStackCtrlInfo;
+        struct
+        {
+            LLBC_MessageBlock *frame;
+            int opcode;
+            int status;
+            uint32 flags;
+        } sharedSendInfo;
+        struct
+        {
+            LLBC_Packet **packets;
+            int count;
+        } batchSendInfo;
     } un;
 };
 
@@ -94,7 +111,8 @@ public:
      */
     static LLBC_MessageBlock *BuildAddSockEv(LLBC_Socket *sock,
                                              int sessionId,
-                                             const LLBC_SessionOpts &sessionOpts);
+                                             const LLBC_SessionOpts &sessionOpts,
+                                             int acceptSessionId = 0);
     
     /**
      * Build Async-Conn event.
@@ -140,6 +158,28 @@ public:
                                                        int ctrlCmd,
                                                        const LLBC_Variant &ctrlData);
 
+    /**
+     * Build shared send event.
+     * @param[in] sessionId - the session Id.
+     * @param[in] frame     - the shared frame(see LLBC_PacketProtocol::EncodeFrame()),
+     *                        event will take over the frame.
+     * @param[in] opcode    - the frame opcode, use to rebuild packet if session not support shared frame.
+     * @param[in] status    - the frame status.
+     * @param[in] flags     - the frame flags.
+     */
+    static LLBC_MessageBlock *BuildSharedSendEv(int sessionId,
+                                                LLBC_MessageBlock *frame,
+                                                int opcode,
+                                                int status,
+                                                uint32 flags);
+
+    /**
+     * Build batch send event.
+     * @param[in] packets - the packets(all packets must belong to same poller), event will take over the packets.
+     * @param[in] count   - the packets count.
+     */
+    static LLBC_MessageBlock *BuildBatchSendEv(LLBC_Packet * const *packets, int count);
+
 public:
     /**
      * Destroy poller event.
@@ -33,6 +33,10 @@ class LLBC_Socket;
 class LLBC_Service;
 class LLBC_BasePoller;
 class LLBC_IProtocolFactory;
+class LLBC_RecvBufferPool;
+class LLBC_RecvBufferPoolStat;
+class LLBC_RecvBufferPool;
+class LLBC_RecvBufferPoolStat;
 
 __LLBC_NS_END
 
@@ -60,6 +64,14 @@ public:
      */
     void SetService(LLBC_Service *svc);
 
+    void SetReactorMode(bool reactorMode);
+
+    /**
+     * Set pollers lock-free event queue option.
+     * @param[in] lockFreeEventQueue - the lock-free event queue option.
+     */
+    void SetLockFreeEventQueue(bool lockFreeEventQueue);
+
 public:
     /**
      * Initialize poller manager.
@@ -138,6 +150,38 @@ public:
      */
     int Send(LLBC_Packet *packet);
 
+    /**
+     * Send shared frame(see LLBC_PacketProtocol::EncodeFrame()).
+     * @param[in] sessionId - the session Id.
+     * @param[in] frame     - the shared frame, will be stolen.
+     * @param[in] opcode    - the frame opcode.
+     * @param[in] status    - the frame status.
+     * @param[in] flags     - the frame flags.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int SharedSend(int sessionId, LLBC_MessageBlock *frame, int opcode, int status, uint32 flags);
+
+    /**
+     * Append packet to target poller send batch, the batch will be pushed to poller by one
+     * BatchSend event when FlushSendBatches() called or batch size limit reached
+     * (see LLBC_CFG_COMM_SERVICE_SEND_BATCH_MAX_PACKETS).
+     * Note: Send batches not thread-safe, only can be called in service thread.
+     * @param[in] packet - the packet.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int BatchSend(LLBC_Packet *packet);
+
+    /**
+     * Push all send batches to pollers, only can be called in service thread.
+     */
+    void FlushSendBatches();
+
+    /**
+     * Check has any packets batched or not.
+     * @return bool - return true if has batched packets, otherwise return false.
+     */
+    bool HasSendBatches() const;
+
     /**
      * Close session.
      * @param[in] sessionId - the session Id.
@@ -156,6 +200,13 @@ public:
                            int ctrlCmd,
                            const LLBC_Variant &ctrlData);
 
+public:
+    /**
+     * Get pollers recv buffer pool statistics.
+     * @param[out] stats - the recv buffer pool statistics(one element per poller).
+     */
+    void GetRecvBufferPoolStats(std::vector<LLBC_RecvBufferPoolStat> &stats) const;
+
 private:
     /**
      * Allocate new session Id, call by self or Poller.
@@ -163,6 +214,34 @@ private:
      */
     int AllocSessionId();
 
+    /**
+     * Allocate new session Id which belong to specific poller(sessionId % pollerCount == pollerId),
+     * call by self or Poller.
+     * @param[in] pollerId - the poller Id.
+     * @return int - the new session Id.
+     */
+    int AllocSessionId(int pollerId);
+
+    /**
+     * Create listen socket.
+     * @param[in] local       - the local address.
+     * @param[in] sessionOpts - the session options.
+     * @return LLBC_Socket * - the listen socket, if failed, return nullptr.
+     */
+    LLBC_Socket *CreateListenSocket(const LLBC_SockAddr_IN &local, const LLBC_SessionOpts &sessionOpts);
+
+    /**
+     * Add socket to poller or pending(if not started).
+     */
+    void AddSock(LLBC_Socket *sock, int sessionId, const LLBC_SessionOpts &sessionOpts, int acceptSessionId = 0);
+
+    /**
+     * Close reuse port listen sibling sessions, if given session is primary reuse port listen session.
+     * @param[in] sessionId - the session Id.
+     * @param[in] reason    - the close reason.
+     */
+    void CloseReusePortListenSiblings(int sessionId, const char *reason);
+
     /**
      * Push specific message to poller, call by Poller.
      * @param[in] id    - the poller Id.
@@ -172,6 +251,12 @@ private:
      */
     int PushMsgToPoller(int id, LLBC_MessageBlock *block);
 
+    /**
+     * Push the send batch of specific poller to poller.
+     * @param[in] id - the poller Id.
+     */
+    void FlushSendBatch(int id);
+
     /**
      * When poller stop, will call this method.
      * @param[in] id - the poller Id.
@@ -191,6 +276,8 @@ private:
 
 private:
     int _type;
+    bool _reactorMode;
+    bool _lockFreeEventQueue;
     LLBC_Service *_svc;
     int _maxSessionId;
 
@@ -200,8 +287,23 @@ private:
     LLBC_SpinLock _pollerLock;
     std::vector<LLBC_BasePoller *> _pollers;
 
+    // Send batches(indexed by pollerId), only access in service thread.
+    size_t _sendBatchedCount;
+    std::vector<std::vector<LLBC_Packet *> > _sendBatches;
+
     std::map<int, std::pair<LLBC_Socket *, LLBC_SessionOpts> > _pendingAddSocks;
     std::map<int, std::pair<LLBC_SockAddr_IN, LLBC_SessionOpts> > _pendingAsyncConns;
+
+    // Reuse port listen sessions: primary listen sessionId -> sibling listen sessionIds.
+    volatile sint32 _reusePortListenCount;
+    LLBC_SpinLock _reusePortListensLock;
+    std::map<int, std::vector<int> > _reusePortListens;
+
+    // Pollers recv buffer pools(indexed by pollerId).
+    // Note: Recv buffers maybe recycled after pollers finalized(eg: still in service queued events),
+    //       so recv buffer pools only delete when poller manager destroy.
+    mutable LLBC_SpinLock _recvBufPoolsLock;
+    std::vector<LLBC_RecvBufferPool *> _recvBufPools;
 };
 
 __LLBC_NS_END
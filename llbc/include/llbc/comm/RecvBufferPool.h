@@ -0,0 +1,138 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2013 lailongwei<lailongwei@126.com>
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of 
+// this software and associated documentation files (the "Software"), to deal in 
+// the Software without restriction, including without limitation the rights to 
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of 
+// the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS 
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER 
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN 
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+#include "llbc/core/Core.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The receive buffer pool statistics(per poller).
+ * Note: Statistics are collected without lock, the values are approximate when read from non-poller thread.
+ */
+class LLBC_EXPORT LLBC_RecvBufferPoolStat
+{
+public:
+    /**
+     * \brief The size class statistics.
+     */
+    struct SizeClass
+    {
+        size_t bufSize;      // Size class buffer size.
+        uint64 acquireTimes; // Acquire times.
+        uint64 reuseTimes;   // Acquire times that reuse pooled buffer(no any memory allocation).
+        uint64 allocTimes;   // Acquire times that allocate new buffer.
+    };
+
+public:
+    LLBC_RecvBufferPoolStat();
+
+public:
+    /**
+     * Get the statistics describe string.
+     * @return LLBC_String - the describe string.
+     */
+    LLBC_String ToString() const;
+
+public:
+    int pollerId;                      // Owner poller Id.
+    uint64 unpooledAcquireTimes;       // Acquire times that size greater than max size class(not pooled).
+    uint64 growTimes;                  // Recv buffer size hint grow times.
+    uint64 shrinkTimes;                // Recv buffer size hint shrink times.
+    std::vector<SizeClass> sizeClasses; // Size classes statistics.
+};
+
+/**
+ * \brief The size-classed receive buffer pool encapsulation.
+ *        Each poller owns one pool, socket acquire recv buffer from the pool on every readable event,
+ *        and the buffer will be recycled to the pool when it has been consumed(in any thread).
+ *        Size classes are power of two, from LLBC_CFG_COMM_RECV_BUF_POOL_MIN_SIZE to
+ *        LLBC_CFG_COMM_RECV_BUF_POOL_MAX_SIZE.
+ */
+class LLBC_HIDDEN LLBC_RecvBufferPool
+{
+public:
+    explicit LLBC_RecvBufferPool(int pollerId);
+    ~LLBC_RecvBufferPool();
+
+public:
+    /**
+     * Acquire a recv buffer, the buffer size is greater than or equal to given size.
+     * @param[in] size - the required buffer size.
+     * @return LLBC_MessageBlock * - the recv buffer, use LLBC_Recycle() to release.
+     */
+    LLBC_MessageBlock *Acquire(size_t size);
+
+    /**
+     * Compute the next recv buffer size hint, according to the last read size.
+     * - if the buffer has been filled, double the size hint.
+     * - if the read size less than quarter of the size hint, halve the size hint.
+     * @param[in] sizeHint  - current size hint.
+     * @param[in] recvedLen - the last read size.
+     * @param[in] bufFull   - the buffer has been filled or not.
+     * @return size_t - the next size hint.
+     */
+    size_t AdjustSizeHint(size_t sizeHint, size_t recvedLen, bool bufFull);
+
+public:
+    /**
+     * Get the pool statistics.
+     * @param[out] stat - the statistics.
+     */
+    void GetStatistics(LLBC_RecvBufferPoolStat &stat) const;
+
+    /**
+     * Collect pool free buffers.
+     * @param[in] deep - deep collect flag.
+     */
+    void Collect(bool deep);
+
+private:
+    /**
+     * Get the size class index of given size, return -1 if greater than max size class.
+     */
+    static int GetSizeClassIndex(size_t size);
+
+    LLBC_DISABLE_ASSIGNMENT(LLBC_RecvBufferPool);
+
+private:
+    struct _SizeClass
+    {
+        size_t bufSize;
+        LLBC_ObjPool *objPool;
+        LLBC_TypedObjPool<LLBC_MessageBlock> *typedObjPool;
+
+        uint64 acquireTimes;
+        uint64 reuseTimes;
+        uint64 allocTimes;
+    };
+
+    int _pollerId;
+    std::vector<_SizeClass> _sizeClasses;
+
+    uint64 _unpooledAcquireTimes;
+    uint64 _growTimes;
+    uint64 _shrinkTimes;
+};
+
+__LLBC_NS_END
@@ -36,6 +36,7 @@ class LLBC_ComponentFactory;
 class LLBC_IProtocolFactory;
 class LLBC_ProtocolStack;
 class LLBC_ServiceEventFirer;
+class LLBC_RecvBufferPoolStat;
 
 __LLBC_NS_END
 
@@ -211,6 +212,86 @@ public:
      */
     virtual int SuppressCoderNotFoundWarning() = 0;
 
+    /**
+     * Check shared multicast option is enabled or not.
+     * If enabled, Multicast()/Broadcast() will encode&frame the payload once, and all sessions share it.
+     * @return bool - the shared multicast option.
+     */
+    virtual bool IsSharedMulticast() const = 0;
+
+    /**
+     * Enable/Disable shared multicast option.
+     * Note: Only the session which protocol stack support shared frame can send the shared frame directly,
+     *       see LLBC_IProtocol::IsSharedFrameSupported().
+     * @param[in] sharedMulticast - the shared multicast option.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetSharedMulticast(bool sharedMulticast) = 0;
+
+    /**
+     * Check event wakeup option is enabled or not.
+     * If enabled, service will not sleep to the next frame, it will wait the queued events(eg: DataArrival)
+     * and posts with deadline equal to the next frame boundary, and handle them once arrived.
+     * @return bool - the event wakeup option.
+     */
+    virtual bool IsEventWakeup() const = 0;
+
+    /**
+     * Enable/Disable event wakeup option.
+     * Note: Components update/late-update and timer-scheduler update still driven by service FPS.
+     * @param[in] eventWakeup - the event wakeup option.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetEventWakeup(bool eventWakeup) = 0;
+
+    /**
+     * Check poller reactor mode is enabled or not.
+     * If enabled, poller thread itself wait io events and handle them, commands(AddSock/Send/Close/...)
+     * pushed to poller will wakeup the poller thread, no poller monitor thread will be created.
+     * Note: Only epoll poller supported, other poller models ignore this option.
+     * @return bool - the poller reactor mode option.
+     */
+    virtual bool IsPollerReactorMode() const = 0;
+
+    /**
+     * Enable/Disable poller reactor mode, only can be set before service started.
+     * @param[in] pollerReactorMode - the poller reactor mode option.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetPollerReactorMode(bool pollerReactorMode) = 0;
+
+    /**
+     * Check send batching option is enabled or not.
+     * If enabled, packets sent in service thread will be accumulated per poller and pushed to pollers
+     * by one event at frame boundary(or batch size limit reached), the packets sent in other threads
+     * still push to pollers immediately.
+     * Note: Latency-critical sends can call FlushSends() to push batched packets immediately.
+     * @return bool - the send batching option.
+     */
+    virtual bool IsSendBatching() const = 0;
+
+    /**
+     * Enable/Disable send batching option, only can be set before service started.
+     * @param[in] sendBatching - the send batching option.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetSendBatching(bool sendBatching) = 0;
+
+    /**
+     * Check lock-free event queue option is enabled or not.
+     * If enabled, service and it's pollers use lock-free multi-producer/single-consumer event queue,
+     * reduce the contention when many threads(eg: pollers) push events to one service.
+     * @return bool - the lock-free event queue option.
+     */
+    virtual bool IsLockFreeEventQueue() const = 0;
+
+    /**
+     * Enable/Disable lock-free event queue option, only can be set before service started.
+     * @param[in] lockFreeEventQueue - the lock-free event queue option.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetLockFreeEventQueue(bool lockFreeEventQueue) = 0;
+
 public:
     /**
      * Startup service, default will startup one poller to work.
@@ -326,6 +407,13 @@ public:
      */
     virtual int Send(LLBC_Packet *packet) = 0;
 
+    /**
+     * Flush the packets batched by send batching option(see IsSendBatching()), push them to pollers immediately.
+     * Note: Only the packets sent in service thread are batched, call this method in other threads do nothing.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int FlushSends() = 0;
+
     /**
      * Send data(these methods will automatics create packet to send).
      * Note: 
@@ -659,6 +747,12 @@ public:
      */
     virtual LLBC_ObjPool &GetThreadUnsafeObjPool() = 0;
 
+    /**
+     * Get service pollers recv buffer pool statistics(one element per poller).
+     * @param[out] stats - the recv buffer pool statistics.
+     */
+    virtual void GetRecvBufferPoolStats(std::vector<LLBC_RecvBufferPoolStat> &stats) const = 0;
+
 public:
     /**
      * One time service call routine, if service drive mode is ExternalDrive, you must manual call this method.
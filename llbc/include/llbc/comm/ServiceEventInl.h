@@ -151,4 +151,11 @@ inline LLBC_SvcEv_FireEv::~LLBC_SvcEv_FireEv()
     }
 }
 
+inline void LLBC_SvcEvUtil::DestroyEvBlock(LLBC_MessageBlock *block)
+{
+    // Event constructed in block buffer, destruct it and recycle block.
+    reinterpret_cast<LLBC_ServiceEvent *>(block->GetData())->~LLBC_ServiceEvent();
+    LLBC_Recycle(block);
+}
+
 __LLBC_NS_END
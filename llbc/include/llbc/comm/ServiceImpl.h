@@ -25,6 +25,7 @@
 #include "llbc/comm/ServiceEvent.h"
 #include "llbc/comm/ServiceEventFirer.h"
 #include "llbc/comm/PollerMgr.h"
+#include "llbc/comm/OpcodeDispatchTable.h"
 #include "llbc/comm/protocol/ProtocolStack.h"
 
 __LLBC_NS_BEGIN
@@ -107,6 +108,71 @@ public:
      */
     int SuppressCoderNotFoundWarning() override;
 
+    /**
+     * Check shared multicast option is enabled or not.
+     * @return bool - the shared multicast option.
+     */
+    bool IsSharedMulticast() const override;
+
+    /**
+     * Enable/Disable shared multicast option.
+     * @param[in] sharedMulticast - the shared multicast option.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int SetSharedMulticast(bool sharedMulticast) override;
+
+    /**
+     * Check event wakeup option is enabled or not.
+     * @return bool - the event wakeup option.
+     */
+    bool IsEventWakeup() const override;
+
+    /**
+     * Enable/Disable event wakeup option.
+     * @param[in] eventWakeup - the event wakeup option.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int SetEventWakeup(bool eventWakeup) override;
+
+    /**
+     * Check poller reactor mode is enabled or not.
+     * @return bool - the poller reactor mode option.
+     */
+    bool IsPollerReactorMode() const override;
+
+    /**
+     * Enable/Disable poller reactor mode, only can be set before service started.
+     * @param[in] pollerReactorMode - the poller reactor mode option.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int SetPollerReactorMode(bool pollerReactorMode) override;
+
+    /**
+     * Check send batching option is enabled or not.
+     * @return bool - the send batching option.
+     */
+    bool IsSendBatching() const override;
+
+    /**
+     * Enable/Disable send batching option, only can be set before service started.
+     * @param[in] sendBatching - the send batching option.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int SetSendBatching(bool sendBatching) override;
+
+    /**
+     * Check lock-free event queue option is enabled or not.
+     * @return bool - the lock-free event queue option.
+     */
+    bool IsLockFreeEventQueue() const override;
+
+    /**
+     * Enable/Disable lock-free event queue option, only can be set before service started.
+     * @param[in] lockFreeEventQueue - the lock-free event queue option.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int SetLockFreeEventQueue(bool lockFreeEventQueue) override;
+
 public:
     /**
      * Startup service, default will startup one poller to work.
@@ -227,6 +293,12 @@ public:
      */
     int Send(LLBC_Packet *packet) override;
 
+    /**
+     * Flush the packets batched by send batching option, push them to pollers immediately.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int FlushSends() override;
+
     /**
      * Multicast bytes.
      * @param[in] sessionIds - the session Ids.
@@ -423,6 +495,12 @@ public:
      */
     LLBC_ObjPool &GetThreadUnsafeObjPool() override;
 
+    /**
+     * Get service pollers recv buffer pool statistics(one element per poller).
+     * @param[out] stats - the recv buffer pool statistics.
+     */
+    void GetRecvBufferPoolStats(std::vector<LLBC_RecvBufferPoolStat> &stats) const override;
+
 public:
     /**
      * One time service call routine, if service drive mode is ExternalDrive, you must manual call this method.
@@ -530,6 +608,12 @@ private:
      * Queued event operation methods.
      */
     void HandleQueuedEvents();
+
+    /**
+     * Wait and handle queued events/posts until next frame, only available when event wakeup option enabled.
+     * @param[in] frameInterval - the frame interval, in milli-seconds.
+     */
+    void HandleEventsUntilNextFrame(int frameInterval);
     void HandleEv_SessionCreate(LLBC_ServiceEvent &ev);
     void HandleEv_SessionDestroy(LLBC_ServiceEvent &ev);
     void HandleEv_AsyncConnResult(LLBC_ServiceEvent &ev);
@@ -555,6 +639,11 @@ private:
     LLBC_Library *OpenCompLibrary(const LLBC_String &libPath, bool &existingLib);
     void CloseCompLibrary(const LLBC_String &libPath);
 
+    /**
+     * Compile coder factories/handlers/pre-handlers/status-handlers opcode dispatch tables.
+     */
+    void CompileDispatchTables();
+
     /**
      * Auto-Release pool operation methods.
      */
@@ -591,6 +680,23 @@ private:
                      bool lock = true,
                      bool checkRunningPhase = true,
                      bool checkSessionValidity = true);
+    int SharedMulticast(const LLBC_SessionIds &sessionIds,
+                        int opcode,
+                        const void *bytes,
+                        size_t len,
+                        int status,
+                        uint32 flags,
+                        bool checkSessionValidity);
+
+    /**
+     * Send packet to poller, if enabled send batching option and in service thread, packet will be batched.
+     */
+    int SendToPoller(LLBC_Packet *packet);
+
+    /**
+     * Flush send batches, only available in service thread.
+     */
+    void FlushSendBatches();
 
 private:
     static int _maxId; // Max service Id.
@@ -623,6 +729,11 @@ private:
     LLBC_PollerMgr _pollerMgr; // Poller manager.
     LLBC_SpinLock _protoLock; // Protocol logic about lock.
     bool _suppressedCoderNotFoundWarning; // Suppress coder not found warning flag.
+    volatile bool _sharedMulticast; // Shared multicast flag.
+    volatile bool _eventWakeup; // Event wakeup flag.
+    bool _pollerReactorMode; // Poller reactor mode flag.
+    bool _sendBatching; // Send batching flag.
+    bool _lockFreeEventQueue; // Lock-free event queue flag.
     LLBC_IProtocolFactory *_dftProtocolFactory; // Default protocol factory.
     std::map<int, LLBC_IProtocolFactory *> _sessionProtoFactory; // Specific protocol factory.
     class _ReadySessionInfo // Ready session information.
@@ -656,14 +767,15 @@ private:
     std::map<LLBC_String, LLBC_Library *> _compLibraries; // Component libraries(if is dynamic load component).
 
     // Coder & Handler about members.
-    std::map<int, LLBC_CoderFactory *> _coderFactories; // Coder Factories.
-    std::map<int, LLBC_Delegate<void(LLBC_Packet &)> > _handlers; // Packet handlers.
-    std::map<int, LLBC_Delegate<bool(LLBC_Packet &)> > _preHandlers; // Packet pre-handlers.
+    // Note: all opcode dispatch tables compiled after comps inited.
+    LLBC_OpcodeDispatchTable<LLBC_CoderFactory *> _coderFactories; // Coder Factories.
+    LLBC_OpcodeDispatchTable<LLBC_Delegate<void(LLBC_Packet &)> > _handlers; // Packet handlers.
+    LLBC_OpcodeDispatchTable<LLBC_Delegate<bool(LLBC_Packet &)> > _preHandlers; // Packet pre-handlers.
     #if LLBC_CFG_COMM_ENABLE_UNIFY_PRESUBSCRIBE
     LLBC_Delegate<bool(LLBC_Packet &)> _unifyPreHandler; // Unify packet pre-handler.
     #endif // LLBC_CFG_COMM_ENABLE_UNIFY_PRESUBSCRIBE
     #if LLBC_CFG_COMM_ENABLE_STATUS_HANDLER
-    std::map<int, std::map<int, LLBC_Delegate<void(LLBC_Packet &)> > > _statusHandlers; // Status handlers.
+    LLBC_OpcodeDispatchTable<std::map<int, LLBC_Delegate<void(LLBC_Packet &)> > > _statusHandlers; // Status handlers.
     #endif // LLBC_CFG_COMM_ENABLE_STATUS_HANDLER
 
 private:
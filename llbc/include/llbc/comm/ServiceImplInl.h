@@ -58,6 +58,31 @@ inline bool LLBC_ServiceImpl::IsStarted() const
     return _runningPhase == LLBC_ServiceRunningPhase::Started;
 }
 
+inline bool LLBC_ServiceImpl::IsSharedMulticast() const
+{
+    return _sharedMulticast;
+}
+
+inline bool LLBC_ServiceImpl::IsEventWakeup() const
+{
+    return _eventWakeup;
+}
+
+inline bool LLBC_ServiceImpl::IsPollerReactorMode() const
+{
+    return _pollerReactorMode;
+}
+
+inline bool LLBC_ServiceImpl::IsSendBatching() const
+{
+    return _sendBatching;
+}
+
+inline bool LLBC_ServiceImpl::IsLockFreeEventQueue() const
+{
+    return _lockFreeEventQueue;
+}
+
 inline int LLBC_ServiceImpl::GetFPS() const
 {
     return _fps;
@@ -89,6 +114,11 @@ inline LLBC_ObjPool &LLBC_ServiceImpl::GetThreadUnsafeObjPool()
     return _threadUnsafeObjPool;
 }
 
+inline void LLBC_ServiceImpl::GetRecvBufferPoolStats(std::vector<LLBC_RecvBufferPoolStat> &stats) const
+{
+    _pollerMgr.GetRecvBufferPoolStats(stats);
+}
+
 inline void LLBC_ServiceImpl::LockService()
 {
     _lock.Lock();
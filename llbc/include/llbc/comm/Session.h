@@ -216,6 +216,19 @@ public:
      */
     int Send(LLBC_MessageBlock *block);
 
+    /**
+     * Send shared frame(see LLBC_PacketProtocol::EncodeFrame()).
+     * If session protocol stack not support shared frame, will rebuild packet from frame to send.
+     * Note: 
+     *       No matter method call success or not, method will steal <frame> the parameter.
+     * @param[in] frame  - the shared frame.
+     * @param[in] opcode - the frame opcode.
+     * @param[in] status - the frame status.
+     * @param[in] flags  - the frame flags.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int SendSharedFrame(LLBC_MessageBlock *frame, int opcode, int status, uint32 flags);
+
 public:
     /**
      * Send event handler method, call by poller.
@@ -55,6 +55,37 @@ public:
      */
     void SetNoDelay(bool noDelay);
 
+public:
+    /**
+     * Get gather send option.
+     * @return bool - return the option value.
+     */
+    bool IsGatherSend() const;
+
+    /**
+     * Set gather send option, if enabled, all pending message blocks will be sent
+     * by one writev()/WSASend() call, instead of one send() call per message block.
+     * @param[in] gatherSend - the option value.
+     */
+    void SetGatherSend(bool gatherSend);
+
+public:
+    /**
+     * Get reuse port option(only available for listen session).
+     * @return bool - return the option value.
+     */
+    bool IsReusePort() const;
+
+    /**
+     * Set reuse port option(only available for listen session), if enabled, Listen() will open one
+     * SO_REUSEPORT listen socket per poller, let the kernel load-balance the incoming connections,
+     * each poller accepts and owns its accepted sessions.
+     * Note:
+     *  If the platform/poller not support SO_REUSEPORT(eg: IocpPoller), will fall back to one listen socket.
+     * @param[in] reusePort - the option value.
+     */
+    void SetReusePort(bool reusePort);
+
 public:
     /**
      * Get socket send buffer size.
@@ -130,6 +161,8 @@ public:
 
 private:
     bool _noDelay; // No-delay option, default is true.
+    bool _gatherSend; // Gather send option, default is LLBC_CFG_COMM_DFT_SESSION_GATHER_SEND.
+    bool _reusePort; // Reuse port option, default is LLBC_CFG_COMM_DFT_SESSION_REUSE_PORT.
     size_t _sockSendBufSize; // socket send buffer size, in bytes, default is 0, it means use os default.
     size_t _sockRecvBufSize; // socket recv buffer size, in bytes, default is 0, it means use os default.
     size_t _sessionSendBufSize; // session send buffer size, in bytes, default is LLBC_CFG_COMM_DFT_SESSION_SEND_BUF_SIZE
@@ -30,6 +30,8 @@ inline LLBC_SessionOpts::LLBC_SessionOpts(bool noDelay,
                                           size_t sessionRecvBufSize,
                                           size_t maxPacketSize)
 : _noDelay(noDelay)
+, _gatherSend(LLBC_CFG_COMM_DFT_SESSION_GATHER_SEND != 0)
+, _reusePort(LLBC_CFG_COMM_DFT_SESSION_REUSE_PORT != 0)
 , _sockSendBufSize(sockSendBufSize)
 , _sockRecvBufSize(sockRecvBufSize)
 , _sessionSendBufSize(sessionSendBufSize)
@@ -52,6 +54,26 @@ inline void LLBC_SessionOpts::SetNoDelay(bool noDelay)
     _noDelay = noDelay;
 }
 
+inline bool LLBC_SessionOpts::IsGatherSend() const
+{
+    return _gatherSend;
+}
+
+inline void LLBC_SessionOpts::SetGatherSend(bool gatherSend)
+{
+    _gatherSend = gatherSend;
+}
+
+inline bool LLBC_SessionOpts::IsReusePort() const
+{
+    return _reusePort;
+}
+
+inline void LLBC_SessionOpts::SetReusePort(bool reusePort)
+{
+    _reusePort = reusePort;
+}
+
 inline size_t LLBC_SessionOpts::GetSockSendBufSize() const
 {
     return _sockSendBufSize;
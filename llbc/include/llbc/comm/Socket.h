@@ -58,14 +58,6 @@ public:
      */
     void SetSession(LLBC_Session *session);
 
-    #if LLBC_CFG_COMM_SESSION_RECV_BUF_USE_OBJ_POOL
-    /**
-     * Set message block pool instance.
-     * @param[in] msgBlockPoolInst - the message block pool instance.
-     */
-    void SetMsgBlockPoolInst(LLBC_ObjectPoolInst<LLBC_MessageBlock> *msgBlockPoolInst);
-    #endif // LLBC_CFG_COMM_SESSION_RECV_BUF_USE_OBJ_POOL
-
     /**
      * Get the poller type.
      * @return int - the poller type.
@@ -136,6 +128,12 @@ public:
      */
     int DisableAddressReusable();
 
+    /**
+     * Enable port reusable option(SO_REUSEPORT).
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int EnablePortReusable();
+
     /**
      * Check the socket blocking flag.
      * @return bool - return true if is non-blocking, 
@@ -481,6 +479,7 @@ private:
 
     LLBC_MessageBuffer _willSend;
     size_t _maxPacketSize;
+    size_t _recvBufSizeHint; // Adaptive recv buffer size hint, 0 means use session recv buffer size.
 
 #if LLBC_TARGET_PLATFORM_WIN32
     bool _nonBlocking;
@@ -489,10 +488,6 @@ private:
     size_t _iocpSendingDataSize;
 #endif // LLBC_TARGET_PLATFORM_WIN32
 
-#if LLBC_CFG_COMM_SESSION_RECV_BUF_USE_OBJ_POOL
-    LLBC_ObjectPoolInst<LLBC_MessageBlock> *_msgBlockPoolInst;
-#endif // LLBC_CFG_COMM_SESSION_RECV_BUF_USE_OBJ_POOL
-
 private:
 #if LLBC_TARGET_PLATFORM_WIN32
     static char _acceptExBuf[(sizeof(LLBC_SockAddr_IN) + 16) * 2];
@@ -59,6 +59,12 @@ public:
      * @return int - return 0 if success, otherwise return -1.
      */
     int Recv(void *in, void *&out, bool &removeSession) override;
+
+    /**
+     * Check this protocol can send the shared frame directly or not.
+     * @return bool - return true.
+     */
+    bool IsSharedFrameSupported() const override;
 };
 
 __LLBC_NS_END
@@ -60,6 +60,12 @@ public:
      */
     int Recv(void *in, void *&out, bool &removeSession) override;
 
+    /**
+     * Check this protocol can send the shared frame directly or not.
+     * @return bool - return true.
+     */
+    bool IsSharedFrameSupported() const override;
+
     /**
      * Add coder factory to protocol, only available in Codec-Layer.
      * @param[in] opcode - the opcode.
@@ -23,6 +23,8 @@
 
 #include "llbc/core/Core.h"
 
+#include "llbc/comm/OpcodeDispatchTable.h"
+
 __LLBC_NS_BEGIN
 
 /**
@@ -47,7 +49,7 @@ class LLBC_EXPORT LLBC_IProtocol
     typedef LLBC_IProtocol This;
 
 public:
-    typedef std::map<int, LLBC_CoderFactory *> Coders;
+    typedef LLBC_OpcodeDispatchTable<LLBC_CoderFactory *> Coders;
 
 public:
     LLBC_IProtocol();
@@ -96,6 +98,15 @@ public:
      */
     virtual bool Ctrl(int cmd, const LLBC_Variant &ctrlData, bool &removeSession);
 
+public:
+    /**
+     * Check this protocol can send the shared frame(see LLBC_PacketProtocol::EncodeFrame()) directly or not,
+     * used by Service::Multicast()/Broadcast() to share one encoded&framed payload between sessions.
+     * Note: If you override Send() method, you must override this method too.
+     * @return bool - return true if supported, default return false.
+     */
+    virtual bool IsSharedFrameSupported() const;
+
 protected:
     /**
      * Get session Id.
@@ -81,6 +81,27 @@ public:
      */
     int Recv(void *in, void *&out, bool &removeSession) override;
 
+    /**
+     * Check this protocol can send the shared frame directly or not.
+     * @return bool - return true.
+     */
+    bool IsSharedFrameSupported() const override;
+
+public:
+    /**
+     * Get the library default header length.
+     * @return size_t - the header length.
+     */
+    static size_t GetHeaderLength();
+
+    /**
+     * Encode packet to frame(header + payload), the packet will be recycled.
+     * The returned frame can be shared between sessions(see LLBC_MessageBlock::Share()).
+     * @param[in] packet - the packet.
+     * @return LLBC_MessageBlock * - the frame.
+     */
+    static LLBC_MessageBlock *EncodeFrame(LLBC_Packet *packet);
+
 private:
     LLBC_PacketHeaderAssembler _headerAssembler;
 
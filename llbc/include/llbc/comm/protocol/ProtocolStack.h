@@ -135,6 +135,12 @@ public:
      */
     int SetFilter(LLBC_IProtocolFilter *filter, int toProto);
 
+    /**
+     * Check all protocols in this stack can send the shared frame directly or not.
+     * @return bool - return true if supported, otherwise return false.
+     */
+    bool IsSharedFrameSupported() const;
+
 public:
     /**
      * When packet send, will use this protocol stack method to filter and encode packet.
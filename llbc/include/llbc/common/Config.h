@@ -68,6 +68,14 @@
 #define LLBC_CFG_CORE_VARIANT_FAST_NUM_AS_STR_BEGIN         ((int)-256)
 // Define variant number as string method fast access end number(included).
 #define LLBC_CFG_CORE_VARIANT_FAST_NUM_AS_STR_END           ((int)256)
+// Enable(or disable) variant str/seq/dict copy-on-write, enabled by default.
+// If enabled, copy str/seq/dict variant only share the payload(ref-counted), payload will be
+// copied when variant modified.
+#define LLBC_CFG_CORE_VARIANT_COPY_ON_WRITE                 1
+// Enable(or disable) variant hash dict, disabled by default.
+// If enabled, variant dict use insertion ordered hash map(LLBC_OrderedHashMap) instead of std::map,
+// dict iteration order is the key insertion order, and str key will not equal to raw key.
+#define LLBC_CFG_CORE_VARIANT_HASH_DICT                     0
 
 /**
  * \brief core/file about config options define.
@@ -83,6 +91,11 @@
 #define LLBC_CFG_CORE_ENABLE_EVENT_FIRE_DEAD_LOOP_DETECTION 0
 // Enable(or disable) the event hook, enable by default.
 #define LLBC_CFG_CORE_ENABLE_EVENT_HOOK                     0
+// Event inline params count, params exceed this count will be stored in heap.
+#define LLBC_CFG_CORE_EVENT_INLINE_PARAM_COUNT              4
+// Event listeners direct index event id limit, event ids less than this value use direct indexed
+// listeners table, otherwise use hash table to lookup event listeners.
+#define LLBC_CFG_CORE_EVENT_DIRECT_INDEX_ID_LIMIT            1024
 
 /**
  * \brief core/utils about config options define.
@@ -95,6 +108,9 @@
 #define LLBC_CFG_CORE_UTILS_IMPL__UI64TOA                   0
 // Determine define win32-styled string datatypes or not, eg:LPSTR/LPTSTR/...
 #define LLBC_CFG_CORE_UTILS_DEF_WIN32_STYLED_STR_DATATYPES  0
+// Delegate inline buffer size, callable objects not greater than this size(eg: object + method pointer,
+// small captures lambda) will be stored in delegate directly, otherwise will be allocated in heap.
+#define LLBC_CFG_CORE_UTILS_DELEGATE_INLINE_SIZE            (3 * sizeof(void *))
 
 /**
  * \brief core/sampler about config options define.
@@ -140,6 +156,12 @@
 #define LLBC_CFG_LOG_DEFAULT_ASYNC_MODE                     0
 // Default log independent logger thread is set to false.
 #define LLBC_CFG_LOG_DEFAULT_INDEPENDENT_THREAD             0
+// Log thread max idle wait time, in milli-seconds, log thread will be woken up when log data pushed,
+// or wait timeout to flush loggers.
+#define LLBC_CFG_LOG_RUNNABLE_IDLE_WAIT_TIME                10
+// Default log deferred format is set to false(only available in asynchronous mode), if enabled,
+// log format arguments will be captured in caller thread, and formatted in log thread.
+#define LLBC_CFG_LOG_DEFAULT_DEFERRED_FORMAT                0
 // Default add timestamp in json log is set to false.
 #define LLBC_CFG_LOG_DEFAULT_ADD_TIMESTAMP_IN_JSON_LOG      0
 // Default is log to console.
@@ -216,6 +238,10 @@
  */
 // Long timeout time, in milliseconds, when a timer timeout time >= <this value>, when call Cancel(), will force remove from binary heap.
 #define LLBC_CFG_CORE_TIMER_LONG_TIMEOUT_TIME               86400000 // 1 day
+// Default timer scheduler backend(see LLBC_TimerSchedulerBackend):
+// - 0: Heap, binary heap, O(log n) schedule/expiry, short timeout timers lazy remove when cancel.
+// - 1: TimingWheel, hierarchical timing wheel(1 ms tick), O(1) schedule/cancel, amortized O(1) expiry.
+#define LLBC_CFG_CORE_TIMER_DFT_SCHEDULER_BACKEND           0
 
 /**
 * \brief core/objectpool about configs.
@@ -235,6 +261,10 @@
 #define LLBC_CFG_CORE_OBJPOOL_OBJ_REUSE_MATCH_METH_Reuse    1
 // Object pool use malloc instead.
 #define LLBC_CFG_CORE_OBJPOOL_USE_MALLOC_INSTEAD            0
+// Object pool thread cache magazine size(in object), only available in thread safe object pool.
+// Each thread holds 2 magazines per typed object pool, full/empty magazines exchange with the
+// typed object pool depot, set to 0 to disable thread cache.
+#define LLBC_CFG_CORE_OBJPOOL_MAGAZINE_SIZE                 32
 
 /**
  * \brief ObjBase about configs.
@@ -264,20 +294,57 @@
 #define LLBC_CFG_COMM_DFT_SESSION_SEND_BUF_SIZE             LLBC_INFINITE
 // Default session recv buffer size(not allow set to LLBC_INFINITE, is must be a actually size).
 // Note:
-// - this buffer size is initialize recv buffer size, if not enough to recv socket data, will auto expand.
+// - this buffer size is initialize recv buffer size, if not enough to recv socket data, will auto expand
+//   (see LLBC_CFG_COMM_RECV_BUF_POOL_MIN_SIZE/LLBC_CFG_COMM_RECV_BUF_POOL_MAX_SIZE).
 #define LLBC_CFG_COMM_DFT_SESSION_RECV_BUF_SIZE             1024
 // Default max packet size
 // Note:
 // - this packet size is PacketProcol limit, the size is only used for PacketProcol
 #define LLBC_CFG_COMM_DFT_MAX_PACKET_SIZE                   LLBC_INFINITE
-// Session recv buffer use object pool option, this option is performance option.
-// Note: 
-// - if enabled, can improvement read data from socket performance,
-//   but once you turn on this option, your server memory will be streteched very large.
-// - if enabled, LLBC_CFG_COMM_DFT_SESSION_RECV_BUF_SIZE will no effect.
-#define LLBC_CFG_COMM_SESSION_RECV_BUF_USE_OBJ_POOL         0
+// Session recv buffer pool min/max size class(power of two), in bytes.
+// Note:
+// - each poller owns a size-classed recv buffer pool, socket acquire recv buffer from the pool
+//   on every readable event, and adaptive adjust the next recv buffer size according to recent read sizes.
+// - LLBC_CFG_COMM_DFT_SESSION_RECV_BUF_SIZE is the initialize recv buffer size hint.
+// - if recv buffer size greater than max size class, will not pooled.
+#define LLBC_CFG_COMM_RECV_BUF_POOL_MIN_SIZE                1024
+#define LLBC_CFG_COMM_RECV_BUF_POOL_MAX_SIZE                (64 * 1024)
 // Message buffer element(stripe) allow resize limit.
 #define LLBC_CFG_COMM_MSG_BUFFER_ELEM_RESIZE_LIMIT          (8 * 1024)
+// Default session gather send option, if enabled, socket will send all pending message blocks by one
+// writev()/WSASend() call, otherwise send message blocks one by one.
+#define LLBC_CFG_COMM_DFT_SESSION_GATHER_SEND               1
+// Gather send max buffer count per system call(will be truncated to IOV_MAX on Non-WIN32 platform).
+#define LLBC_CFG_COMM_GATHER_SEND_MAX_BUF_COUNT             64
+// Gather send max bytes per system call.
+#define LLBC_CFG_COMM_GATHER_SEND_MAX_BYTES                 (256 * 1024)
+// Default session reuse port option(only available for listen session), if enabled, service will open
+// one SO_REUSEPORT listen socket per poller, and each poller accepts and owns its accepted sessions.
+#define LLBC_CFG_COMM_DFT_SESSION_REUSE_PORT                0
+// Packet payload reserved headroom size, in bytes.
+// Note:
+// - if headroom size >= packet protocol header size(20 bytes), packet protocol will write header into
+//   the payload headroom and send the payload block directly, otherwise will copy payload to new block.
+// - set to 0 to disable this feature.
+#define LLBC_CFG_COMM_PACKET_PAYLOAD_HEADROOM               20
+// Default service shared multicast option, if enabled, Service::Multicast()/Broadcast() will encode&frame
+// the payload once and share the frame between all sessions, otherwise copy&frame the payload per session.
+#define LLBC_CFG_COMM_DFT_SERVICE_SHARED_MULTICAST          1
+// Default service event wakeup option, if enabled, service will wait the queued events/posts with deadline
+// equal to the next frame boundary(instead of sleep), once events/posts arrived, handle them immediately.
+#define LLBC_CFG_COMM_DFT_SERVICE_EVENT_WAKEUP              0
+// Default service poller reactor mode option, if enabled, poller thread itself wait io events(eg: epoll_wait)
+// and be woken up when commands(AddSock/Send/Close/...) pushed, no separate poller monitor thread needed.
+// Note: Only epoll poller supported, other poller models ignore this option.
+#define LLBC_CFG_COMM_DFT_SERVICE_POLLER_REACTOR_MODE       0
+// Default service send batching option, if enabled, packets sent in service thread will be accumulated
+// per poller and pushed to pollers by one event at frame boundary(or batch size limit reached).
+#define LLBC_CFG_COMM_DFT_SERVICE_SEND_BATCHING             0
+// Service send batch max packets count(per poller), once reached, the batch will be pushed to poller immediately.
+#define LLBC_CFG_COMM_SERVICE_SEND_BATCH_MAX_PACKETS        256
+// Default service lock-free event queue option, if enabled, service and it's pollers use lock-free
+// multi-producer/single-consumer event queue(see LLBC_LockFreeMessageQueue).
+#define LLBC_CFG_COMM_DFT_SERVICE_LOCK_FREE_EVENT_QUEUE     0
 // Default service FPS value.
 #define LLBC_CFG_COMM_DFT_SERVICE_FPS                       200
 // Min service FPS value.
@@ -290,6 +357,11 @@
 #define LLBC_CFG_COMM_ENABLE_STATUS_HANDLER                 1
 // Determine enable the unify pre-subscribe handler support or not.
 #define LLBC_CFG_COMM_ENABLE_UNIFY_PRESUBSCRIBE             1
+// Opcode dispatch table dense factor, if (maxOpcode - minOpcode + 1) <= opcodes count * factor,
+// the dispatch table will be compiled to dense array, otherwise compiled to hash table.
+#define LLBC_CFG_COMM_OPCODE_DISPATCH_DENSE_FACTOR          4
+// Opcode dispatch table min dense range, opcodes range within this value always compiled to dense array.
+#define LLBC_CFG_COMM_OPCODE_DISPATCH_MIN_DENSE_RANGE       1024
 // Dynamic create comp create method prefix name.
 #define LLBC_CFG_COMM_CREATE_COMP_FROM_LIB_FUNC_PREFIX      "llbc_create_comp_"
 // The poller model config(Platform specific).
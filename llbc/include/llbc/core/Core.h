@@ -43,6 +43,7 @@
 // core/algo
 #include "llbc/core/algo/Hash.h"
 #include "llbc/core/algo/RingBuffer.h"
+#include "llbc/core/algo/OrderedHashMap.h"
 
 // core/bundle
 #include "llbc/core/bundle/Bundle.h"
@@ -69,6 +70,7 @@
 
 // core/variant
 #include "llbc/core/variant/Variant.h"
+#include "llbc/core/variant/VariantView.h"
 
 // core/rapidjson
 #include "llbc/core/rapidjson/json.h"
@@ -108,6 +110,7 @@
 #include "llbc/core/thread/MessageBlock.h"
 #include "llbc/core/thread/MessageBuffer.h"
 #include "llbc/core/thread/MessageQueue.h"
+#include "llbc/core/thread/LockFreeMessageQueue.h"
 #include "llbc/core/thread/ThreadMgr.h"
 #include "llbc/core/thread/Task.h"
 
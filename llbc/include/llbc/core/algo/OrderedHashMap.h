@@ -0,0 +1,239 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2013 lailongwei<lailongwei@126.com>
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of 
+// this software and associated documentation files (the "Software"), to deal in 
+// the Software without restriction, including without limitation the rights to 
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of 
+// the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS 
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER 
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN 
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+#include "llbc/common/Common.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The insertion ordered hash map implement(open addressing + insertion ordered entries).
+ *        Interface is compatible with std::map(STL naming style), iteration order is the insertion order.
+ *        Note:
+ *          - Element reference(pointer) is stable until element erased.
+ *          - Iterators are invalidated when new element inserted, erase only invalidate the erased iterator.
+ */
+template <typename _Key,
+          typename _Val,
+          typename _Hash = std::hash<_Key>,
+          typename _KeyEqual = std::equal_to<_Key>>
+class LLBC_OrderedHashMap
+{
+public:
+    typedef _Key key_type;
+    typedef _Val mapped_type;
+    typedef std::pair<const _Key, _Val> value_type;
+    typedef size_t size_type;
+    typedef ptrdiff_t difference_type;
+    typedef _Hash hasher;
+    typedef _KeyEqual key_equal;
+    typedef value_type &reference;
+    typedef const value_type &const_reference;
+
+private:
+    /**
+     * \brief The map node, cached the key hash value.
+     */
+    struct _Node
+    {
+        value_type kv;
+        size_t hash;
+
+        template <typename... _Args>
+        explicit _Node(_Args &&... args) : kv(std::forward<_Args>(args)...), hash(0) {  }
+    };
+
+    typedef std::vector<_Node *> _Entries;
+
+    /**
+     * \brief The map iterator, skip erased entries.
+     */
+    template <bool _Const>
+    class _Iter
+    {
+    public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef typename LLBC_OrderedHashMap::value_type value_type;
+        typedef ptrdiff_t difference_type;
+        typedef std::conditional_t<_Const, const value_type *, value_type *> pointer;
+        typedef std::conditional_t<_Const, const value_type &, value_type &> reference;
+
+    public:
+        _Iter() : _entries(nullptr), _idx(0) {  }
+        _Iter(const _Entries *entries, size_t idx) : _entries(entries), _idx(idx) {  }
+        template <bool _OtherConst, typename = std::enable_if_t<_Const && !_OtherConst>>
+        _Iter(const _Iter<_OtherConst> &other) : _entries(other._entries), _idx(other._idx) {  }
+
+    public:
+        reference operator*() const { return (*_entries)[_idx]->kv; }
+        pointer operator->() const { return &(*_entries)[_idx]->kv; }
+
+        _Iter &operator++()
+        {
+            const size_t entryCount = _entries->size();
+            while (++_idx < entryCount && !(*_entries)[_idx]);
+            return *this;
+        }
+
+        _Iter operator++(int) { _Iter tmp(*this); ++*this; return tmp; }
+
+        _Iter &operator--()
+        {
+            while (_idx > 0 && !(*_entries)[--_idx]);
+            return *this;
+        }
+
+        _Iter operator--(int) { _Iter tmp(*this); --*this; return tmp; }
+
+        template <bool _OtherConst>
+        bool operator==(const _Iter<_OtherConst> &other) const { return _idx == other._idx; }
+        template <bool _OtherConst>
+        bool operator!=(const _Iter<_OtherConst> &other) const { return _idx != other._idx; }
+
+    private:
+        template <bool>
+        friend class _Iter;
+        friend class LLBC_OrderedHashMap;
+
+        const _Entries *_entries;
+        size_t _idx;
+    };
+
+public:
+    typedef _Iter<false> iterator;
+    typedef _Iter<true> const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+public:
+    /**
+     * Ctor & Dtor.
+     */
+    LLBC_OrderedHashMap();
+    LLBC_OrderedHashMap(std::initializer_list<value_type> il);
+    LLBC_OrderedHashMap(const LLBC_OrderedHashMap &other);
+    LLBC_OrderedHashMap(LLBC_OrderedHashMap &&other) noexcept;
+    ~LLBC_OrderedHashMap();
+
+public:
+    /**
+     * Iterators.
+     */
+    iterator begin();
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+    reverse_iterator rbegin();
+    reverse_iterator rend();
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator rend() const;
+
+    /**
+     * Capacity.
+     */
+    bool empty() const;
+    size_type size() const;
+    size_type max_size() const;
+    void reserve(size_type n);
+
+    /**
+     * Lookup.
+     */
+    iterator find(const key_type &key);
+    const_iterator find(const key_type &key) const;
+    size_type count(const key_type &key) const;
+    bool contains(const key_type &key) const;
+    mapped_type &at(const key_type &key);
+    const mapped_type &at(const key_type &key) const;
+    mapped_type &operator[](const key_type &key);
+    mapped_type &operator[](key_type &&key);
+
+    /**
+     * Modifiers.
+     */
+    std::pair<iterator, bool> insert(const value_type &val);
+    template <typename _Pair, typename = std::enable_if_t<std::is_constructible_v<value_type, _Pair &&>>>
+    std::pair<iterator, bool> insert(_Pair &&val);
+    template <typename _InputIter>
+    void insert(_InputIter first, _InputIter last);
+    template <typename... _Args>
+    std::pair<iterator, bool> emplace(_Args &&... args);
+    template <typename... _Args>
+    std::pair<iterator, bool> try_emplace(const key_type &key, _Args &&... args);
+
+    iterator erase(const_iterator it);
+    iterator erase(iterator it);
+    iterator erase(const_iterator first, const_iterator last);
+    size_type erase(const key_type &key);
+
+    void clear();
+    void swap(LLBC_OrderedHashMap &other) noexcept;
+
+    /**
+     * Assignment.
+     */
+    LLBC_OrderedHashMap &operator=(const LLBC_OrderedHashMap &other);
+    LLBC_OrderedHashMap &operator=(LLBC_OrderedHashMap &&other) noexcept;
+
+    /**
+     * Relational operators.
+     * operator==: content compare(order insensitive).
+     * operator<:  lexicographical compare in iteration order.
+     */
+    bool operator==(const LLBC_OrderedHashMap &other) const;
+    bool operator!=(const LLBC_OrderedHashMap &other) const;
+    bool operator<(const LLBC_OrderedHashMap &other) const;
+
+private:
+    // Hash key(mixed hash value, make identity hash values distributed).
+    static size_t HashKey(const key_type &key);
+
+    // Find node entry index, return _entries.size() if not found.
+    size_t FindIndex(const key_type &key, size_t hash) const;
+    // Insert node(key must not exist in map), return node entry index.
+    size_t InsertNode(_Node *node);
+    // Erase node at given entry index.
+    void EraseIndex(size_t idx);
+
+    // Rehash map, erased entries will be compacted.
+    void Rehash(size_type bucketCount);
+
+    // Skip erased entries, return first non-erased entry index(from idx).
+    size_t SkipErased(size_t idx) const;
+
+private:
+    // Empty bucket & Erased bucket flag.
+    static constexpr uint32 _emptyBucket = 0;
+    static constexpr uint32 _erasedBucket = 0xffffffff;
+
+    _Entries _entries; // insertion ordered entries, erased entry is nullptr.
+    std::vector<uint32> _buckets; // Open addressing buckets, stored entry index + 1.
+    size_type _size; // Element count.
+    size_type _usedBuckets; // Used buckets count(included erased buckets).
+};
+
+__LLBC_NS_END
+
+#include "llbc/core/algo/OrderedHashMapInl.h"
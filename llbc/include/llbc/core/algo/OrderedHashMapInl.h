@@ -0,0 +1,534 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2013 lailongwei<lailongwei@126.com>
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of 
+// this software and associated documentation files (the "Software"), to deal in 
+// the Software without restriction, including without limitation the rights to 
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of 
+// the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS 
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER 
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN 
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+__LLBC_NS_BEGIN
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::LLBC_OrderedHashMap()
+: _size(0)
+, _usedBuckets(0)
+{
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::LLBC_OrderedHashMap(std::initializer_list<value_type> il)
+: _size(0)
+, _usedBuckets(0)
+{
+    reserve(il.size());
+    insert(il.begin(), il.end());
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::LLBC_OrderedHashMap(const LLBC_OrderedHashMap &other)
+: _size(0)
+, _usedBuckets(0)
+{
+    reserve(other._size);
+    insert(other.begin(), other.end());
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::LLBC_OrderedHashMap(LLBC_OrderedHashMap &&other) noexcept
+: _entries(std::move(other._entries))
+, _buckets(std::move(other._buckets))
+, _size(other._size)
+, _usedBuckets(other._usedBuckets)
+{
+    other._entries.clear();
+    other._buckets.clear();
+    other._size = 0;
+    other._usedBuckets = 0;
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::~LLBC_OrderedHashMap()
+{
+    clear();
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_FORCE_INLINE typename LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::iterator
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::begin()
+{
+    return iterator(&_entries, SkipErased(0));
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_FORCE_INLINE typename LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::iterator
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::end()
+{
+    return iterator(&_entries, _entries.size());
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_FORCE_INLINE typename LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::const_iterator
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::begin() const
+{
+    return const_iterator(&_entries, SkipErased(0));
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_FORCE_INLINE typename LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::const_iterator
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::end() const
+{
+    return const_iterator(&_entries, _entries.size());
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_FORCE_INLINE typename LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::const_iterator
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::cbegin() const
+{
+    return begin();
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_FORCE_INLINE typename LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::const_iterator
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::cend() const
+{
+    return end();
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_FORCE_INLINE typename LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::reverse_iterator
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_FORCE_INLINE typename LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::reverse_iterator
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_FORCE_INLINE typename LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::const_reverse_iterator
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_FORCE_INLINE typename LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::const_reverse_iterator
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_FORCE_INLINE bool LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::empty() const
+{
+    return _size == 0;
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_FORCE_INLINE typename LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::size_type
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::size() const
+{
+    return _size;
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_FORCE_INLINE typename LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::size_type
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::max_size() const
+{
+    return static_cast<size_type>(_erasedBucket - 1) / 2;
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+void LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::reserve(size_type n)
+{
+    // Load factor limit: 0.75.
+    size_type bucketCount = 8;
+    while (bucketCount * 3 < n * 4)
+        bucketCount <<= 1;
+
+    if (bucketCount > _buckets.size())
+        Rehash(bucketCount);
+    _entries.reserve(n);
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_FORCE_INLINE typename LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::iterator
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::find(const key_type &key)
+{
+    return iterator(&_entries, FindIndex(key, HashKey(key)));
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_FORCE_INLINE typename LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::const_iterator
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::find(const key_type &key) const
+{
+    return const_iterator(&_entries, FindIndex(key, HashKey(key)));
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_FORCE_INLINE typename LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::size_type
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::count(const key_type &key) const
+{
+    return contains(key) ? 1 : 0;
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_FORCE_INLINE bool LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::contains(const key_type &key) const
+{
+    return FindIndex(key, HashKey(key)) != _entries.size();
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+typename LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::mapped_type &
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::at(const key_type &key)
+{
+    const size_t idx = FindIndex(key, HashKey(key));
+    if (UNLIKELY(idx == _entries.size()))
+        throw std::out_of_range("LLBC_OrderedHashMap::at(): key not found");
+
+    return _entries[idx]->kv.second;
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+const typename LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::mapped_type &
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::at(const key_type &key) const
+{
+    return const_cast<LLBC_OrderedHashMap *>(this)->at(key);
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_FORCE_INLINE typename LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::mapped_type &
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::operator[](const key_type &key)
+{
+    return try_emplace(key).first->second;
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+typename LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::mapped_type &
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::operator[](key_type &&key)
+{
+    const size_t hash = HashKey(key);
+    const size_t idx = FindIndex(key, hash);
+    if (idx != _entries.size())
+        return _entries[idx]->kv.second;
+
+    _Node *node = new _Node(std::piecewise_construct,
+                            std::forward_as_tuple(std::move(key)),
+                            std::forward_as_tuple());
+    node->hash = hash;
+
+    return _entries[InsertNode(node)]->kv.second;
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_FORCE_INLINE std::pair<typename LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::iterator, bool>
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::insert(const value_type &val)
+{
+    return emplace(val);
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+template <typename _Pair, typename>
+LLBC_FORCE_INLINE std::pair<typename LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::iterator, bool>
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::insert(_Pair &&val)
+{
+    return emplace(std::forward<_Pair>(val));
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+template <typename _InputIter>
+void LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::insert(_InputIter first, _InputIter last)
+{
+    for (; first != last; ++first)
+        emplace(*first);
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+template <typename... _Args>
+std::pair<typename LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::iterator, bool>
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::emplace(_Args &&... args)
+{
+    // Key must be known before lookup, construct node first(same as std::unordered_map::emplace).
+    _Node *node = new _Node(std::forward<_Args>(args)...);
+    node->hash = HashKey(node->kv.first);
+
+    const size_t idx = FindIndex(node->kv.first, node->hash);
+    if (idx != _entries.size())
+    {
+        delete node;
+        return std::make_pair(iterator(&_entries, idx), false);
+    }
+
+    return std::make_pair(iterator(&_entries, InsertNode(node)), true);
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+template <typename... _Args>
+std::pair<typename LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::iterator, bool>
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::try_emplace(const key_type &key, _Args &&... args)
+{
+    const size_t hash = HashKey(key);
+    const size_t idx = FindIndex(key, hash);
+    if (idx != _entries.size())
+        return std::make_pair(iterator(&_entries, idx), false);
+
+    _Node *node = new _Node(std::piecewise_construct,
+                            std::forward_as_tuple(key),
+                            std::forward_as_tuple(std::forward<_Args>(args)...));
+    node->hash = hash;
+
+    return std::make_pair(iterator(&_entries, InsertNode(node)), true);
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+typename LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::iterator
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::erase(const_iterator it)
+{
+    EraseIndex(it._idx);
+    return iterator(&_entries, SkipErased(it._idx + 1));
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_FORCE_INLINE typename LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::iterator
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::erase(iterator it)
+{
+    return erase(const_iterator(it));
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+typename LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::iterator
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::erase(const_iterator first, const_iterator last)
+{
+    for (size_t idx = first._idx; idx < last._idx; ++idx)
+    {
+        if (_entries[idx])
+            EraseIndex(idx);
+    }
+
+    return iterator(&_entries, SkipErased(last._idx));
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+typename LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::size_type
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::erase(const key_type &key)
+{
+    const size_t idx = FindIndex(key, HashKey(key));
+    if (idx == _entries.size())
+        return 0;
+
+    EraseIndex(idx);
+    return 1;
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+void LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::clear()
+{
+    for (auto &node : _entries)
+        delete node;
+
+    _entries.clear();
+    std::fill(_buckets.begin(), _buckets.end(), _emptyBucket);
+    _size = 0;
+    _usedBuckets = 0;
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+void LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::swap(LLBC_OrderedHashMap &other) noexcept
+{
+    _entries.swap(other._entries);
+    _buckets.swap(other._buckets);
+    std::swap(_size, other._size);
+    std::swap(_usedBuckets, other._usedBuckets);
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual> &
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::operator=(const LLBC_OrderedHashMap &other)
+{
+    if (this != &other)
+    {
+        LLBC_OrderedHashMap copy(other);
+        swap(copy);
+    }
+
+    return *this;
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual> &
+LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::operator=(LLBC_OrderedHashMap &&other) noexcept
+{
+    if (this != &other)
+    {
+        clear();
+        swap(other);
+    }
+
+    return *this;
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+bool LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::operator==(const LLBC_OrderedHashMap &other) const
+{
+    if (_size != other._size)
+        return false;
+
+    for (auto &kv : *this)
+    {
+        auto otherIt = other.find(kv.first);
+        if (otherIt == other.end() || !(otherIt->second == kv.second))
+            return false;
+    }
+
+    return true;
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_FORCE_INLINE bool LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::operator!=(const LLBC_OrderedHashMap &other) const
+{
+    return !(*this == other);
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+bool LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::operator<(const LLBC_OrderedHashMap &other) const
+{
+    return std::lexicographical_compare(begin(), end(), other.begin(), other.end());
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_FORCE_INLINE size_t LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::HashKey(const key_type &key)
+{
+    // Use murmur3 fmix64 to mix hash value, std::hash<integer> is identity function in most STL implementations.
+    uint64 h = static_cast<uint64>(_Hash()(key));
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+
+    return static_cast<size_t>(h);
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+size_t LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::FindIndex(const key_type &key, size_t hash) const
+{
+    if (_size == 0)
+        return _entries.size();
+
+    const size_t mask = _buckets.size() - 1;
+    for (size_t bucketIdx = hash & mask; ; bucketIdx = (bucketIdx + 1) & mask)
+    {
+        const uint32 bucket = _buckets[bucketIdx];
+        if (bucket == _emptyBucket)
+            return _entries.size();
+        else if (bucket == _erasedBucket)
+            continue;
+
+        const _Node *node = _entries[bucket - 1];
+        if (node->hash == hash && _KeyEqual()(node->kv.first, key))
+            return bucket - 1;
+    }
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+size_t LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::InsertNode(_Node *node)
+{
+    // Make sure load factor(included erased buckets) not greater than 0.75.
+    if ((_usedBuckets + 1) * 4 > _buckets.size() * 3)
+    {
+        size_type bucketCount = std::max<size_type>(_buckets.size(), 8);
+        while (bucketCount * 3 < (_size + 1) * 4 * 2)
+            bucketCount <<= 1;
+        Rehash(bucketCount);
+    }
+
+    const size_t entryIdx = _entries.size();
+    _entries.push_back(node);
+
+    const size_t mask = _buckets.size() - 1;
+    size_t bucketIdx = node->hash & mask;
+    while (_buckets[bucketIdx] != _emptyBucket && _buckets[bucketIdx] != _erasedBucket)
+        bucketIdx = (bucketIdx + 1) & mask;
+
+    if (_buckets[bucketIdx] == _emptyBucket)
+        ++_usedBuckets;
+    _buckets[bucketIdx] = static_cast<uint32>(entryIdx + 1);
+
+    ++_size;
+
+    return entryIdx;
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+void LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::EraseIndex(size_t idx)
+{
+    _Node *node = _entries[idx];
+
+    const size_t mask = _buckets.size() - 1;
+    size_t bucketIdx = node->hash & mask;
+    while (_buckets[bucketIdx] != idx + 1)
+        bucketIdx = (bucketIdx + 1) & mask;
+
+    // Erased bucket still counted in _usedBuckets, until next rehash.
+    _buckets[bucketIdx] = _erasedBucket;
+    _entries[idx] = nullptr;
+    --_size;
+
+    delete node;
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+void LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::Rehash(size_type bucketCount)
+{
+    // Compact entries.
+    if (_size != _entries.size())
+        _entries.erase(std::remove(_entries.begin(), _entries.end(), nullptr), _entries.end());
+
+    // Rebuild buckets.
+    _buckets.assign(bucketCount, _emptyBucket);
+
+    const size_t mask = bucketCount - 1;
+    const size_t entryCount = _entries.size();
+    for (size_t entryIdx = 0; entryIdx < entryCount; ++entryIdx)
+    {
+        size_t bucketIdx = _entries[entryIdx]->hash & mask;
+        while (_buckets[bucketIdx] != _emptyBucket)
+            bucketIdx = (bucketIdx + 1) & mask;
+
+        _buckets[bucketIdx] = static_cast<uint32>(entryIdx + 1);
+    }
+
+    _usedBuckets = entryCount;
+}
+
+template <typename _Key, typename _Val, typename _Hash, typename _KeyEqual>
+LLBC_FORCE_INLINE size_t LLBC_OrderedHashMap<_Key, _Val, _Hash, _KeyEqual>::SkipErased(size_t idx) const
+{
+    const size_t entryCount = _entries.size();
+    while (idx < entryCount && !_entries[idx])
+        ++idx;
+
+    return idx;
+}
+
+__LLBC_NS_END
@@ -173,6 +173,7 @@ public:
     int LoadFromFile(const LLBC_String &file);
     /**
      * Load ini config from string content.
+     * Note: content is tokenized in a single pass, no per-line string copies are made.
      * @param[in] content - the string content.
      * @return int - return 0 if success, otherwise return -1.
      */
@@ -290,27 +291,29 @@ public:
     This &operator=(const This &another);
 
 private:
-    int ParseLine(const LLBC_String &line, size_t lineNum, LLBC_String &sectionName);
-    int TryParseSectionName(const LLBC_String &content,
+    int ParseLine(const char *line, size_t lineLen, size_t lineNum, LLBC_IniSection *&section);
+    int TryParseSectionName(const char *content,
+                            size_t contentLen,
                             const LLBC_String &comment,
                             size_t lineNum,
                             size_t contentBeginPos,
-                            LLBC_String &sectionName,
+                            LLBC_IniSection *&section,
                             bool &failedContinue);
-    int Split(const LLBC_String &line,
-              size_t lineNum,
-              size_t beginPos,
-              char sep,
-              LLBC_String &left,
-              LLBC_String &right,
-              bool requireFoundSep = false);
+    int FindSeparator(const char *str,
+                      size_t len,
+                      size_t lineNum,
+                      size_t beginPos,
+                      char sep,
+                      size_t &sepPos,
+                      bool requireFoundSep = false);
 
 private:
     LLBC_String Escape(const LLBC_String &str) const;
-    int UnEscape(LLBC_String &str,
+    int UnEscape(const char *str,
+                 size_t len,
                  size_t lineNum,
                  size_t beginPos,
-                 size_t &unescapeTimes);
+                 LLBC_String &unescaped);
 
     static void EndLine(LLBC_String &str);
 
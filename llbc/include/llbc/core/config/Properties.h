@@ -90,8 +90,8 @@ private:
      * Parse property line.
      */
     static int ParseLine(int lineNo,
-                         const LLBC_String &line,
-                         LLBC_Strings &keyItems,
+                         const LLBC_CString &line,
+                         std::vector<LLBC_CString> &keyItems,
                          LLBC_String &value,
                          LLBC_String *errMsg);
 
@@ -106,12 +106,12 @@ private:
     /**
      * Check property key item.
      */
-    static bool CheckKeyItem(const LLBC_String &keyItem);
+    static bool CheckKeyItem(const LLBC_CString &keyItem);
 
     /**
      * Check property key items.
      */
-    static bool CheckKeyItems(const LLBC_Strings &keyItems);
+    static bool CheckKeyItems(const std::vector<LLBC_CString> &keyItems);
 
     /**
      * Escape property value.
@@ -121,7 +121,7 @@ private:
      * Unescape property value.
      */
     static int UnescapeValue(int lineNo,
-                             const LLBC_String &escapedValue,
+                             const LLBC_CString &escapedValue,
                              LLBC_String &rawValue,
                              LLBC_String *errMsg);
 };
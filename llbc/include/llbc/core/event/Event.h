@@ -27,6 +27,58 @@
 
 __LLBC_NS_BEGIN
 
+/**
+ * \brief The event param key encapsulation, pre-hashed string key.
+ *        Recommend define commonly used param keys as constexpr variables, to avoid key hashing in
+ *        each SetParam()/GetParam() call, eg:
+ *            static constexpr LLBC_EventParamKey damageKey("damage");
+ *            ev.SetParam(damageKey, 100);
+ */
+class LLBC_EventParamKey
+{
+public:
+    template <size_t _ArrLen>
+    constexpr LLBC_EventParamKey(const char (&key)[_ArrLen])
+    : LLBC_EventParamKey(key, _ArrLen > 0 ? _ArrLen - 1 : 0)
+    {
+    }
+
+    constexpr LLBC_EventParamKey(const char *key, size_t keyLen)
+    : _key(key)
+    , _keyLen(keyLen)
+    , _hash(Hash(key, keyLen))
+    {
+    }
+
+public:
+    /**
+     * Get key/key length/key hash.
+     */
+    constexpr const char *GetKey() const { return _key; }
+    constexpr size_t GetKeyLen() const { return _keyLen; }
+    constexpr uint32 GetHash() const { return _hash; }
+
+    /**
+     * Hash key(FNV-1a).
+     * @param[in] key    - the key.
+     * @param[in] keyLen - the key length.
+     * @return uint32 - the key hash.
+     */
+    static constexpr uint32 Hash(const char *key, size_t keyLen)
+    {
+        uint32 hash = 2166136261u;
+        for (size_t i = 0; i < keyLen; ++i)
+            hash = (hash ^ static_cast<uint8>(key[i])) * 16777619u;
+
+        return hash;
+    }
+
+private:
+    const char *_key;
+    size_t _keyLen;
+    uint32 _hash;
+};
+
 /**
  * \brief The event class encapsulation.
  */
@@ -68,11 +120,15 @@ public:
         (std::is_same_v<std::remove_extent_t<KeyType>, char> || \
          (std::is_pointer_v<KeyType> && std::is_same_v<std::remove_cv_t<std::remove_pointer_t<KeyType>>, char>) || \
          std::is_same_v<KeyType, LLBC_CString> || \
+         std::is_same_v<KeyType, LLBC_EventParamKey> || \
          LLBC_IsTemplSpec<KeyType, std::basic_string>::value \
         )
 
+#define __LLBC_Inl_EventIntKeyMatch \
+        ((std::is_integral_v<KeyType> && !std::is_same_v<KeyType, bool>) || std::is_enum_v<KeyType>)
+
     /**
-    * Get LLBC_Variant key indexed event param.
+    * Get string key indexed event param, if not found, add nil param.
     * @param[in] key - the key.
     * @return const LLBC_Variant & - the event param.
     */
@@ -81,26 +137,54 @@ public:
     GetParam(const KeyType &key);
 
     /**
-    * Get LLBC_CString key indexed event param.
+    * Get integer key indexed event param, if not found, add nil param.
+    * @param[in] key - the integer key.
+    * @return const LLBC_Variant & - the event param.
+    */
+    template<typename KeyType>
+    std::enable_if_t<__LLBC_Inl_EventIntKeyMatch, const LLBC_Variant &>
+    GetParam(const KeyType &key);
+
+    /**
+    * Set string key indexed event param.
+    * Note: char array/char pointer/LLBC_CString/LLBC_EventParamKey key will not be copied, make sure
+    *       the key lifetime longer than event, std::string key will be copied.
     * @param[in] key   - the key.
     * @param[in] param - the param.
-    * @return LLBC_Event & - this reference.
     */
     template<typename KeyType, typename ParamType>
     std::enable_if_t<__LLBC_Inl_EventKeyMatch, void>
     SetParam(const KeyType &key, const ParamType &param);
 
     /**
-     * Get all key indexed params.
-     * @return const std::map<LLBC_CString, LLBC_Variant> & - the LLBC_CString key indexed params const reference.
+    * Set integer key indexed event param.
+    * @param[in] key   - the integer key.
+    * @param[in] param - the param.
+    */
+    template<typename KeyType, typename ParamType>
+    std::enable_if_t<__LLBC_Inl_EventIntKeyMatch, void>
+    SetParam(const KeyType &key, const ParamType &param);
+
+    /**
+     * Get params count(include string key & integer key indexed params).
+     * @return size_t - the params count.
+     */
+    size_t GetParamsCount() const;
+
+    /**
+     * Get all string key indexed params.
+     * Note: The params are stored in flat storage, this view is built when called(if params changed),
+     *       avoid calling it in performance sensitive code.
+     * @return const std::map<LLBC_CString, LLBC_Variant> & - the string key indexed params view.
      */
     const std::map<LLBC_CString, LLBC_Variant> &GetParams() const;
 
     /**
-     * Get all key indexed params(mutable).
-     * @return std::map<LLBC_CString, LLBC_Variant> & - the LLBC_CString key indexed params mutable reference.
+     * Get all integer key indexed params.
+     * Note: Same as GetParams(), the view is built when called(if params changed).
+     * @return const std::map<int, LLBC_Variant> & - the integer key indexed params view.
      */
-    std::map<LLBC_CString, LLBC_Variant> &GetMutableParams();
+    const std::map<int, LLBC_Variant> &GetIntParams() const;
 
     /**
      * Get extend data.
@@ -142,11 +226,54 @@ public:
      */
     void Reuse();
 
+protected:
+    // The event param encapsulation.
+    struct _Param
+    {
+        LLBC_CString key; // String key, empty if is integer key indexed param.
+        uint32 keyHash; // String key hash, or integer key.
+        bool isIntKey; // Is integer key indexed param or not.
+        bool isHeavyKey; // Is heavy key(key memory owned by event) or not.
+        LLBC_Variant param; // Param.
+    };
+
+    // The params view encapsulation, build by GetParams()/GetIntParams().
+    struct _ParamsView
+    {
+        bool dirty = true;
+        std::map<LLBC_CString, LLBC_Variant> params;
+        std::map<int, LLBC_Variant> intParams;
+    };
+
+    // Find string key/integer key indexed param.
+    _Param *FindParam(const LLBC_CString &key, uint32 keyHash) const;
+    _Param *FindParam(int key) const;
+    // Add param(key not set), args used to construct param value.
+    template <typename... Args>
+    _Param &AddParam(Args &&... args);
+    // Set string key indexed param.
+    template <typename ParamType>
+    void SetParamInl(const LLBC_CString &key, uint32 keyHash, bool copyKey, const ParamType &param);
+    // Copy params from other event.
+    void CopyParams(const LLBC_Event &other);
+    // Move params from other event.
+    void MoveParams(LLBC_Event &other);
+    // Clear params.
+    void ClearParams();
+    // Mark params view dirty.
+    void MarkParamsViewDirty();
+    // Build params view, if dirty.
+    void BuildParamsView() const;
+
 protected:
     int _id;
     bool _dontDelAfterFire;
-    std::map<LLBC_CString, LLBC_Variant> _params;
-    std::map<LLBC_CString, std::string *> _heavyKeys;
+
+    _Param *_params; // Params, point to _inlineParams or heap memory.
+    uint32 _paramsCount; // Params count.
+    uint32 _paramsCap; // Params capacity.
+    alignas(_Param) uint8 _inlineParams[sizeof(_Param) * LLBC_CFG_CORE_EVENT_INLINE_PARAM_COUNT]; // Inline params.
+    mutable _ParamsView *_paramsView; // Params view.
 
     void *_extData;
     LLBC_Delegate<void(void *)> *_extDataClearDeleg;
@@ -33,39 +33,46 @@ inline LLBC_Event::LLBC_Event(int id, bool dontDelAfterFire)
 : _id(id)
 , _dontDelAfterFire(dontDelAfterFire)
 
+, _params(reinterpret_cast<_Param *>(_inlineParams))
+, _paramsCount(0)
+, _paramsCap(LLBC_CFG_CORE_EVENT_INLINE_PARAM_COUNT)
+, _paramsView(nullptr)
+
 , _extData(nullptr)
 , _extDataClearDeleg(nullptr)
 {
 
 }
 
-inline LLBC_Event::LLBC_Event(const LLBC_Event &other) : LLBC_PoolObj(other)
-{
-    _id = other._id;
-    _dontDelAfterFire = other._dontDelAfterFire;
+inline LLBC_Event::LLBC_Event(const LLBC_Event &other)
+: LLBC_PoolObj(other)
+, _id(other._id)
+, _dontDelAfterFire(other._dontDelAfterFire)
 
-    for (auto &[slimKey, param] : other._params)
-    {
-        if (auto heavyKeyIt = other._heavyKeys.find(slimKey); heavyKeyIt != other._heavyKeys.end())
-            SetParam(*heavyKeyIt->second, param);
-        else
-            SetParam(slimKey, param);
-    }
+, _params(reinterpret_cast<_Param *>(_inlineParams))
+, _paramsCount(0)
+, _paramsCap(LLBC_CFG_CORE_EVENT_INLINE_PARAM_COUNT)
+, _paramsView(nullptr)
 
-    _extData = nullptr;
-    _extDataClearDeleg = nullptr;
+, _extData(nullptr)
+, _extDataClearDeleg(nullptr)
+{
+    CopyParams(other);
 }
 
 inline LLBC_Event::LLBC_Event(LLBC_Event &&other) noexcept
-{
-    _id = other._id;
-    _dontDelAfterFire = other._dontDelAfterFire;
+: _id(other._id)
+, _dontDelAfterFire(other._dontDelAfterFire)
 
-    _params = std::move(other._params);
-    _heavyKeys = std::move(other._heavyKeys);
+, _params(reinterpret_cast<_Param *>(_inlineParams))
+, _paramsCount(0)
+, _paramsCap(LLBC_CFG_CORE_EVENT_INLINE_PARAM_COUNT)
+, _paramsView(nullptr)
 
-    _extData = other._extData;
-    _extDataClearDeleg = other._extDataClearDeleg;
+, _extData(other._extData)
+, _extDataClearDeleg(other._extDataClearDeleg)
+{
+    MoveParams(other);
 
     other._id = 0;
     other._dontDelAfterFire = false;
@@ -76,6 +83,12 @@ inline LLBC_Event::LLBC_Event(LLBC_Event &&other) noexcept
 inline LLBC_Event::~LLBC_Event()
 {
     ClearExtData(true);
+
+    ClearParams();
+    if (_params != reinterpret_cast<_Param *>(_inlineParams))
+        free(_params);
+
+    LLBC_XDelete(_paramsView);
 }
 
 inline int LLBC_Event::GetId() const
@@ -102,46 +115,100 @@ template<typename KeyType>
 std::enable_if_t<__LLBC_Inl_EventKeyMatch, const LLBC_Variant &>
 LLBC_Event::GetParam(const KeyType &key)
 {
-    auto it = _params.find(key);
-    return it != _params.end() ? it->second : _params.emplace(key, LLBC_Variant()).first->second;
+    MarkParamsViewDirty();
+
+    _Param *param;
+    if constexpr (std::is_same_v<KeyType, LLBC_EventParamKey>)
+    {
+        const LLBC_CString cstrKey(key.GetKey(), key.GetKeyLen());
+        if (LIKELY((param = FindParam(cstrKey, key.GetHash())) != nullptr))
+            return param->param;
+
+        SetParamInl(cstrKey, key.GetHash(), false, LLBC_Variant::nil);
+    }
+    else
+    {
+        const LLBC_CString cstrKey(key);
+        const uint32 keyHash = LLBC_EventParamKey::Hash(cstrKey.c_str(), cstrKey.size());
+        if (LIKELY((param = FindParam(cstrKey, keyHash)) != nullptr))
+            return param->param;
+
+        SetParamInl(cstrKey, keyHash, LLBC_IsTemplSpec<KeyType, std::basic_string>::value, LLBC_Variant::nil);
+    }
+
+    return _params[_paramsCount - 1].param;
+}
+
+template<typename KeyType>
+std::enable_if_t<__LLBC_Inl_EventIntKeyMatch, const LLBC_Variant &>
+LLBC_Event::GetParam(const KeyType &key)
+{
+    MarkParamsViewDirty();
+
+    _Param *param = FindParam(static_cast<int>(key));
+    if (LIKELY(param))
+        return param->param;
+
+    param = &AddParam();
+    param->keyHash = static_cast<uint32>(static_cast<int>(key));
+    param->isIntKey = true;
+
+    return param->param;
 }
 
 template<typename KeyType, typename ParamType>
 std::enable_if_t<__LLBC_Inl_EventKeyMatch, void>
 LLBC_Event::SetParam(const KeyType &key, const ParamType &param)
 {
-    auto paramIt = _params.find(key);
-    if (paramIt != _params.end())
-    {
-        paramIt->second = param;
-        return;
-    }
+    MarkParamsViewDirty();
 
-    if constexpr (LLBC_IsTemplSpec<KeyType, std::basic_string>::value)
+    if constexpr (std::is_same_v<KeyType, LLBC_EventParamKey>)
     {
-        auto heavyIt = _heavyKeys.find(key);
-        if (heavyIt == _heavyKeys.end())
-        {
-            auto heavyKey = new std::string(key);
-            heavyIt = _heavyKeys.emplace(heavyKey->c_str(), heavyKey).first;
-        }
-
-        _params.emplace(heavyIt->first, param);
+        SetParamInl(LLBC_CString(key.GetKey(), key.GetKeyLen()), key.GetHash(), false, param);
     }
     else
     {
-        _params.emplace(key, param);
+        const LLBC_CString cstrKey(key);
+        SetParamInl(cstrKey,
+                    LLBC_EventParamKey::Hash(cstrKey.c_str(), cstrKey.size()),
+                    LLBC_IsTemplSpec<KeyType, std::basic_string>::value,
+                    param);
+    }
+}
+
+template<typename KeyType, typename ParamType>
+std::enable_if_t<__LLBC_Inl_EventIntKeyMatch, void>
+LLBC_Event::SetParam(const KeyType &key, const ParamType &param)
+{
+    MarkParamsViewDirty();
+
+    _Param *existParam = FindParam(static_cast<int>(key));
+    if (existParam)
+    {
+        existParam->param = param;
+        return;
     }
+
+    _Param &newParam = AddParam(param);
+    newParam.keyHash = static_cast<uint32>(static_cast<int>(key));
+    newParam.isIntKey = true;
+}
+
+inline size_t LLBC_Event::GetParamsCount() const
+{
+    return _paramsCount;
 }
 
 inline const std::map<LLBC_CString, LLBC_Variant> &LLBC_Event::GetParams() const
 {
-    return _params;
+    BuildParamsView();
+    return _paramsView->params;
 }
 
-inline std::map<LLBC_CString, LLBC_Variant> &LLBC_Event::GetMutableParams()
+inline const std::map<int, LLBC_Variant> &LLBC_Event::GetIntParams() const
 {
-    return _params;
+    BuildParamsView();
+    return _paramsView->intParams;
 }
 
 inline void *LLBC_Event::GetExtData() const
@@ -184,7 +251,22 @@ LLBC_Variant &LLBC_Event::operator[](const KeyType &key)
 template<typename KeyType>
 const LLBC_Variant &LLBC_Event::operator[](const KeyType &key) const
 {
-    return GetParam(key);
+    _Param *param;
+    if constexpr (std::is_same_v<KeyType, LLBC_EventParamKey>)
+    {
+        param = FindParam(LLBC_CString(key.GetKey(), key.GetKeyLen()), key.GetHash());
+    }
+    else if constexpr (std::is_integral_v<KeyType> || std::is_enum_v<KeyType>)
+    {
+        param = FindParam(static_cast<int>(key));
+    }
+    else
+    {
+        const LLBC_CString cstrKey(key);
+        param = FindParam(cstrKey, LLBC_EventParamKey::Hash(cstrKey.c_str(), cstrKey.size()));
+    }
+
+    return param ? param->param : LLBC_INL_NS __nilVariant;
 }
 
 inline LLBC_Event &LLBC_Event::operator=(const LLBC_Event &other)
@@ -197,13 +279,7 @@ inline LLBC_Event &LLBC_Event::operator=(const LLBC_Event &other)
     _id = other._id;
     _dontDelAfterFire = other._dontDelAfterFire;
 
-    for (auto &[slimKey, param] : other._params)
-    {
-        if (auto heavyKeyIt = other._heavyKeys.find(slimKey); heavyKeyIt != other._heavyKeys.end())
-            SetParam(*heavyKeyIt->second, param);
-        else
-            SetParam(slimKey, param);
-    }
+    CopyParams(other);
 
     return *this;
 }
@@ -218,8 +294,7 @@ inline LLBC_Event &LLBC_Event::operator=(LLBC_Event &&other) noexcept
     _id = other._id;
     _dontDelAfterFire = other._dontDelAfterFire;
 
-    _params = std::move(other._params);
-    _heavyKeys = std::move(other._heavyKeys);
+    MoveParams(other);
 
     _extData = other._extData;
     _extDataClearDeleg = other._extDataClearDeleg;
@@ -236,14 +311,192 @@ inline void LLBC_Event::Reuse()
 {
     ClearExtData(true);
 
-    LLBC_STLHelper::DeleteContainer(_heavyKeys);
-    _params.clear();
+    ClearParams();
+    LLBC_XDelete(_paramsView);
 
     _dontDelAfterFire = false;
     _id = 0;
 }
 
+LLBC_FORCE_INLINE LLBC_Event::_Param *LLBC_Event::FindParam(const LLBC_CString &key, uint32 keyHash) const
+{
+    for (uint32 i = 0; i < _paramsCount; ++i)
+    {
+        _Param &param = _params[i];
+        if (param.keyHash == keyHash &&
+            !param.isIntKey &&
+            param.key.size() == key.size() &&
+            memcmp(param.key.c_str(), key.c_str(), key.size()) == 0)
+            return &param;
+    }
+
+    return nullptr;
+}
+
+LLBC_FORCE_INLINE LLBC_Event::_Param *LLBC_Event::FindParam(int key) const
+{
+    for (uint32 i = 0; i < _paramsCount; ++i)
+    {
+        _Param &param = _params[i];
+        if (param.keyHash == static_cast<uint32>(key) && param.isIntKey)
+            return &param;
+    }
+
+    return nullptr;
+}
+
+template <typename... Args>
+LLBC_FORCE_INLINE LLBC_Event::_Param &LLBC_Event::AddParam(Args &&... args)
+{
+    // Grow params, if full(move params to heap).
+    if (UNLIKELY(_paramsCount == _paramsCap))
+    {
+        const uint32 newCap = _paramsCap > 0 ? _paramsCap * 2 : 4;
+        auto newParams = LLBC_Malloc(_Param, sizeof(_Param) * newCap);
+        for (uint32 i = 0; i < _paramsCount; ++i)
+        {
+            new (&newParams[i]) _Param(std::move(_params[i]));
+            _params[i].~_Param();
+        }
+
+        if (_params != reinterpret_cast<_Param *>(_inlineParams))
+            free(_params);
+
+        _params = newParams;
+        _paramsCap = newCap;
+    }
+
+    return *new (&_params[_paramsCount++]) _Param{
+        LLBC_CString(), 0, false, false, LLBC_Variant(std::forward<Args>(args)...)};
+}
+
+template <typename ParamType>
+LLBC_FORCE_INLINE void LLBC_Event::SetParamInl(const LLBC_CString &key,
+                                               uint32 keyHash,
+                                               bool copyKey,
+                                               const ParamType &param)
+{
+    // Param exist, update it.
+    _Param *existParam = FindParam(key, keyHash);
+    if (existParam)
+    {
+        existParam->param = param;
+        return;
+    }
+
+    // Param not exist, add it.
+    _Param &newParam = AddParam(param);
+    newParam.keyHash = keyHash;
+    if (copyKey)
+    {
+        char *heavyKey = LLBC_Malloc(char, key.size() + 1);
+        memcpy(heavyKey, key.c_str(), key.size());
+        heavyKey[key.size()] = '\0';
+
+        newParam.key = LLBC_CString(heavyKey, key.size());
+        newParam.isHeavyKey = true;
+    }
+    else
+    {
+        newParam.key = key;
+    }
+}
+
+inline void LLBC_Event::CopyParams(const LLBC_Event &other)
+{
+    MarkParamsViewDirty();
+    for (uint32 i = 0; i < other._paramsCount; ++i)
+    {
+        const _Param &otherParam = other._params[i];
+        if (otherParam.isIntKey)
+            SetParam(static_cast<int>(otherParam.keyHash), otherParam.param);
+        else
+            SetParamInl(otherParam.key, otherParam.keyHash, otherParam.isHeavyKey, otherParam.param);
+    }
+}
+
+inline void LLBC_Event::MoveParams(LLBC_Event &other)
+{
+    MarkParamsViewDirty();
+    other.MarkParamsViewDirty();
+
+    // Other event params in heap, steal it.
+    if (other._params != reinterpret_cast<_Param *>(other._inlineParams))
+    {
+        ClearParams();
+        if (_params != reinterpret_cast<_Param *>(_inlineParams))
+            free(_params);
+
+        _params = other._params;
+        _paramsCount = other._paramsCount;
+        _paramsCap = other._paramsCap;
+
+        other._params = reinterpret_cast<_Param *>(other._inlineParams);
+        other._paramsCount = 0;
+        other._paramsCap = LLBC_CFG_CORE_EVENT_INLINE_PARAM_COUNT;
+
+        return;
+    }
+
+    // Other event params inline, move one by one(heavy keys owner transfer to this event).
+    for (uint32 i = 0; i < other._paramsCount; ++i)
+    {
+        _Param &otherParam = other._params[i];
+        _Param &newParam = AddParam(std::move(otherParam.param));
+        newParam.key = otherParam.key;
+        newParam.keyHash = otherParam.keyHash;
+        newParam.isIntKey = otherParam.isIntKey;
+        newParam.isHeavyKey = otherParam.isHeavyKey;
+
+        otherParam.isHeavyKey = false;
+    }
+
+    other.ClearParams();
+}
+
+inline void LLBC_Event::ClearParams()
+{
+    for (uint32 i = 0; i < _paramsCount; ++i)
+    {
+        _Param &param = _params[i];
+        if (param.isHeavyKey)
+            free(const_cast<char *>(param.key.c_str()));
+
+        param.~_Param();
+    }
+
+    _paramsCount = 0;
+}
+
+LLBC_FORCE_INLINE void LLBC_Event::MarkParamsViewDirty()
+{
+    if (UNLIKELY(_paramsView))
+        _paramsView->dirty = true;
+}
+
+inline void LLBC_Event::BuildParamsView() const
+{
+    if (!_paramsView)
+        _paramsView = new _ParamsView;
+    else if (!_paramsView->dirty)
+        return;
+
+    _paramsView->params.clear();
+    _paramsView->intParams.clear();
+    for (uint32 i = 0; i < _paramsCount; ++i)
+    {
+        const _Param &param = _params[i];
+        if (param.isIntKey)
+            _paramsView->intParams.emplace(static_cast<int>(param.keyHash), param.param);
+        else
+            _paramsView->params.emplace(param.key, param.param);
+    }
+
+    _paramsView->dirty = false;
+}
+
 #undef __LLBC_Inl_EventKeyMatch
+#undef __LLBC_Inl_EventIntKeyMatch
 
 __LLBC_NS_END
 
@@ -258,7 +511,13 @@ inline std::ostream &operator<<(std::ostream &o, const LLBC_NS LLBC_Event &ev)
     for (auto it = ev.GetParams().begin(); it != ev.GetParams().end(); ++it)
     {
         o << "[" << it->first << ":" << it->second.ToString() << "]"
-          << (std::next(it) != ev.GetParams().end() ? ", " : "");
+          << (std::next(it) != ev.GetParams().end() || !ev.GetIntParams().empty() ? ", " : "");
+    }
+
+    for (auto it = ev.GetIntParams().begin(); it != ev.GetIntParams().end(); ++it)
+    {
+        o << "[" << it->first << ":" << it->second.ToString() << "]"
+          << (std::next(it) != ev.GetIntParams().end() ? ", " : "");
     }
 
     o << "})";
@@ -168,12 +168,29 @@ protected:
     struct _ListenerInfo
     {
         int evId;
+        bool removed; // Removed in firing(tombstone), will compact after firing.
         LLBC_ListenerStub stub;
         LLBC_EventListener *listener;
         LLBC_Delegate<void(LLBC_Event &)> deleg;
 
         _ListenerInfo();
+        _ListenerInfo(_ListenerInfo &&other) noexcept;
         ~_ListenerInfo();
+
+        _ListenerInfo &operator=(_ListenerInfo &&other) noexcept;
+
+        LLBC_DISABLE_ASSIGNMENT(_ListenerInfo);
+    };
+
+    /**
+     * \brief The event listeners encapsulation(all listeners of one event id).
+     */
+    struct _EventListeners
+    {
+        std::vector<_ListenerInfo> infos; // Listener infos, ordered by add order.
+        uint32 tombstoneCount; // Removed in firing but not compacted listeners count.
+
+        _EventListeners();
     };
 
     /**
@@ -209,19 +226,29 @@ private:
     int AddListenerCheck(const LLBC_ListenerStub &boundStub, LLBC_ListenerStub &stub);
 
     // Add listener info to event manager.
-    int AddListenerInfo(_ListenerInfo *listenerInfo);
+    int AddListenerInfo(_ListenerInfo &listenerInfo);
 
-protected:
-    typedef std::list<_ListenerInfo *> _ListenerInfos; // listener info list.
+    // Find/Get(create if not found)/Delete event listeners.
+    _EventListeners *FindEventListeners(int id) const;
+    _EventListeners &GetEventListeners(int id);
+    void DeleteEventListeners(int id);
 
+    // Compact all tombstoned event listeners.
+    void CompactEventListeners();
+
+protected:
     int _firing; // Firing flag.
     #if LLBC_CFG_CORE_ENABLE_EVENT_FIRE_DEAD_LOOP_DETECTION 
     std::vector<int> _firingEventIds; // Firing event ids, used for event fire dead loop detection.
     #endif // LLBC_CFG_CORE_ENABLE_EVENT_FIRE_DEAD_LOOP_DETECTION 
     static sint64 _maxListenerStub; // Max listener stub.
 
-    std::map<int, _ListenerInfos> _id2ListenerInfos; // event id 2 listeners.
-    std::map<LLBC_ListenerStub, std::pair<int, _ListenerInfos::iterator> > _stub2ListenerInfos; // stub id 2 listeners.
+    // Event id 2 listeners, event id < LLBC_CFG_CORE_EVENT_DIRECT_INDEX_ID_LIMIT.
+    std::vector<_EventListeners *> _directEvListeners;
+    // Event id 2 listeners, event id >= LLBC_CFG_CORE_EVENT_DIRECT_INDEX_ID_LIMIT.
+    std::unordered_map<int, _EventListeners *> _sparseEvListeners;
+    // Stub 2 event id.
+    std::unordered_map<LLBC_ListenerStub, int> _stub2EvIds;
 
     // Pending operations when event firing.
     // All pending event operations(Add/Remove(by event id)/Remove(by listener stub).
@@ -230,8 +257,8 @@ protected:
     bool _pendingRemoveAllListeners;
     // Pending remove event ids, used for prevent event firing in event firing.
     std::set<int> _pendingRemoveEventIds_;
-    // Pending remove event stubs, used for prevent event firing in event firing.
-    std::set<LLBC_ListenerStub> _pendingRemoveStubs_;
+    // Tombstoned event ids(listener removed by stub in event firing), will compact after firing.
+    std::vector<int> _tombstonedEvIds;
 
     #if LLBC_CFG_CORE_ENABLE_EVENT_HOOK
     // Event hook manager object, object will create when use GetEventHookMgr.
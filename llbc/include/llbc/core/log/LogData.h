@@ -64,6 +64,13 @@ struct LLBC_EXPORT LLBC_LogData
 
     LLBC_ThreadId threadId; // Log native thread Id.
 
+    LLBC_LogData *next;     // Next log data, used by log runnable log data queue.
+
+    const char *fmt;        // Deferred format control string, if not null, msg not formatted yet.
+    char *fmtArgs;          // Deferred format arguments(type tagged binary record).
+    int fmtArgsLen;         // Deferred format arguments length.
+    int fmtArgsCap;         // Deferred format arguments capacity.
+
 public:
     /**
      * Constructor & Destructor.
@@ -71,6 +78,23 @@ public:
     LLBC_LogData();
     ~LLBC_LogData();
 
+public:
+    /**
+     * Capture format control string and arguments, message will be formatted later by
+     * calling FormatDeferredMsg() method.
+     * Note: Format control string must be keep valid until message formatted, and
+     *       %n/wide char/wide string conversions are not supported.
+     * @param[in] fmt - the format control string.
+     * @param[in] va  - the format arguments.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int CaptureFmtArgs(const char *fmt, va_list va);
+
+    /**
+     * Format deferred message, if message not formatted yet.
+     */
+    void FormatDeferredMsg();
+
 public:
     /**
      * Object pool support methods.
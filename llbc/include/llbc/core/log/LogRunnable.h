@@ -22,7 +22,7 @@
 #pragma once
 
 #include "llbc/core/thread/Task.h"
-#include "llbc/core/thread/SpinLock.h"
+#include "llbc/core/thread/Semaphore.h"
 
 __LLBC_NS_BEGIN
 
@@ -69,7 +69,7 @@ public:
     void Stop();
 
     /**
-     * Push log data.
+     * Push log data(lock-free, thread-safe).
      * @param[in] logData - the log data.
      */
     void PushLogData(LLBC_LogData *logData);
@@ -92,6 +92,11 @@ private:
      */
     bool TryPopAndProcLogDatas();
 
+    /**
+     * Wait for log data pushed, or wait timeout(LLBC_CFG_LOG_RUNNABLE_IDLE_WAIT_TIME).
+     */
+    void WaitLogDatas();
+
     /**
      * Flush all loggers.
      * @param[in] force - force or not.
@@ -104,8 +109,13 @@ private:
     std::vector<LLBC_Logger *> _loggers;
     const LLBC_LogTimeAccessor *_logTimeAccessor;
 
-    LLBC_SpinLock _logDataLock;
-    std::vector<LLBC_LogData *> _logDatas[2];
+    // Lock-free log data queue(multi-producer, single-consumer):
+    // producers push log data to list head, log thread pop all log datas and reverse to FIFO order.
+    LLBC_LogData * volatile _logDataHead;
+
+    // Log thread waiting flag && wakeup semaphore.
+    volatile sint32 _waiting;
+    LLBC_Semaphore _waitSem;
 };
 
 __LLBC_NS_END
@@ -405,6 +405,26 @@ private:
                                const char *fmt,
                                va_list va);
 
+    /**
+     * Build deferred format log data, only capture format arguments, message will be formatted
+     * in log runnable.
+     * @param[in] level - log level.
+     * @param[in] tag   - log tag.
+     * @param[in] file  - log file name.
+     * @param[in] line  - log file line.
+     * @param[in] func  - log function.
+     * @param[in] fmt   - log format control string.
+     * @param[in] va    - the message variable parameter list.
+     * @return LLBC_LogData * - the log data, return nullptr if format arguments capture failed.
+     */
+    LLBC_LogData *BuildDeferredLogData(int level,
+                                       const char *tag,
+                                       const char *file,
+                                       int line,
+                                       const char *func,
+                                       const char *fmt,
+                                       va_list va);
+
     /**
      * Build log data by msg and length.
      * @param[in] level  - log level.
@@ -112,6 +112,12 @@ public:
      */
     bool IsIndependentThread() const;
 
+    /**
+     * Get deferred format switch, only available in Async-Mode.
+     * @return bool - deferred format switch.
+     */
+    bool IsDeferredFormat() const;
+
     /**
      * Get file refresh interval.
      * @return int - the file refresh interval.
@@ -285,6 +291,7 @@ private:
 
     bool _asyncMode;
     bool _independentThread;
+    bool _deferredFormat;
     int _flushInterval;
 
     bool _addTimestampInJsonLog;
@@ -58,6 +58,11 @@ inline bool LLBC_LoggerConfigInfo::IsIndependentThread() const
     return _independentThread;
 }
 
+inline bool LLBC_LoggerConfigInfo::IsDeferredFormat() const
+{
+    return _deferredFormat;
+}
+
 inline int LLBC_LoggerConfigInfo::GetFlushInterval() const
 {
     return _flushInterval;
@@ -33,6 +33,11 @@ LLBC_FORCE_INLINE int LLBC_Logger::GetLogLevel() const
     return _logLevel;
 }
 
+LLBC_FORCE_INLINE bool LLBC_Logger::GetColorLogTag() const
+{
+    return LIKELY(_logTraceMgr) ? _logTraceMgr->GetColorLogTag() : false;
+}
+
 LLBC_FORCE_INLINE
 const LLBC_LogTimeAccessor &LLBC_Logger::GetLogTimeAccessor() const
 {
@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include "llbc/core/os/OS_Atomic.h"
+
 #include "llbc/core/singleton/Singleton.h"
 
 #include "llbc/core/thread/Guard.h"
@@ -98,6 +100,13 @@ public:
      */
     LLBC_Logger *GetLogger(const LLBC_CString &name) const;
 
+    /**
+     * Get logger generation, generation will be changed when logger manager
+     * initialized/reloaded/finalized, use to invalidate cached logger handles.
+     * @return sint32 - the logger generation.
+     */
+    sint32 GetGeneration() const;
+
     /**
      * Uninit output.
      * @param[in] logLv - the log level.
@@ -149,6 +158,7 @@ private:
     LLBC_LogRunnable *_sharedLogRunnable;
 
     LLBC_Logger * volatile _rootLogger;
+    volatile sint32 _generation;
     std::map<LLBC_CString, LLBC_Logger *> _cstr2Loggers;
     std::vector<std::pair<LLBC_CString, LLBC_Logger *> > _loggerList;
     std::map<LLBC_CString, LLBC_Logger *>::const_iterator _cstr2LoggersEnd;
@@ -164,6 +174,46 @@ __LLBC_NS_END
 template class LLBC_EXPORT LLBC_NS LLBC_Singleton<LLBC_NS LLBC_LoggerMgr>;
 #define LLBC_LoggerMgrSingleton LLBC_NS LLBC_Singleton<LLBC_NS LLBC_LoggerMgr>::Instance()
 
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The cached logger handle, use to cache logger lookup result in log call site.
+ *        Only string literal logger name lookup result will be cached, cached logger will be
+ *        invalidated when logger manager generation changed.
+ */
+class LLBC_LoggerHandle
+{
+public:
+    constexpr LLBC_LoggerHandle();
+
+public:
+    /**
+     * Get logger by string literal logger name(lookup result will be cached).
+     * @param[in] loggerMgr  - the logger manager.
+     * @param[in] loggerName - the logger name.
+     * @return LLBC_Logger * - the logger.
+     */
+    template <size_t _NameLen>
+    LLBC_Logger *GetLogger(LLBC_LoggerMgr *loggerMgr, const char (&loggerName)[_NameLen]);
+
+    /**
+     * Get logger by non-literal logger name(lookup result will not be cached).
+     * @param[in] loggerMgr  - the logger manager.
+     * @param[in] loggerName - the logger name.
+     * @return LLBC_Logger * - the logger.
+     */
+    template <size_t _NameLen>
+    LLBC_Logger *GetLogger(LLBC_LoggerMgr *loggerMgr, char (&loggerName)[_NameLen]);
+    template <typename _LoggerNameTy>
+    LLBC_Logger *GetLogger(LLBC_LoggerMgr *loggerMgr, const _LoggerNameTy &loggerName);
+
+private:
+    LLBC_Logger * volatile _logger;
+    volatile sint32 _generation;
+};
+
+__LLBC_NS_END
+
 /**
  * @brief The llbc library log macro define.
  * @param[in] loggerName - the logger name, nullptr if log to root.
@@ -178,7 +228,8 @@ template class LLBC_EXPORT LLBC_NS LLBC_Singleton<LLBC_NS LLBC_LoggerMgr>;
         if (LIKELY(__loggerMgr__->IsInited())) {                            \
             LLBC_NS LLBC_Logger *__l__;                                     \
             if (loggerName != nullptr) {                                    \
-                __l__ = __loggerMgr__->GetLogger(loggerName);               \
+                static LLBC_NS LLBC_LoggerHandle __lh__;                    \
+                __l__ = __lh__.GetLogger(__loggerMgr__, loggerName);        \
                 if (UNLIKELY(__l__ == nullptr))                             \
                     break;                                                  \
             }                                                               \
@@ -325,7 +376,8 @@ template class LLBC_EXPORT LLBC_NS LLBC_Singleton<LLBC_NS LLBC_LoggerMgr>;
         if (LIKELY(__loggerMgr__->IsInited())) {               \
             LLBC_NS LLBC_Logger *__l__;                        \
             if (loggerName != nullptr) {                       \
-                __l__ = __loggerMgr__->GetLogger(loggerName);  \
+                static LLBC_NS LLBC_LoggerHandle __lh__;       \
+                __l__ = __lh__.GetLogger(__loggerMgr__, loggerName); \
                 if (UNLIKELY(__l__ == nullptr))                \
                     break;                                     \
             }                                                  \
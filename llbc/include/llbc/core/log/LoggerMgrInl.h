@@ -28,9 +28,51 @@ inline bool LLBC_LoggerMgr::IsInited() const
     return _rootLogger != nullptr;
 }
 
+inline sint32 LLBC_LoggerMgr::GetGeneration() const
+{
+    return _generation;
+}
+
 inline const LLBC_LogTimeAccessor &LLBC_LoggerMgr::GetLogTimeAccessor() const
 {
     return _logTimeAccessor;
 }
 
+constexpr LLBC_LoggerHandle::LLBC_LoggerHandle()
+: _logger(nullptr)
+, _generation(0)
+{
+}
+
+template <size_t _NameLen>
+LLBC_FORCE_INLINE LLBC_Logger *LLBC_LoggerHandle::GetLogger(LLBC_LoggerMgr *loggerMgr,
+                                                            const char (&loggerName)[_NameLen])
+{
+    // Hit cache, return cached logger.
+    const sint32 generation = loggerMgr->GetGeneration();
+    if (LIKELY(_generation == generation))
+        return _logger;
+
+    // Lookup logger and update cache(generation updated after logger).
+    LLBC_Logger *logger = loggerMgr->GetLogger(loggerName);
+    _logger = logger;
+    (void)LLBC_AtomicCompareAndExchange(&_generation, generation, _generation);
+
+    return logger;
+}
+
+template <size_t _NameLen>
+LLBC_FORCE_INLINE LLBC_Logger *LLBC_LoggerHandle::GetLogger(LLBC_LoggerMgr *loggerMgr,
+                                                            char (&loggerName)[_NameLen])
+{
+    return loggerMgr->GetLogger(loggerName);
+}
+
+template <typename _LoggerNameTy>
+LLBC_FORCE_INLINE LLBC_Logger *LLBC_LoggerHandle::GetLogger(LLBC_LoggerMgr *loggerMgr,
+                                                            const _LoggerNameTy &loggerName)
+{
+    return loggerMgr->GetLogger(loggerName);
+}
+
 __LLBC_NS_END
@@ -614,7 +614,8 @@ class LLBC_TypedObjPool final
             {
                 bool constructed:1; // Constructed flag.
                 bool inUsing:1; // Using flag.
-                uint8 reserved:6; // Reserved flags.
+                bool cached:1; // Cached flag(in thread cache magazine or depot).
+                uint8 reserved:5; // Reserved flags.
             } flags;
             uint8 flagsVal;
         }unFlags;
@@ -659,6 +660,39 @@ class LLBC_TypedObjPool final
     };
     #pragma pack(pop)
 
+    #if LLBC_CFG_CORE_OBJPOOL_MAGAZINE_SIZE > 0
+    // The magazine structure encapsulation, a bounded free objects stack.
+    struct _Magazine
+    {
+        int count; // Object count.
+        _Magazine *next; // Next magazine, if in depot.
+
+        _WrappedObj *objs[LLBC_CFG_CORE_OBJPOOL_MAGAZINE_SIZE]; // Objects.
+    };
+
+    // The thread cache structure encapsulation, only accessed by owner thread(except statistics).
+    struct _ThreadCache
+    {
+        _Magazine *loaded; // Loaded magazine.
+        _Magazine *prev; // Previous loaded magazine.
+
+        uint64 acquireHits; // Acquire from loaded/previous magazine count.
+        uint64 acquireExchanges; // Acquire after exchanged full magazine from depot count.
+        uint64 acquireMisses; // Acquire from stripes count.
+        uint64 releaseHits; // Release to loaded/previous magazine count.
+        uint64 releaseExchanges; // Release after exchanged empty magazine from depot count.
+    };
+
+    // The thread caches structure encapsulation, indexed by thread index.
+    struct _ThreadCaches
+    {
+        int cap; // Thread caches capacity.
+        _ThreadCaches *prev; // Previous(retired) thread caches, delete when typed object pool destruct.
+
+        _ThreadCache * volatile caches[0]; // Thread caches.
+    };
+    #endif // LLBC_CFG_CORE_OBJPOOL_MAGAZINE_SIZE > 0
+
 private:
     friend class LLBC_ObjPool;
 
@@ -699,6 +733,24 @@ private:
     // Delete stripe.
     void DeleteStripe(_ObjStripe *stripe);
 
+    // Make object flags value.
+    static uint8 MakeObjFlagsVal(bool constructed, bool inUsing, bool cached);
+
+    #if LLBC_CFG_CORE_OBJPOOL_MAGAZINE_SIZE > 0
+    // Get current thread cache(create if not exist).
+    _ThreadCache *GetThreadCache();
+    // Create current thread cache.
+    _ThreadCache *CreateThreadCache(int threadIndex);
+    // Acquire from current thread cache, return nullptr if thread cache & depot are empty.
+    _WrappedObj *AcquireFromThreadCache();
+    // Release to current thread cache.
+    void ReleaseToThreadCache(_WrappedObj *wrappedObj);
+    // Flush magazine objects to stripes, must be called in typed object pool locked.
+    void FlushMagazine(_Magazine *magazine);
+    // Delete all thread caches & depot magazines.
+    void DeleteThreadCaches();
+    #endif // LLBC_CFG_CORE_OBJPOOL_MAGAZINE_SIZE > 0
+
     // Get statistics.
     LLBC_Json::Value GetStatistics(LLBC_Json::MemoryPoolAllocator<> &jsonAlloc) const;
 
@@ -714,6 +766,15 @@ private:
     size_t _usingObjCount; // Using object count.
     int _reusableObjCount; // Reusable object count.
 
+    #if LLBC_CFG_CORE_OBJPOOL_MAGAZINE_SIZE > 0
+    _ThreadCaches * volatile _threadCaches; // Thread caches, indexed by thread index.
+    _Magazine *_depotFullMagazines; // Depot full magazines.
+    _Magazine *_depotEmptyMagazines; // Depot empty magazines.
+    size_t _depotFullMagazineCount; // Depot full magazine count.
+    size_t _depotEmptyMagazineCount; // Depot empty magazine count.
+    uint64 _flushedObjCount; // Flushed from magazines to stripes object count.
+    #endif // LLBC_CFG_CORE_OBJPOOL_MAGAZINE_SIZE > 0
+
     static constexpr size_t _objOffset = offsetof(_WrappedObj, buff); // Object offset in _WrappedObj.
 };
 
@@ -812,6 +873,9 @@ public:
     void SetName(const LLBC_CString &poolName);
 
 private:
+    template <typename Obj>
+    friend class LLBC_TypedObjPool;
+
     // The wrapped TypedObjPool structure encapsulation.
     struct _WrappedTypedObjPool
     {
@@ -824,6 +888,40 @@ private:
         uint8 typedObjPool[0];
     };
 
+    // The typed object pool slots structure encapsulation, indexed by object type index.
+    struct _TypedObjPoolSlots
+    {
+        int cap; // Slots capacity.
+        _TypedObjPoolSlots *prev; // Previous(retired) slots, delete when object pool destruct.
+
+        _WrappedTypedObjPool * volatile slots[0]; // Slots.
+    };
+
+    /**
+     * Get object type index, process-wide dense index, allocated at first use.
+     * @param[in] rttiName - the object rtti name.
+     * @return int - the object type index.
+     */
+    static int GetTypeIndex(const char *rttiName);
+
+    /**
+     * Get current thread index, process-wide dense index, recycled when thread exit.
+     * @return int - the current thread index.
+     */
+    static int GetThreadIndex();
+
+    /**
+     * Set typed object pool slot, must be called in object pool locked.
+     * @param[in] typeIndex           - the object type index.
+     * @param[in] wrappedTypedObjPool - the wrapped typed object pool.
+     */
+    void SetTypedObjPoolSlot(int typeIndex, _WrappedTypedObjPool *wrappedTypedObjPool);
+
+    /**
+     * Delete all typed object pool slots(include retired slots).
+     */
+    void DelTypedObjPoolSlots();
+
     /**
      * Delete typed object pool.
      * @param[in] wrappedTypedObjPool - the wrapped typed object pool.
@@ -885,6 +983,8 @@ private:
 
     // Typed object pools.
     std::map<LLBC_CString, _WrappedTypedObjPool *> _typedObjPools;
+    // Typed object pool slots, indexed by object type index.
+    _TypedObjPoolSlots * volatile _typedObjPoolSlots;
 
     // Ordered delete nodes & node tree.
     std::map<LLBC_CString, _OrderedDeleteNode *> *_orderedDeleteNodes;
@@ -22,6 +22,7 @@
 #pragma once
 
 #include "llbc/core/thread/Guard.h"
+#include "llbc/core/os/OS_Atomic.h"
 #include "llbc/core/os/OS_Thread.h"
 
 // The object pool lock operation macros define.
@@ -140,6 +141,15 @@ LLBC_TypedObjPool<Obj>::LLBC_TypedObjPool(LLBC_ObjPool *objPool, bool threadSafe
 
 , _usingObjCount(0)
 , _reusableObjCount(0)
+
+#if LLBC_CFG_CORE_OBJPOOL_MAGAZINE_SIZE > 0
+, _threadCaches(nullptr)
+, _depotFullMagazines(nullptr)
+, _depotEmptyMagazines(nullptr)
+, _depotFullMagazineCount(0)
+, _depotEmptyMagazineCount(0)
+, _flushedObjCount(0)
+#endif // LLBC_CFG_CORE_OBJPOOL_MAGAZINE_SIZE > 0
 {
     // Init lock.
     __LLBC_INL_InitObjPoolLock();
@@ -152,6 +162,11 @@ LLBC_TypedObjPool<Obj>::~LLBC_TypedObjPool()
     __LLBC_INL_LockObjPool();
     for (auto &stripe : _stripes)
         DeleteStripe(stripe);
+
+    // Delete all thread caches & depot magazines.
+    #if LLBC_CFG_CORE_OBJPOOL_MAGAZINE_SIZE > 0
+    DeleteThreadCaches();
+    #endif // LLBC_CFG_CORE_OBJPOOL_MAGAZINE_SIZE > 0
     __LLBC_INL_UnlockObjPool();
 
     // Destroy lock.
@@ -166,6 +181,24 @@ Obj *LLBC_TypedObjPool<Obj>::Acquire()
     #else // Don't use malloc instead.
     _WrappedObj *wrappedObj;
 
+    // Thread safe typed object pool: Try acquire from thread cache first.
+    #if LLBC_CFG_CORE_OBJPOOL_MAGAZINE_SIZE > 0
+    if (_threadSafe && (wrappedObj = AcquireFromThreadCache()) != nullptr)
+    {
+        // Construct _Obj, if required.
+        if (!wrappedObj->unFlags.flags.constructed)
+        {
+            LLBC_ObjReflector::New<Obj>(wrappedObj->buff);
+            LLBC_ObjReflector::SetTypedObjPool<Obj>(wrappedObj->buff, this);
+        }
+
+        // Mask obj in using(clear cached flag, single store).
+        wrappedObj->unFlags.flagsVal = MakeObjFlagsVal(true, true, false);
+
+        return reinterpret_cast<Obj *>(wrappedObj->buff);
+    }
+    #endif // LLBC_CFG_CORE_OBJPOOL_MAGAZINE_SIZE > 0
+
     // Lock & Find _WrappedObj.
     __LLBC_INL_LockObjPool();
     auto stripe = FindFreeStripe();
@@ -234,19 +267,27 @@ void LLBC_TypedObjPool<Obj>::Release(Obj *obj)
     llbc_assert(wrappedObj->magicNum == LLBC_CFG_CORE_OBJPOOL_OBJ_MAGIC_NUMBER &&
                 "The object is not a objpool object");
 
-    // Reuse/Delete obj & lock typed objpool.
+    // Reuse/Delete obj.
     if constexpr (LLBC_ObjReflector::IsReusable<Obj>())
-    {
         LLBC_ObjReflector::Reuse<Obj>(wrappedObj->buff);
-        __LLBC_INL_LockObjPool();
-    }
     else
-    {
         LLBC_ObjReflector::Delete<Obj>(wrappedObj->buff);
 
-        __LLBC_INL_LockObjPool();
-        wrappedObj->unFlags.flags.constructed = false;
+    // Thread safe typed object pool: Release to thread cache.
+    #if LLBC_CFG_CORE_OBJPOOL_MAGAZINE_SIZE > 0
+    if (_threadSafe)
+    {
+        wrappedObj->unFlags.flagsVal = MakeObjFlagsVal(LLBC_ObjReflector::IsReusable<Obj>(), false, true);
+        ReleaseToThreadCache(wrappedObj);
+
+        return;
     }
+    #endif // LLBC_CFG_CORE_OBJPOOL_MAGAZINE_SIZE > 0
+
+    // Lock typed objpool.
+    __LLBC_INL_LockObjPool();
+    if constexpr (!LLBC_ObjReflector::IsReusable<Obj>())
+        wrappedObj->unFlags.flags.constructed = false;
     wrappedObj->unFlags.flags.inUsing = false;
 
     // Get stripe.
@@ -283,6 +324,47 @@ void LLBC_TypedObjPool<Obj>::Collect(bool deep)
     __LLBC_INL_LockObjPool();
     LLBC_Defer(__LLBC_INL_UnlockObjPool());
 
+    // Flush current thread cache & depot full magazines to stripes(other threads caches keep cached).
+    #if LLBC_CFG_CORE_OBJPOOL_MAGAZINE_SIZE > 0
+    const _ThreadCaches *threadCaches = _threadCaches;
+    const int threadIndex = LLBC_ObjPool::GetThreadIndex();
+    if (threadCaches && threadIndex < threadCaches->cap && threadCaches->caches[threadIndex])
+    {
+        _ThreadCache *threadCache = threadCaches->caches[threadIndex];
+        FlushMagazine(threadCache->loaded);
+        FlushMagazine(threadCache->prev);
+    }
+
+    while (_depotFullMagazines)
+    {
+        _Magazine *magazine = _depotFullMagazines;
+        _depotFullMagazines = magazine->next;
+        --_depotFullMagazineCount;
+
+        FlushMagazine(magazine);
+        if (deep)
+        {
+            free(magazine);
+        }
+        else
+        {
+            magazine->next = _depotEmptyMagazines;
+            _depotEmptyMagazines = magazine;
+            ++_depotEmptyMagazineCount;
+        }
+    }
+
+    // Deep collect: Delete depot empty magazines.
+    while (deep && _depotEmptyMagazines)
+    {
+        _Magazine *magazine = _depotEmptyMagazines;
+        _depotEmptyMagazines = magazine->next;
+        --_depotEmptyMagazineCount;
+
+        free(magazine);
+    }
+    #endif // LLBC_CFG_CORE_OBJPOOL_MAGAZINE_SIZE > 0
+
     // Destruct unused objs.
     std::vector<size_t> delayedDelStripeIndexes;
     for (size_t stripeIdx = 0; stripeIdx < _stripes.size(); ++stripeIdx)
@@ -291,8 +373,10 @@ void LLBC_TypedObjPool<Obj>::Collect(bool deep)
         auto &stripe = _stripes[stripeIdx];
         for (uint16 objIdx = 0; objIdx < stripe->used; ++objIdx)
         {
+            // Note: Thread cached objects flags maybe changed by owner thread, copy flags first.
             auto wrappedObj = &stripe->objs[objIdx];
-            if (wrappedObj->unFlags.flags.inUsing)
+            const auto unFlags = wrappedObj->unFlags;
+            if (unFlags.flags.inUsing || unFlags.flags.cached)
             {
                 hasUsingObjs = true;
                 continue;
@@ -421,12 +505,284 @@ void LLBC_TypedObjPool<Obj>::DeleteStripe(_ObjStripe *stripe)
     free(stripe);
 }
 
+template <typename Obj>
+LLBC_FORCE_INLINE uint8 LLBC_TypedObjPool<Obj>::MakeObjFlagsVal(bool constructed, bool inUsing, bool cached)
+{
+    decltype(_WrappedObj::unFlags) unFlags;
+    unFlags.flagsVal = 0;
+    unFlags.flags.constructed = constructed;
+    unFlags.flags.inUsing = inUsing;
+    unFlags.flags.cached = cached;
+
+    return unFlags.flagsVal;
+}
+
+#if LLBC_CFG_CORE_OBJPOOL_MAGAZINE_SIZE > 0
+template <typename Obj>
+LLBC_FORCE_INLINE typename LLBC_TypedObjPool<Obj>::_ThreadCache *LLBC_TypedObjPool<Obj>::GetThreadCache()
+{
+    // Find thread cache(lock free).
+    const int threadIndex = LLBC_ObjPool::GetThreadIndex();
+    const _ThreadCaches *threadCaches = _threadCaches;
+    if (LIKELY(threadCaches && threadIndex < threadCaches->cap))
+    {
+        _ThreadCache *threadCache = threadCaches->caches[threadIndex];
+        if (LIKELY(threadCache))
+            return threadCache;
+    }
+
+    // Not found, create it.
+    return CreateThreadCache(threadIndex);
+}
+
+template <typename Obj>
+typename LLBC_TypedObjPool<Obj>::_ThreadCache *LLBC_TypedObjPool<Obj>::CreateThreadCache(int threadIndex)
+{
+    // Create thread cache, with 2 empty magazines.
+    auto threadCache = LLBC_Calloc(_ThreadCache, sizeof(_ThreadCache));
+    threadCache->loaded = LLBC_Calloc(_Magazine, sizeof(_Magazine));
+    threadCache->prev = LLBC_Calloc(_Magazine, sizeof(_Magazine));
+
+    __LLBC_INL_LockObjPool();
+
+    // Grow thread caches, if required(old thread caches retired, keep readable for lock free readers).
+    _ThreadCaches *threadCaches = _threadCaches;
+    if (!threadCaches || threadIndex >= threadCaches->cap)
+    {
+        const int newCap = MAX(threadIndex + 1, threadCaches ? threadCaches->cap * 2 : 16);
+        auto newThreadCaches = LLBC_Malloc(_ThreadCaches,
+                                           sizeof(_ThreadCaches) + sizeof(_ThreadCache *) * newCap);
+        newThreadCaches->cap = newCap;
+        newThreadCaches->prev = threadCaches;
+        for (int i = 0; i < newCap; ++i)
+            newThreadCaches->caches[i] = threadCaches && i < threadCaches->cap ? threadCaches->caches[i] : nullptr;
+
+        (void)LLBC_AtomicCompareAndExchange(&_threadCaches, newThreadCaches, threadCaches);
+        threadCaches = newThreadCaches;
+    }
+
+    // Publish thread cache.
+    (void)LLBC_AtomicCompareAndExchange(
+        &threadCaches->caches[threadIndex], threadCache, static_cast<_ThreadCache *>(nullptr));
+
+    __LLBC_INL_UnlockObjPool();
+
+    return threadCache;
+}
+
+template <typename Obj>
+LLBC_FORCE_INLINE
+typename LLBC_TypedObjPool<Obj>::_WrappedObj *LLBC_TypedObjPool<Obj>::AcquireFromThreadCache()
+{
+    _ThreadCache *threadCache = GetThreadCache();
+
+    // Acquire from loaded magazine.
+    _Magazine *loaded = threadCache->loaded;
+    if (LIKELY(loaded->count > 0))
+    {
+        ++threadCache->acquireHits;
+        return loaded->objs[--loaded->count];
+    }
+
+    // Acquire from previous magazine(swap loaded & previous).
+    _Magazine *prev = threadCache->prev;
+    if (prev->count > 0)
+    {
+        threadCache->loaded = prev;
+        threadCache->prev = loaded;
+
+        ++threadCache->acquireHits;
+        return prev->objs[--prev->count];
+    }
+
+    // Both magazines are empty, exchange full magazine from depot.
+    __LLBC_INL_LockObjPool();
+    _Magazine *full = _depotFullMagazines;
+    if (!full)
+    {
+        __LLBC_INL_UnlockObjPool();
+
+        ++threadCache->acquireMisses;
+        return nullptr;
+    }
+
+    _depotFullMagazines = full->next;
+    --_depotFullMagazineCount;
+
+    prev->next = _depotEmptyMagazines;
+    _depotEmptyMagazines = prev;
+    ++_depotEmptyMagazineCount;
+    __LLBC_INL_UnlockObjPool();
+
+    threadCache->prev = loaded;
+    threadCache->loaded = full;
+
+    ++threadCache->acquireExchanges;
+    return full->objs[--full->count];
+}
+
+template <typename Obj>
+LLBC_FORCE_INLINE void LLBC_TypedObjPool<Obj>::ReleaseToThreadCache(_WrappedObj *wrappedObj)
+{
+    _ThreadCache *threadCache = GetThreadCache();
+
+    // Release to loaded magazine.
+    _Magazine *loaded = threadCache->loaded;
+    if (LIKELY(loaded->count < LLBC_CFG_CORE_OBJPOOL_MAGAZINE_SIZE))
+    {
+        loaded->objs[loaded->count++] = wrappedObj;
+        ++threadCache->releaseHits;
+        return;
+    }
+
+    // Release to previous magazine(swap loaded & previous).
+    _Magazine *prev = threadCache->prev;
+    if (prev->count == 0)
+    {
+        threadCache->loaded = prev;
+        threadCache->prev = loaded;
+
+        prev->objs[prev->count++] = wrappedObj;
+        ++threadCache->releaseHits;
+        return;
+    }
+
+    // Both magazines are full, return previous magazine to depot & exchange empty magazine.
+    __LLBC_INL_LockObjPool();
+    prev->next = _depotFullMagazines;
+    _depotFullMagazines = prev;
+    ++_depotFullMagazineCount;
+
+    _Magazine *empty = _depotEmptyMagazines;
+    if (empty)
+    {
+        _depotEmptyMagazines = empty->next;
+        --_depotEmptyMagazineCount;
+    }
+    __LLBC_INL_UnlockObjPool();
+
+    if (!empty)
+        empty = LLBC_Calloc(_Magazine, sizeof(_Magazine));
+
+    threadCache->prev = loaded;
+    threadCache->loaded = empty;
+
+    empty->objs[empty->count++] = wrappedObj;
+    ++threadCache->releaseExchanges;
+}
+
+template <typename Obj>
+void LLBC_TypedObjPool<Obj>::FlushMagazine(_Magazine *magazine)
+{
+    for (int i = 0; i < magazine->count; ++i)
+    {
+        // Clear cached flag.
+        _WrappedObj *wrappedObj = magazine->objs[i];
+        wrappedObj->unFlags.flags.cached = false;
+        if (wrappedObj->unFlags.flags.constructed)
+            ++_reusableObjCount;
+
+        // Link to stripe->freeObjs.
+        auto stripe = wrappedObj->stripeOrNextFreeObj.stripe;
+        const auto stripeIsFull = (stripe->used == stripe->cap && !stripe->freeObjs);
+        wrappedObj->stripeOrNextFreeObj.nextFreeObj = stripe->freeObjs;
+        stripe->freeObjs = wrappedObj;
+
+        // If stripe is full before flush obj, add to _freeStripes.
+        if (UNLIKELY(stripeIsFull))
+        {
+            stripe->nextFreeStripe = _freeStripes;
+            _freeStripes = stripe;
+        }
+    }
+
+    _usingObjCount -= magazine->count;
+    _flushedObjCount += magazine->count;
+    magazine->count = 0;
+}
+
+template <typename Obj>
+void LLBC_TypedObjPool<Obj>::DeleteThreadCaches()
+{
+    // Delete depot magazines.
+    for (_Magazine *magazines : {_depotFullMagazines, _depotEmptyMagazines})
+    {
+        while (magazines)
+        {
+            _Magazine *next = magazines->next;
+            free(magazines);
+            magazines = next;
+        }
+    }
+
+    _depotFullMagazines = _depotEmptyMagazines = nullptr;
+    _depotFullMagazineCount = _depotEmptyMagazineCount = 0;
+
+    // Delete thread caches(include retired thread caches).
+    if (_threadCaches)
+    {
+        for (int i = 0; i < _threadCaches->cap; ++i)
+        {
+            _ThreadCache *threadCache = _threadCaches->caches[i];
+            if (!threadCache)
+                continue;
+
+            free(threadCache->loaded);
+            free(threadCache->prev);
+            free(threadCache);
+        }
+    }
+
+    while (_threadCaches)
+    {
+        _ThreadCaches *prevThreadCaches = _threadCaches->prev;
+        free(_threadCaches);
+        _threadCaches = prevThreadCaches;
+    }
+}
+#endif // LLBC_CFG_CORE_OBJPOOL_MAGAZINE_SIZE > 0
+
 template <typename Obj>
 LLBC_Json::Value LLBC_TypedObjPool<Obj>::GetStatistics(LLBC_Json::MemoryPoolAllocator<> &jsonAlloc) const
 {
     __LLBC_INL_LockObjPool();
     LLBC_Defer(__LLBC_INL_UnlockObjPool());
 
+    // Collect thread caches statistics(thread caches counters updated by owner threads without lock,
+    // so the magazine statistics are approximate).
+    uint32 threadCacheCount = 0;
+    uint64 acquireHits = 0, acquireExchanges = 0, acquireMisses = 0;
+    uint64 releaseHits = 0, releaseExchanges = 0;
+    size_t depotFullMagazineCount = 0, depotEmptyMagazineCount = 0;
+    size_t cachedObjCount = 0;
+    #if LLBC_CFG_CORE_OBJPOOL_MAGAZINE_SIZE > 0
+    if (_threadCaches)
+    {
+        for (int i = 0; i < _threadCaches->cap; ++i)
+        {
+            const _ThreadCache *threadCache = _threadCaches->caches[i];
+            if (!threadCache)
+                continue;
+
+            ++threadCacheCount;
+            acquireHits += threadCache->acquireHits;
+            acquireExchanges += threadCache->acquireExchanges;
+            acquireMisses += threadCache->acquireMisses;
+            releaseHits += threadCache->releaseHits;
+            releaseExchanges += threadCache->releaseExchanges;
+        }
+    }
+
+    depotFullMagazineCount = _depotFullMagazineCount;
+    depotEmptyMagazineCount = _depotEmptyMagazineCount;
+
+    const uint64 cachedInCount = releaseHits + releaseExchanges;
+    const uint64 cachedOutCount = acquireHits + acquireExchanges + _flushedObjCount;
+    if (cachedInCount > cachedOutCount)
+        cachedObjCount = MIN(static_cast<size_t>(cachedInCount - cachedOutCount), _usingObjCount);
+    #endif // LLBC_CFG_CORE_OBJPOOL_MAGAZINE_SIZE > 0
+    const size_t usingObjCount = _usingObjCount - cachedObjCount;
+
     // Meta info:
     // - name.
     LLBC_Json::Value stat(LLBC_Json::kObjectType);
@@ -448,10 +804,10 @@ LLBC_Json::Value LLBC_TypedObjPool<Obj>::GetStatistics(LLBC_Json::MemoryPoolAllo
     const auto objCount = objCountPerStripe * _stripes.size();
     stat.AddMember("obj_count", static_cast<uint32>(objCount), jsonAlloc);
     // - using_obj_count.
-    stat.AddMember("using_obj_count", static_cast<uint32>(_usingObjCount), jsonAlloc);
+    stat.AddMember("using_obj_count", static_cast<uint32>(usingObjCount), jsonAlloc);
     // - using_obj_rate.
     stat.AddMember("using_obj_rate",
-                   objCount != 0 ? static_cast<double>(_usingObjCount) / objCount : 0.0,
+                   objCount != 0 ? static_cast<double>(usingObjCount) / objCount : 0.0,
                    jsonAlloc);
     // - reusable_obj_count.
     stat.AddMember("reusable_obj_count", _reusableObjCount, jsonAlloc);
@@ -459,8 +815,14 @@ LLBC_Json::Value LLBC_TypedObjPool<Obj>::GetStatistics(LLBC_Json::MemoryPoolAllo
     stat.AddMember("reusable_obj_rate",
                    objCount != 0 ? static_cast<double>(_reusableObjCount) / objCount : 0.0,
                    jsonAlloc);
+    // - cached_obj_count: thread caches & depot cached object count.
+    stat.AddMember("cached_obj_count", static_cast<uint32>(cachedObjCount), jsonAlloc);
+    // - cached_obj_rate.
+    stat.AddMember("cached_obj_rate",
+                   objCount != 0 ? static_cast<double>(cachedObjCount) / objCount : 0.0,
+                   jsonAlloc);
     // - free_obj_count.
-    const auto freeObjCount = objCount - _usingObjCount - _reusableObjCount;
+    const auto freeObjCount = objCount - usingObjCount - _reusableObjCount - cachedObjCount;
     stat.AddMember("free_obj_count", static_cast<uint32>(freeObjCount), jsonAlloc);
     // - free_obj_rate.
     stat.AddMember("free_obj_rate",
@@ -476,16 +838,49 @@ LLBC_Json::Value LLBC_TypedObjPool<Obj>::GetStatistics(LLBC_Json::MemoryPoolAllo
     // - stripe_count.
     stat.AddMember("stripe_count", static_cast<uint32>(_stripes.size()), jsonAlloc);
 
+    // Thread cache(magazine) info:
+    // - magazine_size: magazine size, in object.
+    stat.AddMember("magazine_size",
+                   static_cast<uint32>(_threadSafe ? LLBC_CFG_CORE_OBJPOOL_MAGAZINE_SIZE : 0),
+                   jsonAlloc);
+    // - thread_cache_count.
+    stat.AddMember("thread_cache_count", threadCacheCount, jsonAlloc);
+    // - depot_full_magazine_count.
+    stat.AddMember("depot_full_magazine_count", static_cast<uint32>(depotFullMagazineCount), jsonAlloc);
+    // - depot_empty_magazine_count.
+    stat.AddMember("depot_empty_magazine_count", static_cast<uint32>(depotEmptyMagazineCount), jsonAlloc);
+    // - magazine_acquire_count: acquire count, in thread caches.
+    const uint64 acquireCount = acquireHits + acquireExchanges + acquireMisses;
+    stat.AddMember("magazine_acquire_count", static_cast<uint64_t>(acquireCount), jsonAlloc);
+    // - magazine_acquire_hit_rate: acquire from loaded/previous magazine(lock free) rate.
+    stat.AddMember("magazine_acquire_hit_rate",
+                   acquireCount != 0 ? static_cast<double>(acquireHits) / acquireCount : 0.0,
+                   jsonAlloc);
+    // - magazine_acquire_exchange_rate: acquire after exchanged full magazine from depot rate.
+    stat.AddMember("magazine_acquire_exchange_rate",
+                   acquireCount != 0 ? static_cast<double>(acquireExchanges) / acquireCount : 0.0,
+                   jsonAlloc);
+    // - magazine_release_count: release count, in thread caches.
+    const uint64 releaseCount = releaseHits + releaseExchanges;
+    stat.AddMember("magazine_release_count", static_cast<uint64_t>(releaseCount), jsonAlloc);
+    // - magazine_release_hit_rate: release to loaded/previous magazine(lock free) rate.
+    stat.AddMember("magazine_release_hit_rate",
+                   releaseCount != 0 ? static_cast<double>(releaseHits) / releaseCount : 0.0,
+                   jsonAlloc);
+
     // Memory info:
     // - using_mem: using memory, in bytes
-    const auto usingMem = sizeof(Obj) * _usingObjCount;
+    const auto usingMem = sizeof(Obj) * usingObjCount;
     stat.AddMember("using_mem", static_cast<uint32>(usingMem), jsonAlloc);
     // - reusable_mem: reusable memory, in bytes.
     const auto reusableMem = sizeof(Obj) * _reusableObjCount;
     stat.AddMember("reusable_mem", static_cast<uint32>(reusableMem), jsonAlloc);
+    // - cached_mem: cached memory, in bytes.
+    const auto cachedMem = sizeof(Obj) * cachedObjCount;
+    stat.AddMember("cached_mem", static_cast<uint32>(cachedMem), jsonAlloc);
     // - free_mem: free memory, in bytes.
     const auto totalMem = sizeof(Obj) * objCount;
-    stat.AddMember("free_mem", static_cast<uint32>(totalMem - usingMem - reusableMem), jsonAlloc);
+    stat.AddMember("free_mem", static_cast<uint32>(totalMem - usingMem - reusableMem - cachedMem), jsonAlloc);
     // - total_mem: total memory, in bytes.
     stat.AddMember("total_mem", static_cast<uint32>(totalMem), jsonAlloc);
     // - total_mem2: total memory, included objpool manage cost.
@@ -501,6 +896,8 @@ LLBC_Json::Value LLBC_TypedObjPool<Obj>::GetStatistics(LLBC_Json::MemoryPoolAllo
 inline LLBC_ObjPool::LLBC_ObjPool(bool threadSafe)
 : _threadSafe(threadSafe)
 
+, _typedObjPoolSlots(nullptr)
+
 , _orderedDeleteNodes(nullptr)
 , _orderedDeleteNodeTree(nullptr)
 {
@@ -517,6 +914,9 @@ inline LLBC_ObjPool::~LLBC_ObjPool()
     // Lock.
     __LLBC_INL_LockObjPool();
 
+    // Delete typed object pool slots, make GetTypedObjPool() fallback to map lookup while destructing.
+    DelTypedObjPoolSlots();
+
     // Delete acquired ordered delete typed objs.
     OperateOrderedDeleteNodes(false, false);
     // Delete other typed objs.
@@ -524,6 +924,9 @@ inline LLBC_ObjPool::~LLBC_ObjPool()
         DelTypedObjPool(item.second);
     _typedObjPools.clear();
 
+    // Delete typed object pool slots(maybe rebuilt while deleting typed objs).
+    DelTypedObjPoolSlots();
+
     // Delete ordered delete nodes.
     if (_orderedDeleteNodes)
     {
@@ -599,9 +1002,14 @@ inline LLBC_String LLBC_ObjPool::GetStatistics(int statFmt) const
                         "obj_size;wrapped_obj_size;obj_count;"
                         "using_obj_count;using_obj_rate;"
                         "reusable_obj_count;reusable_obj_rate;"
+                        "cached_obj_count;cached_obj_rate;"
                         "free_obj_count;free_obj_rate;"
                         "stripe_size;obj_count_per_stripe;stripe_count;"
-                        "using_mem;reusable_mem;free_mem;total_mem;total_mem2");
+                        "magazine_size;thread_cache_count;"
+                        "depot_full_magazine_count;depot_empty_magazine_count;"
+                        "magazine_acquire_count;magazine_acquire_hit_rate;magazine_acquire_exchange_rate;"
+                        "magazine_release_count;magazine_release_hit_rate;"
+                        "using_mem;reusable_mem;cached_mem;free_mem;total_mem;total_mem2");
         }
 
          // Add typed object pools stat.
@@ -612,9 +1020,10 @@ inline LLBC_String LLBC_ObjPool::GetStatistics(int statFmt) const
             auto typedObjPoolStat = wrappedTypedObjPool->GetStatistics(wrappedTypedObjPool->typedObjPool,
                                                                        jsonDoc.GetAllocator());
             stat.append_format("\n%s;%s;%d;"
-                               "%u;%u;%u;%u;%.3f;%u;%.3f;%u;%.3f;"
+                               "%u;%u;%u;%u;%.3f;%u;%.3f;%u;%.3f;%u;%.3f;"
                                "%u;%u;%u;"
-                               "%u;%u;%u;%u;%u",
+                               "%u;%u;%u;%u;%llu;%.3f;%.3f;%llu;%.3f;"
+                               "%u;%u;%u;%u;%u;%u",
                                // Meta info:
                                _name.c_str(),
                                typedObjPoolStat["name"].GetString(),
@@ -627,15 +1036,28 @@ inline LLBC_String LLBC_ObjPool::GetStatistics(int statFmt) const
                                typedObjPoolStat["using_obj_rate"].GetDouble(),
                                typedObjPoolStat["reusable_obj_count"].GetUint(),
                                typedObjPoolStat["reusable_obj_rate"].GetDouble(),
+                               typedObjPoolStat["cached_obj_count"].GetUint(),
+                               typedObjPoolStat["cached_obj_rate"].GetDouble(),
                                typedObjPoolStat["free_obj_count"].GetUint(),
                                typedObjPoolStat["free_obj_rate"].GetDouble(),
                                // Stripe info:
                                typedObjPoolStat["stripe_size"].GetUint(),
                                typedObjPoolStat["obj_count_per_stripe"].GetUint(),
                                typedObjPoolStat["stripe_count"].GetUint(),
+                               // Thread cache(magazine) info:
+                               typedObjPoolStat["magazine_size"].GetUint(),
+                               typedObjPoolStat["thread_cache_count"].GetUint(),
+                               typedObjPoolStat["depot_full_magazine_count"].GetUint(),
+                               typedObjPoolStat["depot_empty_magazine_count"].GetUint(),
+                               static_cast<uint64>(typedObjPoolStat["magazine_acquire_count"].GetUint64()),
+                               typedObjPoolStat["magazine_acquire_hit_rate"].GetDouble(),
+                               typedObjPoolStat["magazine_acquire_exchange_rate"].GetDouble(),
+                               static_cast<uint64>(typedObjPoolStat["magazine_release_count"].GetUint64()),
+                               typedObjPoolStat["magazine_release_hit_rate"].GetDouble(),
                                // Memory info:
                                typedObjPoolStat["using_mem"].GetUint(),
                                typedObjPoolStat["reusable_mem"].GetUint(),
+                               typedObjPoolStat["cached_mem"].GetUint(),
                                typedObjPoolStat["free_mem"].GetUint(),
                                typedObjPoolStat["total_mem"].GetUint(),
                                typedObjPoolStat["total_mem2"].GetUint());
@@ -681,15 +1103,27 @@ LLBC_FORCE_INLINE LLBC_TypedObjPool<Obj> *LLBC_ObjPool::GetTypedObjPool()
 {
     typedef LLBC_TypedObjPool<Obj> _TypedObjPool;
     static const LLBC_CString rttiName(typeid(Obj).name());
+    static const int typeIndex = GetTypeIndex(rttiName.c_str());
+
+    // Find typed object pool in slots and return(if found, lock free).
+    const _TypedObjPoolSlots *slots = _typedObjPoolSlots;
+    if (LIKELY(slots && typeIndex < slots->cap))
+    {
+        _WrappedTypedObjPool *wrappedTypedObjPool = slots->slots[typeIndex];
+        if (LIKELY(wrappedTypedObjPool))
+            return reinterpret_cast<_TypedObjPool *>(wrappedTypedObjPool->typedObjPool);
+    }
 
     // Lock.
     __LLBC_INL_LockObjPool();
 
-    // Find typed object pool and return(if found).
+    // Find typed object pool again and return(if found, maybe created by other thread).
     const auto it = _typedObjPools.find(rttiName);
-    if (LIKELY(it != _typedObjPools.end()))
+    if (it != _typedObjPools.end())
     {
+        SetTypedObjPoolSlot(typeIndex, it->second);
         __LLBC_INL_UnlockObjPool();
+
         return reinterpret_cast<_TypedObjPool *>(it->second->typedObjPool);
     }
 
@@ -703,6 +1137,7 @@ LLBC_FORCE_INLINE LLBC_TypedObjPool<Obj> *LLBC_ObjPool::GetTypedObjPool()
     wrappedTypedObjPool->GetStatistics = &_TypedObjPool::GetStatistics_s;
     new (wrappedTypedObjPool->typedObjPool) _TypedObjPool(this, _threadSafe);
     _typedObjPools.emplace(rttiName, wrappedTypedObjPool);
+    SetTypedObjPoolSlot(typeIndex, wrappedTypedObjPool);
 
     // Unlock.
     __LLBC_INL_UnlockObjPool();
@@ -883,6 +1318,39 @@ inline LLBC_ObjPool::_OrderedDeleteNode *LLBC_ObjPool::_OrderedDeleteNode::GetRo
     return root;
 }
 
+inline void LLBC_ObjPool::SetTypedObjPoolSlot(int typeIndex, _WrappedTypedObjPool *wrappedTypedObjPool)
+{
+    // Grow slots, if required(old slots retired, keep readable for lock free readers).
+    _TypedObjPoolSlots *slots = _typedObjPoolSlots;
+    if (!slots || typeIndex >= slots->cap)
+    {
+        const int newCap = MAX(typeIndex + 1, slots ? slots->cap * 2 : 32);
+        auto newSlots = LLBC_Malloc(_TypedObjPoolSlots,
+                                    sizeof(_TypedObjPoolSlots) + sizeof(_WrappedTypedObjPool *) * newCap);
+        newSlots->cap = newCap;
+        newSlots->prev = slots;
+        for (int i = 0; i < newCap; ++i)
+            newSlots->slots[i] = slots && i < slots->cap ? slots->slots[i] : nullptr;
+
+        (void)LLBC_AtomicCompareAndExchange(&_typedObjPoolSlots, newSlots, slots);
+        slots = newSlots;
+    }
+
+    // Publish typed object pool.
+    (void)LLBC_AtomicCompareAndExchange(
+        &slots->slots[typeIndex], wrappedTypedObjPool, static_cast<_WrappedTypedObjPool *>(nullptr));
+}
+
+inline void LLBC_ObjPool::DelTypedObjPoolSlots()
+{
+    while (_typedObjPoolSlots)
+    {
+        _TypedObjPoolSlots *prevSlots = _typedObjPoolSlots->prev;
+        free(_typedObjPoolSlots);
+        _typedObjPoolSlots = prevSlots;
+    }
+}
+
 inline void LLBC_ObjPool::DelTypedObjPool(_WrappedTypedObjPool *wrappedTypedObjPool)
 {
     wrappedTypedObjPool->Destruct(wrappedTypedObjPool->typedObjPool);
@@ -325,4 +325,28 @@ inline sint64 LLBC_AtomicCompareAndExchange(volatile sint64 *ptr, sint64 exchang
 #endif
 }
 
+/**
+ * Performs an atomic comprarison of specified pointers and exchanges the pointers(pointer version).
+ * @param[in/out] ptr   - specifies the address of the destination pointer.
+ * @param[in] exchange  - specifies the exchange pointer.
+ * @param[in] comparand - specifies the pointer compare to destination.
+ * @return T * -  returns the initial pointer of the ptr.
+ */
+template <typename T>
+inline T *LLBC_AtomicCompareAndExchange(T * volatile *ptr, T *exchange, T *comparand)
+{
+#if LLBC_TARGET_PLATFORM_LINUX
+    return __sync_val_compare_and_swap(ptr, comparand, exchange);
+#elif LLBC_TARGET_PLATFORM_WIN32
+    return reinterpret_cast<T *>(::InterlockedCompareExchangePointer(
+        reinterpret_cast<PVOID volatile *>(ptr), exchange, comparand));
+#elif LLBC_TARGET_PLATFORM_IPHONE
+    return __sync_val_compare_and_swap(ptr, comparand, exchange);
+#elif LLBC_TARGET_PLATFORM_MAC
+    return __sync_val_compare_and_swap(ptr, comparand, exchange);
+#elif LLBC_TARGET_PLATFORM_ANDROID
+    return __sync_val_compare_and_swap(ptr, comparand, exchange);
+#endif
+}
+
 __LLBC_NS_END
@@ -80,6 +80,18 @@ LLBC_EXPORT int LLBC_ShutdownSocketInputOutput(LLBC_SocketHandle handle);
  */
 LLBC_EXPORT int LLBC_Send(LLBC_SocketHandle handle, const void *buf, int len, int flags);
 
+/**
+ * Gather sends data on a connected socket, all buffers will be sent by one system call.
+ * Note:
+ *      - In Non-WIN32 platform, use writev(), bufferCount will be truncated to IOV_MAX.
+ *      - In WIN32 platform, use WSASend() without overlapped.
+ * @param[in] handle      - socket handle.
+ * @param[in] buffers     - pointer to array of LLBC_SockBuf structures.
+ * @param[in] bufferCount - number of LLBC_SockBuf structures in the buffers.
+ * @return int - if no error occurs, return the total number bytes sent, otherwise return -1.
+ */
+LLBC_EXPORT int LLBC_SendV(LLBC_SocketHandle handle, const LLBC_SockBuf *buffers, int bufferCount);
+
 /**
  * Send data on a connected socket(WIN32 specific).
  * @param[in]  handle         - socket handle.
@@ -166,6 +178,15 @@ LLBC_EXPORT int LLBC_EnableAddressReusable(LLBC_SocketHandle handle);
  */
 LLBC_EXPORT int LLBC_DisableAddressReusable(LLBC_SocketHandle handle);
 
+/**
+ * Enable socket port reusable(SO_REUSEPORT), let multiple sockets bind to the same address.
+ * Note: Only available on the platforms which support SO_REUSEPORT, otherwise return -1 and
+ *       the last error will be set to LLBC_ERROR_NOT_IMPL.
+ * @param[in] handle - socket handle.
+ * @return int - return 0 if success, otherwise return -1.
+ */
+LLBC_EXPORT int LLBC_EnablePortReusable(LLBC_SocketHandle handle);
+
 /**
  * Set socket send buffer size, in bytes.
  * @param[in] handle - socket.
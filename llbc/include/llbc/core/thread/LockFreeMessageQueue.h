@@ -0,0 +1,150 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2013 lailongwei<lailongwei@126.com>
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of 
+// this software and associated documentation files (the "Software"), to deal in 
+// the Software without restriction, including without limitation the rights to 
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of 
+// the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS 
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER 
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN 
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+#include <atomic>
+
+#if !LLBC_TARGET_PLATFORM_LINUX
+#include "llbc/core/thread/SimpleLock.h"
+#include "llbc/core/thread/ConditionVariable.h"
+#endif // !LLBC_TARGET_PLATFORM_LINUX
+
+__LLBC_NS_BEGIN
+class LLBC_MessageBlock;
+__LLBC_NS_END
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The lock-free multi-producer/single-consumer thread message queue class encapsulation.
+ *        Producers push message blocks by CAS onto an intrusive stack, consumer takes all pushed
+ *        blocks by one atomic exchange and keep them in a private FIFO list, the consumer only
+ *        sleeps(futex on linux) when queue is empty, and producers only make syscall to wakeup
+ *        the sleeping consumer.
+ * Note: All pop/wait methods must be called by the only one consumer thread.
+ */
+class LLBC_EXPORT LLBC_LockFreeMessageQueue
+{
+public:
+    LLBC_LockFreeMessageQueue();
+    ~LLBC_LockFreeMessageQueue();
+
+public:
+    /**
+     * Insert new message block at the end of the controlled sequence, can be called by any threads.
+     * @param[in] block - message block.
+     */
+    void PushBack(LLBC_MessageBlock *block);
+
+public:
+    /**
+     * Pop all message blocks.
+     * @param[out] blocks - the message blocks.
+     * @return bool - return true if has block(s), otherwise return false.
+     */
+    bool PopAll(LLBC_MessageBlock *&blocks);
+
+    /**
+     * Fetch and remove the first message block of the controlled sequence.
+     * @param[out] block - message block.
+     */
+    void PopFront(LLBC_MessageBlock *&block);
+
+    /**
+     * Try fetch and remove the first message block.
+     * @param[out] block - message block.
+     * @return bool - return true if success, otherwise return false.
+     */
+    bool TryPopFront(LLBC_MessageBlock *&block);
+
+    /**
+     * Timed fetch and remove the first message block.
+     * @param[out] block   - message block.
+     * @param[in] interval - interval, in milliseconds.
+     * @return bool - return true if success, otherwise return false.
+     */
+    bool TimedPopFront(LLBC_MessageBlock *&block, int interval);
+
+public:
+    /**
+     * Timed wait message block arrival(not fetch), or be woken up by Wakeup() method.
+     * @param[in] interval - interval, in milliseconds.
+     * @return bool - return true if has message block(s) or be woken up, otherwise return false.
+     */
+    bool TimedWait(int interval);
+
+    /**
+     * Wakeup the thread which waiting in TimedWait() method, even if no message block arrival.
+     */
+    void Wakeup();
+
+public:
+    /**
+     * Get the message block current size.
+     * @return size_t - current size.
+     */
+    size_t GetSize() const;
+
+    /**
+     * Cleanup the message queue, must be called when no consumer is running.
+     */
+    void Cleanup();
+
+private:
+    /**
+     * Move all pushed message blocks to consumer FIFO list.
+     * @return bool - return true if consumer FIFO list not empty, otherwise return false.
+     */
+    bool Fetch();
+
+    /**
+     * Sleep until message blocks pushed, woken up or timeout.
+     * @param[in] interval - interval, in milliseconds.
+     */
+    void Sleep(int interval);
+
+    /**
+     * Wakeup the sleeping consumer, if has.
+     */
+    void WakeupSleeper();
+
+private:
+    // Producers side members.
+    std::atomic<LLBC_MessageBlock *> _pushed; // The pushed message blocks, in LIFO order.
+    std::atomic<size_t> _size; // Pushed and not popped message blocks count.
+    std::atomic<int> _sleeping; // Consumer sleeping flag, also used as futex word on linux.
+    std::atomic<bool> _wakeup; // Wakeup flag.
+
+    // Consumer side members, placed in separate cache line.
+    alignas(64) LLBC_MessageBlock *_head; // The fetched message blocks list head, in FIFO order.
+    LLBC_MessageBlock *_tail; // The fetched message blocks list tail.
+    size_t _fetchedCount; // The fetched message blocks count.
+
+#if !LLBC_TARGET_PLATFORM_LINUX
+    LLBC_SimpleLock _sleepLock;
+    LLBC_ConditionVariable _sleepCond;
+#endif // !LLBC_TARGET_PLATFORM_LINUX
+};
+
+__LLBC_NS_END
+
+#include "llbc/core/thread/LockFreeMessageQueueInl.h"
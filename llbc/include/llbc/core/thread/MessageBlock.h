@@ -22,6 +22,7 @@
 #pragma once
 
 #include "llbc/common/Common.h"
+#include "llbc/core/os/OS_Atomic.h"
 
 __LLBC_NS_BEGIN
 
@@ -201,6 +202,22 @@ public:
      */
     LLBC_MessageBlock *Clone() const;
 
+    /**
+     * Share message block readable data, the returned block is a read-only view of this block's
+     * readable data, no data will be copied.
+     * Once shared, this block and all views are read-only, the buffer will be freed when the last
+     * one of them deleted/recycled.
+     * Note: Attached message block(not shared) could not be shared.
+     * @return LLBC_MessageBlock * - the shared view block, return nullptr if failed.
+     */
+    LLBC_MessageBlock *Share();
+
+    /**
+     * Check the message block's buffer is shared or not.
+     * @return bool - the shared attribute.
+     */
+    bool IsShared() const;
+
     /**
      * Get previous message block.
      * @return LLBC_MessageBlock * - previous message block.
@@ -233,9 +250,16 @@ public:
 
     LLBC_DISABLE_ASSIGNMENT(LLBC_MessageBlock);
 
+private:
+    /**
+     * Free buffer, if buffer is shared, only free when the last shared block release it.
+     */
+    void FreeBuf();
+
 private:
     bool _attach;
     char *_buf;
+    volatile sint32 *_sharedRef;
     size_t _size;
 
     size_t _readPos;
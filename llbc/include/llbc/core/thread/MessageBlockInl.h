@@ -26,6 +26,7 @@ __LLBC_NS_BEGIN
 inline LLBC_MessageBlock::LLBC_MessageBlock(size_t size)
 : _attach(false)
 , _buf(nullptr)
+, _sharedRef(nullptr)
 , _size(size)
 
 , _readPos(0)
@@ -43,6 +44,7 @@ inline LLBC_MessageBlock::LLBC_MessageBlock(size_t size)
 inline LLBC_MessageBlock::LLBC_MessageBlock(void *buf, size_t size, bool attach)
 : _attach(attach)
 , _buf(reinterpret_cast<char *>(buf))
+, _sharedRef(nullptr)
 , _size(size)
 
 , _readPos(0)
@@ -57,8 +59,7 @@ inline LLBC_MessageBlock::LLBC_MessageBlock(void *buf, size_t size, bool attach)
 
 inline LLBC_MessageBlock::~LLBC_MessageBlock()
 {
-    if (_buf && !_attach)
-        free(_buf);
+    FreeBuf();
 }
 
 inline int LLBC_MessageBlock::Allocate(size_t size)
@@ -101,6 +102,11 @@ inline int LLBC_MessageBlock::Write(const void *buf, size_t len)
         LLBC_SetLastError(LLBC_ERROR_ARG);
         return LLBC_FAILED;
     }
+    else if (UNLIKELY(_sharedRef))
+    {
+        LLBC_SetLastError(LLBC_ERROR_NOT_ALLOW);
+        return LLBC_FAILED;
+    }
 
     if (_writePos + len > _size)
     {
@@ -120,8 +126,10 @@ inline void LLBC_MessageBlock::Release()
     if (!_buf)
         return;
 
-    if (!_attach)
-        free(_buf);
+    if (_sharedRef)
+        _attach = false;
+
+    FreeBuf();
     _buf = nullptr;
 
     _size = 0;
@@ -133,6 +141,8 @@ inline void LLBC_MessageBlock::Clear()
     _readPos = _writePos = 0;
     if (_attach)
     {
+        FreeBuf();
+
         _buf = 0;
         _size = 0;
         _attach = false;
@@ -258,6 +268,7 @@ inline void LLBC_MessageBlock::Swap(LLBC_MessageBlock *another)
     std::swap(_attach, another->_attach);
 
     std::swap(_buf, another->_buf);
+    std::swap(_sharedRef, another->_sharedRef);
     std::swap(_size, another->_size);
 
     std::swap(_readPos, another->_readPos);
@@ -270,7 +281,13 @@ inline void LLBC_MessageBlock::Swap(LLBC_MessageBlock *another)
 inline LLBC_MessageBlock *LLBC_MessageBlock::Clone() const
 {
     LLBC_MessageBlock *clone;
-    if (IsAttach())
+    if (IsShared())
+    {
+        clone = new LLBC_MessageBlock(_buf, _size);
+        clone->_sharedRef = _sharedRef;
+        (void)LLBC_AtomicFetchAndAdd(_sharedRef, 1);
+    }
+    else if (IsAttach())
     {
         clone = new LLBC_MessageBlock(_buf, _size);
     }
@@ -288,6 +305,37 @@ inline LLBC_MessageBlock *LLBC_MessageBlock::Clone() const
     return clone;
 }
 
+inline LLBC_MessageBlock *LLBC_MessageBlock::Share()
+{
+    if (UNLIKELY(_attach && !_sharedRef))
+    {
+        LLBC_SetLastError(LLBC_ERROR_NOT_ALLOW);
+        return nullptr;
+    }
+
+    // First share, this block's buffer become shared buffer, owned by all shared blocks.
+    if (!_sharedRef)
+    {
+        _sharedRef = new sint32(1);
+        _attach = true;
+    }
+
+    (void)LLBC_AtomicFetchAndAdd(_sharedRef, 1);
+
+    // Shared view block's size limit to write pos, make it not writable.
+    LLBC_MessageBlock *view = new LLBC_MessageBlock(_buf, _writePos);
+    view->_sharedRef = _sharedRef;
+    view->_readPos = _readPos;
+    view->_writePos = _writePos;
+
+    return view;
+}
+
+inline bool LLBC_MessageBlock::IsShared() const
+{
+    return _sharedRef != nullptr;
+}
+
 inline LLBC_MessageBlock *LLBC_MessageBlock::GetPrev() const
 {
     return _prev;
@@ -308,6 +356,24 @@ inline void LLBC_MessageBlock::SetNext(LLBC_MessageBlock *next)
     _next = next;
 }
 
+inline void LLBC_MessageBlock::FreeBuf()
+{
+    if (_sharedRef)
+    {
+        if (LLBC_AtomicFetchAndSub(_sharedRef, 1) == 1)
+        {
+            free(_buf);
+            delete _sharedRef;
+        }
+
+        _sharedRef = nullptr;
+    }
+    else if (_buf && !_attach)
+    {
+        free(_buf);
+    }
+}
+
 inline void LLBC_MessageBlock::Resize(size_t newSize)
 {
     llbc_assert(!_attach && newSize > _size);
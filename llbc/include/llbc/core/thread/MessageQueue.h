@@ -107,6 +107,19 @@ public:
      */
     bool TimedPopBack(LLBC_MessageBlock *&block, int interval);
 
+public:
+    /**
+     * Timed wait message block arrival(not fetch), or be woken up by Wakeup() method.
+     * @param[in] interval - interval, in milliseconds.
+     * @return bool - return true if has message block(s) or be woken up, otherwise return false.
+     */
+    bool TimedWait(int interval);
+
+    /**
+     * Wakeup the thread which waiting in TimedWait() method, even if no message block arrival.
+     */
+    void Wakeup();
+
 public:
     /**
      * Get the message block current size.
@@ -174,6 +187,7 @@ public:
     LLBC_MessageBlock *_tail;
 
     volatile size_t _size;
+    volatile bool _wakeup;
 };
 
 __LLBC_NS_END
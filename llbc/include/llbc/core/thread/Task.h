@@ -23,6 +23,7 @@
 
 #include "llbc/core/os/OS_Thread.h"
 #include "llbc/core/thread/MessageQueue.h"
+#include "llbc/core/thread/LockFreeMessageQueue.h"
 
 __LLBC_NS_BEGIN
 
@@ -105,6 +106,21 @@ public:
      */
     LLBC_Handle GetThreadGroupHandle() const;
 
+    /**
+     * Check task message queue is lock-free(multi-producer/single-consumer) message queue or not.
+     * @return bool - the lock-free message queue flag.
+     */
+    bool IsLockFreeMessageQueue() const;
+
+    /**
+     * Enable/Disable lock-free(multi-producer/single-consumer) message queue, only can be set before task
+     * activated, and lock-free message queue task only can be activated with one thread.
+     * Note: The queued messages will be moved to the new message queue.
+     * @param[in] lockFree - the lock-free message queue flag.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int SetLockFreeMessageQueue(bool lockFree);
+
 public:
     /**
      * Wait current task.
@@ -160,6 +176,18 @@ public:
      */
     virtual int TimedPop(LLBC_MessageBlock *&block, int interval);
 
+    /**
+     * Timed wait message block arrival(not pop), or be woken up by WakeupMessageWaiting() method.
+     * @param[in] interval - interval, in milliseconds.
+     * @return int - return 0 if message arrived or woken up, otherwise return -1.
+     */
+    int TimedWaitMessage(int interval);
+
+    /**
+     * Wakeup the thread which waiting in TimedWaitMessage() method.
+     */
+    void WakeupMessageWaiting();
+
     /**
      * Get unprocessed message size.
      * @return size_t - the unprocessed message size.
@@ -195,7 +223,9 @@ private:
     volatile int _activatingThreadNum;
     volatile int _inSvcMethThreadNum;
 
+    bool _useLockFreeMsgQueue;
     LLBC_MessageQueue _msgQueue;
+    LLBC_LockFreeMessageQueue _lockFreeMsgQueue;
 };
 
 __LLBC_NS_END
@@ -55,21 +55,34 @@ inline LLBC_Handle LLBC_Task::GetThreadGroupHandle() const
     return _threadGroupHandle;
 }
 
+inline bool LLBC_Task::IsLockFreeMessageQueue() const
+{
+    return _useLockFreeMsgQueue;
+}
+
 inline int LLBC_Task::Push(LLBC_MessageBlock *block)
 {
-    _msgQueue.PushBack(block);
+    if (_useLockFreeMsgQueue)
+        _lockFreeMsgQueue.PushBack(block);
+    else
+        _msgQueue.PushBack(block);
+
     return LLBC_OK;
 }
 
 inline int LLBC_Task::Pop(LLBC_MessageBlock *&block)
 {
-    _msgQueue.PopFront(block);
+    if (_useLockFreeMsgQueue)
+        _lockFreeMsgQueue.PopFront(block);
+    else
+        _msgQueue.PopFront(block);
+
     return LLBC_OK;
 }
 
 inline int LLBC_Task::PopAll(LLBC_MessageBlock *&blocks)
 {
-    if (_msgQueue.PopAll(blocks))
+    if (_useLockFreeMsgQueue ? _lockFreeMsgQueue.PopAll(blocks) : _msgQueue.PopAll(blocks))
         return LLBC_OK;
 
     return LLBC_FAILED;
@@ -77,7 +90,7 @@ inline int LLBC_Task::PopAll(LLBC_MessageBlock *&blocks)
 
 inline int LLBC_Task::TryPop(LLBC_MessageBlock *&block)
 {
-    if (_msgQueue.TryPopFront(block))
+    if (_useLockFreeMsgQueue ? _lockFreeMsgQueue.TryPopFront(block) : _msgQueue.TryPopFront(block))
         return LLBC_OK;
 
     return LLBC_FAILED;
@@ -85,15 +98,31 @@ inline int LLBC_Task::TryPop(LLBC_MessageBlock *&block)
 
 inline int LLBC_Task::TimedPop(LLBC_MessageBlock *&block, int interval)
 {
-    if (_msgQueue.TimedPopFront(block, interval))
+    if (_useLockFreeMsgQueue ? _lockFreeMsgQueue.TimedPopFront(block, interval) : _msgQueue.TimedPopFront(block, interval))
+        return LLBC_OK;
+
+    return LLBC_FAILED;
+}
+
+inline int LLBC_Task::TimedWaitMessage(int interval)
+{
+    if (_useLockFreeMsgQueue ? _lockFreeMsgQueue.TimedWait(interval) : _msgQueue.TimedWait(interval))
         return LLBC_OK;
 
     return LLBC_FAILED;
 }
 
+inline void LLBC_Task::WakeupMessageWaiting()
+{
+    if (_useLockFreeMsgQueue)
+        _lockFreeMsgQueue.Wakeup();
+    else
+        _msgQueue.Wakeup();
+}
+
 inline size_t LLBC_Task::GetMessageSize() const
 {
-    return _msgQueue.GetSize();
+    return _useLockFreeMsgQueue ? _lockFreeMsgQueue.GetSize() : _msgQueue.GetSize();
 }
 
 __LLBC_NS_END
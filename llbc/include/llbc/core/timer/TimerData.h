@@ -79,6 +79,11 @@ struct LLBC_HIDDEN LLBC_TimerData
     // Unused bytes.
     uint16 unused1;
     uint32 unused2;
+
+    // Timing wheel slot list links(only used in timing wheel scheduler backend),
+    // wheelPPrev point to prev timer data's wheelNext or slot head, nullptr means not in wheel.
+    LLBC_TimerData *wheelNext;
+    LLBC_TimerData **wheelPPrev;
 };
 
 __LLBC_NS_END
@@ -32,6 +32,25 @@ __LLBC_NS_END
 
 __LLBC_NS_BEGIN
 
+/**
+ * \brief The timer scheduler backend enumeration.
+ */
+class LLBC_TimerSchedulerBackend
+{
+public:
+    enum ENUM
+    {
+        Begin,
+
+        // Binary heap, O(log n) schedule/expiry.
+        Heap = Begin,
+        // Hierarchical timing wheel(1 ms tick), O(1) schedule/cancel, amortized O(1) expiry.
+        TimingWheel,
+
+        End
+    };
+};
+
 /**
  * \brief The timer scheduler class encapsulation.
  */
@@ -44,7 +63,11 @@ class LLBC_EXPORT LLBC_TimerScheduler
                       std::greater<LLBC_NS LLBC_TimerData *> > _Heap;
 
 public:
-    LLBC_TimerScheduler();
+    /**
+     * Construct timer scheduler.
+     * @param[in] backend - the scheduler backend, see LLBC_TimerSchedulerBackend.
+     */
+    explicit LLBC_TimerScheduler(int backend = LLBC_CFG_CORE_TIMER_DFT_SCHEDULER_BACKEND);
     virtual ~LLBC_TimerScheduler();
 
 public:
@@ -72,6 +95,12 @@ public:
      */
     void SetEnabled(bool enabled);
 
+    /**
+     * Get timer scheduler backend.
+     * @return int - the scheduler backend, see LLBC_TimerSchedulerBackend.
+     */
+    int GetBackend() const;
+
     /**
      * Get timer count in this scheduler.
      * @return size_t - the timer count.
@@ -116,16 +145,69 @@ private:
      */
     virtual int Cancel(LLBC_Timer *timer);
 
+private:
+    /**
+     * Heap backend update.
+     * @param[in] now - current time, in milli-seconds.
+     */
+    void UpdateHeap(sint64 now);
+
+    /**
+     * Timing wheel backend update.
+     * @param[in] now - current time, in milli-seconds.
+     */
+    void UpdateWheel(sint64 now);
+
+    /**
+     * Handle timer timeout, timer data must already removed from heap/wheel.
+     * @param[in] data - the timer data.
+     * @param[in] now  - current time, in milli-seconds.
+     * @return bool - return true if timer need reschedule(timer data handle has been updated),
+     *                otherwise return false(timer data has been released).
+     */
+    bool HandleTimeout(LLBC_TimerData *data, sint64 now);
+
+    /**
+     * Add timer data to timing wheel.
+     * @param[in] data - the timer data.
+     */
+    void AddToWheel(LLBC_TimerData *data);
+
+    /**
+     * Remove timer data from timing wheel(or expired list).
+     * @param[in] data - the timer data.
+     */
+    static void RemoveFromWheel(LLBC_TimerData *data);
+
+    /**
+     * Cascade timing wheel slot timers to lower level.
+     * @param[in] slotIdx - the slot index.
+     */
+    void CascadeWheel(size_t slotIdx);
+
+    /**
+     * Get all timer datas in the heap/wheel.
+     * @param[out] datas - the timer datas.
+     */
+    void GetTimerDatas(std::vector<LLBC_TimerData *> &datas) const;
+
 private:
     LLBC_DISABLE_ASSIGNMENT(LLBC_TimerScheduler);
 
 private:
     static sint64 _maxTimerId;
+    const int _backend;
     bool _enabled;
     bool _destroying;
     bool _cancelingAll;
 
+    // Heap backend members.
     _Heap _heap;
+
+    // Timing wheel backend members.
+    sint64 _wheelTick; // Next tick(milli-seconds) to process.
+    size_t _wheelTimerCount;
+    std::vector<LLBC_TimerData *> _wheelSlots;
 };
 
 __LLBC_NS_END
@@ -34,7 +34,9 @@ struct LLBC_Delegate;
 
 /**
  * @brief The Delegate encapsulation(template specification).
- * 
+ *        The callable object is stored in the inline buffer(see LLBC_CFG_CORE_UTILS_DELEGATE_INLINE_SIZE)
+ *        if it fits, so c-style function, object method and small captures lambda delegates no need
+ *        any heap allocation, and invoke delegate only need one indirect call.
  */
 template <typename Rtn, typename ...Args>
 struct LLBC_Delegate<Rtn(Args...)>
@@ -92,7 +94,7 @@ public:
     /**
      * @brief Destructor.
      */
-    ~LLBC_Delegate() = default;
+    ~LLBC_Delegate();
 
 public:
     /**
@@ -138,7 +140,7 @@ public:
     /**
      * @brief Assignment by stl function.
      */
-    LLBC_Delegate &operator=(StlFunc &&stlFunc) noexcept;
+    LLBC_Delegate &operator=(StlFunc &&stlFunc);
     LLBC_Delegate &operator=(const StlFunc &stlFunc);
 
     /**
@@ -155,8 +157,72 @@ public:
     operator=(const Func &func);
 
 private:
-    CFunc _cfunc;
-    StlFunc _stlFunc;
+    /**
+     * @brief The stored callable object manage operation enumeration.
+     */
+    enum _ManageOp
+    {
+        _Copy,
+        _Move,
+        _Destroy
+    };
+
+    /**
+     * @brief The stored callable object invoker/manager function type define.
+     */
+    typedef Rtn(*_Invoker)(const void *storage, Args &&...args);
+    typedef void(*_Manager)(_ManageOp op, void *storage, void *another);
+
+    /**
+     * @brief Check callable object can be stored in inline buffer or not.
+     */
+    template <typename Func>
+    static constexpr bool _IsInlineStorable();
+
+private:
+    /**
+     * @brief Store callable object.
+     */
+    template <typename Func>
+    void Store(Func &&func);
+
+    /**
+     * @brief Copy/Move stored callable object from another delegate object.
+     */
+    void CopyFrom(const LLBC_Delegate &another);
+    void MoveFrom(LLBC_Delegate &another);
+
+    /**
+     * @brief Destroy stored callable object, make delegate invalidate.
+     */
+    void Reset();
+
+    /**
+     * @brief Check the function pointer/stl function object is null or not.
+     */
+    template <typename Func>
+    static bool IsNullFunc(const Func &func);
+
+private:
+    /**
+     * @brief The inline/heap stored callable object invokers/managers.
+     */
+    template <typename Func>
+    static Rtn InvokeInline(const void *storage, Args &&...args);
+    template <typename Func>
+    static Rtn InvokeHeap(const void *storage, Args &&...args);
+    template <typename Func>
+    static Rtn Invoke(Func &func, Args &&...args);
+
+    template <typename Func>
+    static void ManageInline(_ManageOp op, void *storage, void *another);
+    template <typename Func>
+    static void ManageHeap(_ManageOp op, void *storage, void *another);
+
+private:
+    _Invoker _invoker; // The invoker, nullptr if delegate invalidate.
+    _Manager _manager; // The manager, nullptr if stored callable object is trivially copyable.
+    alignas(void *) uint8 _storage[LLBC_CFG_CORE_UTILS_DELEGATE_INLINE_SIZE]; // Inline buffer.
 };
 
 __LLBC_NS_END
@@ -23,105 +23,117 @@
 
 __LLBC_NS_BEGIN
 
+
 template <typename Rtn, typename ...Args>
 LLBC_Delegate<Rtn(Args...)>::LLBC_Delegate(std::nullptr_t _)
-: _cfunc(nullptr)
-, _stlFunc()
+: _invoker(nullptr)
+, _manager(nullptr)
 {
 }
 
 template <typename Rtn, typename ...Args>
 LLBC_Delegate<Rtn(Args...)>::LLBC_Delegate(const CFunc &cfunc)
-: _cfunc(cfunc)
-, _stlFunc()
+: _invoker(nullptr)
+, _manager(nullptr)
 {
+    Store(cfunc);
 }
 
 template <typename Rtn, typename ...Args>
 LLBC_Delegate<Rtn(Args...)>::LLBC_Delegate(StlFunc &&stlFunc)
-: _cfunc(nullptr)
-, _stlFunc(std::move(stlFunc))
+: _invoker(nullptr)
+, _manager(nullptr)
 {
+    Store(std::move(stlFunc));
 }
 
 template <typename Rtn, typename ...Args>
 LLBC_Delegate<Rtn(Args...)>::LLBC_Delegate(const StlFunc &stlFunc)
-: _cfunc(nullptr)
-, _stlFunc(stlFunc)
+: _invoker(nullptr)
+, _manager(nullptr)
 {
+    Store(stlFunc);
 }
 
 template <typename Rtn, typename ...Args>
 template <typename Obj>
 LLBC_Delegate<Rtn(Args...)>::LLBC_Delegate(Obj *obj, Rtn(Obj::*meth)(Args...))
-: _cfunc(nullptr)
-, _stlFunc(LLBC_BindClassMethod(obj, meth))
+: _invoker(nullptr)
+, _manager(nullptr)
 {
+    // Object pointer + method pointer, always stored in inline buffer.
+    Store([obj, meth](Args &&...args) -> Rtn { return (obj->*meth)(std::forward<Args>(args)...); });
 }
 
 template <typename Rtn, typename ...Args>
 template <typename Obj>
 LLBC_Delegate<Rtn(Args...)>::LLBC_Delegate(Obj *obj, Rtn(Obj::*constMeth)(Args...) const)
-: _cfunc(nullptr)
-, _stlFunc(LLBC_BindClassMethod(obj, constMeth))
+: _invoker(nullptr)
+, _manager(nullptr)
 {
+    Store([obj, constMeth](Args &&...args) -> Rtn { return (obj->*constMeth)(std::forward<Args>(args)...); });
 }
 
 template <typename Rtn, typename ...Args>
 LLBC_Delegate<Rtn(Args...)>::LLBC_Delegate(LLBC_Delegate &&another) noexcept
-: _cfunc(another._cfunc)
-, _stlFunc(std::move(another._stlFunc))
+: _invoker(nullptr)
+, _manager(nullptr)
 {
-    another._cfunc = nullptr;
+    MoveFrom(another);
 }
 
 template <typename Rtn, typename ...Args>
 LLBC_Delegate<Rtn(Args...)>::LLBC_Delegate(const LLBC_Delegate &another)
-: _cfunc(another._cfunc)
-, _stlFunc(another._stlFunc)
+: _invoker(nullptr)
+, _manager(nullptr)
 {
+    CopyFrom(another);
 }
 
 template <typename Rtn, typename ...Args>
 template <typename Func>
 LLBC_Delegate<Rtn(Args...)>::LLBC_Delegate(const Func &func)
-: _cfunc(nullptr)
-, _stlFunc(func)
+: _invoker(nullptr)
+, _manager(nullptr)
+{
+    Store(func);
+}
+
+template <typename Rtn, typename ...Args>
+LLBC_Delegate<Rtn(Args...)>::~LLBC_Delegate()
 {
+    if (_manager)
+        _manager(_Destroy, _storage, nullptr);
 }
 
 template <typename Rtn, typename ...Args>
 LLBC_Delegate<Rtn(Args...)>::operator bool() const
 {
-    return _cfunc != nullptr || _stlFunc != nullptr;
+    return _invoker != nullptr;
 }
 
 template <typename Rtn, typename ...Args>
 bool LLBC_Delegate<Rtn(Args...)>::operator==(std::nullptr_t _) const
 {
-    return _cfunc == nullptr && _stlFunc == nullptr;
+    return _invoker == nullptr;
 }
 
 template <typename Rtn, typename ...Args>
 bool LLBC_Delegate<Rtn(Args...)>::operator!=(std::nullptr_t _) const
 {
-    return _cfunc != nullptr || _stlFunc != nullptr;
+    return _invoker != nullptr;
 }
 
 template <typename Rtn, typename ...Args>
 Rtn LLBC_Delegate<Rtn(Args...)>::operator()(Args... args) const
 {
-    if (_cfunc)
-        return (*_cfunc)(std::forward<Args>(args)...);
-    else
-        return _stlFunc(std::forward<Args>(args)...);
+    return (*_invoker)(_storage, std::forward<Args>(args)...);
 }
 
 template <typename Rtn, typename ...Args>
 LLBC_Delegate<Rtn(Args...)> &LLBC_Delegate<Rtn(Args...)>::operator=(std::nullptr_t _)
 {
-    _cfunc = nullptr;
-    _stlFunc = nullptr;
+    Reset();
 
     return *this;
 }
@@ -129,18 +141,18 @@ LLBC_Delegate<Rtn(Args...)> &LLBC_Delegate<Rtn(Args...)>::operator=(std::nullptr
 template <typename Rtn, typename ...Args>
 LLBC_Delegate<Rtn(Args...)> &LLBC_Delegate<Rtn(Args...)>::operator=(const CFunc &cfunc)
 {
-    _cfunc = cfunc;
-    _stlFunc = nullptr;
+    Reset();
+    Store(cfunc);
 
     return *this;
 }
 
 
 template <typename Rtn, typename ...Args>
-LLBC_Delegate<Rtn(Args...)> &LLBC_Delegate<Rtn(Args...)>::operator=(StlFunc &&stlFunc) noexcept
+LLBC_Delegate<Rtn(Args...)> &LLBC_Delegate<Rtn(Args...)>::operator=(StlFunc &&stlFunc)
 {
-    _cfunc = nullptr;
-    _stlFunc = std::move(stlFunc);
+    Reset();
+    Store(std::move(stlFunc));
 
     return *this;
 }
@@ -148,8 +160,8 @@ LLBC_Delegate<Rtn(Args...)> &LLBC_Delegate<Rtn(Args...)>::operator=(StlFunc &&st
 template <typename Rtn, typename ...Args>
 LLBC_Delegate<Rtn(Args...)> &LLBC_Delegate<Rtn(Args...)>::operator=(const StlFunc &stlFunc)
 {
-    _cfunc = nullptr;
-    _stlFunc = stlFunc;
+    Reset();
+    Store(stlFunc);
 
     return *this;
 }
@@ -160,17 +172,8 @@ LLBC_Delegate<Rtn(Args...)> &LLBC_Delegate<Rtn(Args...)>::operator=(LLBC_Delegat
     if (UNLIKELY(&another == this))
         return *this;
 
-    if (another._cfunc)
-    {
-        _cfunc = another._cfunc;
-        another._cfunc = nullptr;
-        _stlFunc = nullptr;
-    }
-    else
-    {
-        _stlFunc = std::move(another._stlFunc);
-        _cfunc = nullptr;
-    }
+    Reset();
+    MoveFrom(another);
 
     return *this;
 }
@@ -181,29 +184,161 @@ LLBC_Delegate<Rtn(Args...)> &LLBC_Delegate<Rtn(Args...)>::operator=(const LLBC_D
     if (UNLIKELY(&another == this))
         return *this;
 
-    if (another._cfunc)
+    Reset();
+    CopyFrom(another);
+
+    return *this;
+}
+
+template <typename Rtn, typename ...Args>
+template <typename Func>
+typename std::enable_if<!std::is_same<Func, LLBC_Delegate<Rtn(Args...)> >::value, LLBC_Delegate<Rtn(Args...)> &>::type
+LLBC_Delegate<Rtn(Args...)>::operator=(const Func &func)
+{
+    Reset();
+    Store(func);
+
+    return *this;
+}
+
+template <typename Rtn, typename ...Args>
+template <typename Func>
+constexpr bool LLBC_Delegate<Rtn(Args...)>::_IsInlineStorable()
+{
+    // Inline stored callable object must be nothrow move constructible, to keep delegate move noexcept.
+    return sizeof(Func) <= sizeof(_storage) &&
+           alignof(Func) <= alignof(void *) &&
+           std::is_nothrow_move_constructible<Func>::value;
+}
+
+template <typename Rtn, typename ...Args>
+template <typename Func>
+void LLBC_Delegate<Rtn(Args...)>::Store(Func &&func)
+{
+    typedef typename std::decay<Func>::type _Func;
+    if (IsNullFunc<_Func>(func))
+        return;
+
+    if constexpr (_IsInlineStorable<_Func>())
     {
-        _cfunc = another._cfunc;
-        _stlFunc = nullptr;
+        new (_storage) _Func(std::forward<Func>(func));
+        _manager = std::is_trivially_copyable<_Func>::value ? nullptr : &ManageInline<_Func>;
+        _invoker = &InvokeInline<_Func>;
     }
     else
     {
-        _cfunc = nullptr;
-        _stlFunc = another._stlFunc;
+        *reinterpret_cast<_Func **>(_storage) = new _Func(std::forward<Func>(func));
+        _manager = &ManageHeap<_Func>;
+        _invoker = &InvokeHeap<_Func>;
     }
+}
 
-    return *this;
+template <typename Rtn, typename ...Args>
+void LLBC_Delegate<Rtn(Args...)>::CopyFrom(const LLBC_Delegate &another)
+{
+    if (another._manager)
+        another._manager(_Copy, _storage, const_cast<uint8 *>(another._storage));
+    else if (another._invoker)
+        memcpy(_storage, another._storage, sizeof(_storage));
+
+    _manager = another._manager;
+    _invoker = another._invoker;
+}
+
+template <typename Rtn, typename ...Args>
+void LLBC_Delegate<Rtn(Args...)>::MoveFrom(LLBC_Delegate &another)
+{
+    if (another._manager)
+        another._manager(_Move, _storage, another._storage);
+    else if (another._invoker)
+        memcpy(_storage, another._storage, sizeof(_storage));
+
+    _manager = another._manager;
+    _invoker = another._invoker;
+
+    another._manager = nullptr;
+    another._invoker = nullptr;
+}
+
+template <typename Rtn, typename ...Args>
+void LLBC_Delegate<Rtn(Args...)>::Reset()
+{
+    if (_manager)
+    {
+        _manager(_Destroy, _storage, nullptr);
+        _manager = nullptr;
+    }
+
+    _invoker = nullptr;
 }
 
 template <typename Rtn, typename ...Args>
 template <typename Func>
-typename std::enable_if<!std::is_same<Func, LLBC_Delegate<Rtn(Args...)> >::value, LLBC_Delegate<Rtn(Args...)> &>::type
-LLBC_Delegate<Rtn(Args...)>::operator=(const Func &func)
+bool LLBC_Delegate<Rtn(Args...)>::IsNullFunc(const Func &func)
+{
+    if constexpr (std::is_pointer<Func>::value || std::is_member_pointer<Func>::value)
+        return func == nullptr;
+    else if constexpr (std::is_constructible<bool, const Func &>::value)
+        return !static_cast<bool>(func);
+    else
+        return false;
+}
+
+template <typename Rtn, typename ...Args>
+template <typename Func>
+Rtn LLBC_Delegate<Rtn(Args...)>::InvokeInline(const void *storage, Args &&...args)
 {
-    _cfunc = nullptr;
-    _stlFunc = func;
+    return Invoke(*const_cast<Func *>(reinterpret_cast<const Func *>(storage)), std::forward<Args>(args)...);
+}
 
-    return *this;
+template <typename Rtn, typename ...Args>
+template <typename Func>
+Rtn LLBC_Delegate<Rtn(Args...)>::InvokeHeap(const void *storage, Args &&...args)
+{
+    return Invoke(**reinterpret_cast<Func * const *>(storage), std::forward<Args>(args)...);
+}
+
+template <typename Rtn, typename ...Args>
+template <typename Func>
+Rtn LLBC_Delegate<Rtn(Args...)>::Invoke(Func &func, Args &&...args)
+{
+    // Discard callable object return value if delegate return void.
+    if constexpr (std::is_void<Rtn>::value)
+        func(std::forward<Args>(args)...);
+    else
+        return func(std::forward<Args>(args)...);
+}
+
+template <typename Rtn, typename ...Args>
+template <typename Func>
+void LLBC_Delegate<Rtn(Args...)>::ManageInline(_ManageOp op, void *storage, void *another)
+{
+    if (op == _Copy)
+    {
+        new (storage) Func(*reinterpret_cast<const Func *>(another));
+    }
+    else if (op == _Move)
+    {
+        Func *anotherFunc = reinterpret_cast<Func *>(another);
+        new (storage) Func(std::move(*anotherFunc));
+        anotherFunc->~Func();
+    }
+    else // _Destroy
+    {
+        reinterpret_cast<Func *>(storage)->~Func();
+    }
+}
+
+template <typename Rtn, typename ...Args>
+template <typename Func>
+void LLBC_Delegate<Rtn(Args...)>::ManageHeap(_ManageOp op, void *storage, void *another)
+{
+    if (op == _Copy)
+        *reinterpret_cast<Func **>(storage) = new Func(**reinterpret_cast<Func **>(another));
+    else if (op == _Move)
+        *reinterpret_cast<Func **>(storage) = *reinterpret_cast<Func **>(another);
+    else // _Destroy
+        delete *reinterpret_cast<Func **>(storage);
 }
 
 __LLBC_NS_END
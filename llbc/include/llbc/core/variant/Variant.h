@@ -22,6 +22,7 @@
 #pragma once
 
 #include "llbc/common/Common.h"
+#include "llbc/core/algo/OrderedHashMap.h"
 
 __LLBC_NS_BEGIN
 
@@ -144,14 +145,57 @@ public:
     typedef Seq::reverse_iterator SeqReverseIter;
     typedef Seq::const_reverse_iterator SeqConstReverseIter;
 
-    typedef std::map<LLBC_Variant, LLBC_Variant> Dict;
+    /**
+     * \brief The hash dict key hasher/key equal functor.
+     *        Integral float/double key hash value equal to the integer key hash value,
+     *        and only same first type keys are considered equal(str key not equal to raw key).
+     */
+    struct LLBC_EXPORT DictKeyHash
+    {
+        size_t operator()(const LLBC_Variant &key) const noexcept;
+    };
+
+    struct LLBC_EXPORT DictKeyEqual
+    {
+        bool operator()(const LLBC_Variant &left, const LLBC_Variant &right) const;
+    };
+
+    typedef std::map<LLBC_Variant, LLBC_Variant> MapDict;
+    typedef LLBC_OrderedHashMap<LLBC_Variant, LLBC_Variant, DictKeyHash, DictKeyEqual> HashDict;
+
+    #if LLBC_CFG_CORE_VARIANT_HASH_DICT
+    typedef HashDict Dict;
+    #else // !LLBC_CFG_CORE_VARIANT_HASH_DICT
+    typedef MapDict Dict;
+    #endif // LLBC_CFG_CORE_VARIANT_HASH_DICT
     typedef Dict::iterator DictIter;
     typedef Dict::const_iterator DictConstIter;
     typedef Dict::reverse_iterator DictReverseIter;
     typedef Dict::const_reverse_iterator DictConstReverseIter;
 
+    /**
+     * \brief The variant data holder.
+     *        The str/seq/dict object is stored in ref-counted shared payload, if enabled
+     *        LLBC_CFG_CORE_VARIANT_COPY_ON_WRITE, copy holder only share the payload, and
+     *        the payload will be copied when call non-const object accessor(GetStr/GetSeq/GetDict).
+     *        Note: The mutable object reference(or iterator) fetched from variant will be
+     *              invalidated when the variant copied, don't hold it across variant copy.
+     */
     struct LLBC_EXPORT Holder
     {
+        /**
+         * \brief The ref-counted shared object payload.
+         */
+        template <typename _Obj>
+        struct SharedObj
+        {
+            volatile sint32 refCount;
+            _Obj obj;
+
+            template <typename... _Args>
+            explicit SharedObj(_Args &&... args) : refCount(1), obj(std::forward<_Args>(args)...) {  }
+        };
+
         LLBC_VariantType::ENUM type;
 
         union DataType
@@ -165,13 +209,10 @@ public:
 
             union ObjType
             {
-                Str str;
-                Dict dict;
-                Seq seq;
+                SharedObj<Str> *str;
+                SharedObj<Dict> *dict;
+                SharedObj<Seq> *seq;
             } obj;
-
-            DataType() {}
-            ~DataType() {};
         } data;
 
         Holder() : type(LLBC_VariantType::NIL) { data.raw.uint64Val = 0; }
@@ -227,8 +268,39 @@ public:
 
         void Reset();
 
+        /**
+         * Get str/seq/dict object, holder type must be STR_DFT/SEQ_DFT/DICT_DFT.
+         * Non-const version will copy the shared payload first if payload is shared.
+         */
+        const Str &GetStr() const;
+        Str &GetStr();
+        const Seq &GetSeq() const;
+        Seq &GetSeq();
+        const Dict &GetDict() const;
+        Dict &GetDict();
+
+        /**
+         * Init str/seq/dict object, holder type must be STR_DFT/SEQ_DFT/DICT_DFT and object not init.
+         */
+        template <typename... _Args>
+        Str &InitStr(_Args &&... args);
+        template <typename... _Args>
+        Seq &InitSeq(_Args &&... args);
+        template <typename... _Args>
+        Dict &InitDict(_Args &&... args);
+
+        /**
+         * Check str/seq/dict object payload is shared or not.
+         */
+        bool IsShared() const;
+
     private:
         friend class LLBC_Variant;
+
+        // Share/Copy object payload from other holder(holder type must be object type).
+        void ShareObj(const Holder &other);
+        // Copy shared object payload, make payload owned by this holder only.
+        void DetachObj();
     };
 
 public:
@@ -602,6 +674,10 @@ public:
     void Serialize(LLBC_Stream &stream) const;
     bool Deserialize(LLBC_Stream &stream);
 
+    // Compact binary encoding Serialize / Deserialize support(see LLBC_VariantView).
+    void SerializeCompact(LLBC_Stream &stream) const;
+    bool DeserializeCompact(LLBC_Stream &stream);
+
 public:
     friend std::ostream &::operator<<(std::ostream &o, const LLBC_Variant &variant);
 
@@ -106,75 +106,75 @@ LLBC_Variant::Holder::Holder(const _T &en) : type(LLBC_VariantType::RAW_SINT64)
 
 inline LLBC_Variant::Holder::Holder(const char *str) : type(LLBC_VariantType::STR_DFT)
 {
-    new (&data.obj.str) Str(str);
+    InitStr(str);
 }
 
 inline LLBC_Variant::Holder::Holder(const std::string &str) : type(LLBC_VariantType::STR_DFT)
 {
-    new (&data.obj.str) Str(str);
+    InitStr(str);
 }
 
 inline LLBC_Variant::Holder::Holder(const LLBC_String &str) : type(LLBC_VariantType::STR_DFT)
 {
-    new (&data.obj.str) Str(str);
+    InitStr(str);
 }
 
 inline LLBC_Variant::Holder::Holder(const LLBC_CString &str) : type(LLBC_VariantType::STR_DFT)
 {
-    new (&data.obj.str) Str(str);
+    InitStr(str);
 }
 
 template <typename _T1, typename _T2>
 LLBC_Variant::Holder::Holder(const std::pair<_T1, _T2> &pa) : type(LLBC_VariantType::SEQ_DFT)
 {
-    new (&data.obj.seq) Seq();
-    data.obj.seq.emplace_back(pa.first);
-    data.obj.seq.emplace_back(pa.second);
+    InitSeq();
+    GetSeq().emplace_back(pa.first);
+    GetSeq().emplace_back(pa.second);
 }
 
 inline LLBC_Variant::Holder::Holder(const Seq &seq) : type(LLBC_VariantType::SEQ_DFT)
 {
-    new (&data.obj.seq) Seq(seq);
+    InitSeq(seq);
 }
 
 template <typename _T>
 LLBC_Variant::Holder::Holder(const std::vector<_T> &vec) : type(LLBC_VariantType::SEQ_DFT)
 {
-    new (&data.obj.seq) Seq();
+    InitSeq();
     for (const auto &elem : vec)
     {
-        data.obj.seq.emplace_back(elem);
+        GetSeq().emplace_back(elem);
     }
 }
 
 template <typename _T>
 LLBC_Variant::Holder::Holder(const std::list<_T> &lst) : type(LLBC_VariantType::SEQ_DFT)
 {
-    new (&data.obj.seq) Seq();
+    InitSeq();
     for (const auto &elem : lst)
     {
-        data.obj.seq.emplace_back(elem);
+        GetSeq().emplace_back(elem);
     }
 }
 
 template <typename _T>
 LLBC_Variant::Holder::Holder(const std::deque<_T> &dqe) : type(LLBC_VariantType::SEQ_DFT)
 {
-    new (&data.obj.seq) Seq();
+    InitSeq();
     for (const auto &elem : dqe)
     {
-        data.obj.seq.emplace_back(elem);
+        GetSeq().emplace_back(elem);
     }
 }
 
 template <typename _T>
 LLBC_Variant::Holder::Holder(const std::queue<_T> &que) : type(LLBC_VariantType::SEQ_DFT)
 {
-    new (&data.obj.seq) Seq();
+    InitSeq();
     std::queue<_T> tempQue = que;
     while (!tempQue.empty())
     {
-        data.obj.seq.emplace_back(tempQue.front());
+        GetSeq().emplace_back(tempQue.front());
         tempQue.pop();
     }
 }
@@ -182,48 +182,116 @@ LLBC_Variant::Holder::Holder(const std::queue<_T> &que) : type(LLBC_VariantType:
 template <typename _T>
 LLBC_Variant::Holder::Holder(const std::set<_T> &s) : type(LLBC_VariantType::SEQ_DFT)
 {
-    new (&data.obj.seq) Seq();
+    InitSeq();
     for (const auto &elem : s)
     {
-        data.obj.seq.emplace_back(elem);
+        GetSeq().emplace_back(elem);
     }
 }
 
 template <typename _T>
 LLBC_Variant::Holder::Holder(const std::unordered_set<_T> &us) : type(LLBC_VariantType::SEQ_DFT)
 {
-    new (&data.obj.seq) Seq();
+    InitSeq();
     for (const auto &elem : us)
     {
-        data.obj.seq.emplace_back(elem);
+        GetSeq().emplace_back(elem);
     }
 }
 
 inline LLBC_Variant::Holder::Holder(const Dict &dict) : type(LLBC_VariantType::DICT_DFT)
 {
-    new (&data.obj.dict) Dict(dict);
+    InitDict(dict);
 }
 
 template <typename _Key, typename _Val>
 LLBC_Variant::Holder::Holder(const std::map<_Key, _Val> &m) : type(LLBC_VariantType::DICT_DFT)
 {
-    new (&data.obj.dict) Dict();
+    InitDict();
     for (const auto &pair : m)
     {
-        data.obj.dict.emplace(LLBC_Variant(pair.first), LLBC_Variant(pair.second));
+        GetDict().emplace(LLBC_Variant(pair.first), LLBC_Variant(pair.second));
     }
 }
 
 template <typename _Key, typename _Val>
 LLBC_Variant::Holder::Holder(const std::unordered_map<_Key, _Val> &um) : type(LLBC_VariantType::DICT_DFT)
 {
-    new (&data.obj.dict) Dict();
+    InitDict();
     for (const auto &pair : um)
     {
-        data.obj.dict.emplace(LLBC_Variant(pair.first), LLBC_Variant(pair.second));
+        GetDict().emplace(LLBC_Variant(pair.first), LLBC_Variant(pair.second));
     }
 }
 
+inline const LLBC_Variant::Str &LLBC_Variant::Holder::GetStr() const
+{
+    return data.obj.str->obj;
+}
+
+inline LLBC_Variant::Str &LLBC_Variant::Holder::GetStr()
+{
+    if (UNLIKELY(data.obj.str->refCount != 1))
+        DetachObj();
+    return data.obj.str->obj;
+}
+
+inline const LLBC_Variant::Seq &LLBC_Variant::Holder::GetSeq() const
+{
+    return data.obj.seq->obj;
+}
+
+inline LLBC_Variant::Seq &LLBC_Variant::Holder::GetSeq()
+{
+    if (UNLIKELY(data.obj.seq->refCount != 1))
+        DetachObj();
+    return data.obj.seq->obj;
+}
+
+inline const LLBC_Variant::Dict &LLBC_Variant::Holder::GetDict() const
+{
+    return data.obj.dict->obj;
+}
+
+inline LLBC_Variant::Dict &LLBC_Variant::Holder::GetDict()
+{
+    if (UNLIKELY(data.obj.dict->refCount != 1))
+        DetachObj();
+    return data.obj.dict->obj;
+}
+
+template <typename... _Args>
+LLBC_Variant::Str &LLBC_Variant::Holder::InitStr(_Args &&... args)
+{
+    data.obj.str = new SharedObj<Str>(std::forward<_Args>(args)...);
+    return data.obj.str->obj;
+}
+
+template <typename... _Args>
+LLBC_Variant::Seq &LLBC_Variant::Holder::InitSeq(_Args &&... args)
+{
+    data.obj.seq = new SharedObj<Seq>(std::forward<_Args>(args)...);
+    return data.obj.seq->obj;
+}
+
+template <typename... _Args>
+LLBC_Variant::Dict &LLBC_Variant::Holder::InitDict(_Args &&... args)
+{
+    data.obj.dict = new SharedObj<Dict>(std::forward<_Args>(args)...);
+    return data.obj.dict->obj;
+}
+
+inline bool LLBC_Variant::Holder::IsShared() const
+{
+    if (type == LLBC_VariantType::STR_DFT)
+        return data.obj.str->refCount != 1;
+    else if (type == LLBC_VariantType::SEQ_DFT)
+        return data.obj.seq->refCount != 1;
+    else if (type == LLBC_VariantType::DICT_DFT)
+        return data.obj.dict->refCount != 1;
+
+    return false;
+}
 
 inline LLBC_Variant::LLBC_Variant(const bool &b) : _holder(b)
 {
@@ -604,11 +672,11 @@ inline LLBC_Variant &LLBC_Variant::Become(LLBC_VariantType::ENUM ty)
 
         _holder.type = ty;
         if (ty == LLBC_VariantType::STR_DFT)
-            new (&_holder.data.obj.str) Str;
+            _holder.InitStr();
         else if (ty == LLBC_VariantType::SEQ_DFT)
-            new (&_holder.data.obj.seq) Seq;
+            _holder.InitSeq();
         else if (ty == LLBC_VariantType::DICT_DFT)
-            new (&_holder.data.obj.dict) Dict;
+            _holder.InitDict();
     }
 
     return *this;
@@ -737,13 +805,13 @@ template <>
 inline LLBC_Variant::operator char *() const
 {
     thread_local char emptyMutableEmptyStr[1] = {'\0'};
-    return IsStr() ? const_cast<char *>(_holder.data.obj.str.c_str()) : emptyMutableEmptyStr;
+    return IsStr() ? const_cast<char *>(_holder.GetStr().c_str()) : emptyMutableEmptyStr;
 }
 
 template <>
 inline LLBC_Variant::operator const char *() const
 {
-    return IsStr() ? _holder.data.obj.str.c_str() : "";
+    return IsStr() ? _holder.GetStr().c_str() : "";
 }
 
 inline LLBC_Variant::operator sint64() const
@@ -784,7 +852,7 @@ LLBC_Variant::operator std::pair<_T1, _T2>() const
     if (!IsSeq() || Size() < 2)
         return std::make_pair(_T1(), _T2());
 
-    const Seq &seq = _holder.data.obj.seq;
+    const Seq &seq = _holder.GetSeq();
     return std::make_pair<_T1, _T2>(seq[0], seq[1]);
 }
 
@@ -799,7 +867,7 @@ LLBC_Variant::operator std::vector<_ElemTy>() const
     std::vector<_ElemTy> v;
     if (IsSeq() && !IsEmpty())
     {
-        const Seq &seq = _holder.data.obj.seq;
+        const Seq &seq = _holder.GetSeq();
 
         v.reserve(seq.size());
         const SeqConstIter endIt = seq.end();
@@ -819,14 +887,14 @@ LLBC_Variant::operator std::set<_ElemTy>() const
 
     if (IsSeq())
     {
-        SeqConstIter endIt = _holder.data.obj.seq.end();
-        for (SeqConstIter it = _holder.data.obj.seq.begin(); it != endIt; ++it)
+        SeqConstIter endIt = _holder.GetSeq().end();
+        for (SeqConstIter it = _holder.GetSeq().begin(); it != endIt; ++it)
             s.insert(*it);
     }
     else if (IsDict())
     {
-        DictConstIter endIt = _holder.data.obj.dict.end();
-        for (DictConstIter it = _holder.data.obj.dict.begin(); it != endIt; ++it)
+        DictConstIter endIt = _holder.GetDict().end();
+        for (DictConstIter it = _holder.GetDict().begin(); it != endIt; ++it)
             s.insert(it->first);
     }
 
@@ -842,14 +910,14 @@ LLBC_Variant::operator std::unordered_set<_ElemTy>() const
 
     if (IsSeq())
     {
-        SeqConstIter endIt = _holder.data.obj.seq.end();
-        for (SeqConstIter it = _holder.data.obj.seq.begin(); it != endIt; ++it)
+        SeqConstIter endIt = _holder.GetSeq().end();
+        for (SeqConstIter it = _holder.GetSeq().begin(); it != endIt; ++it)
             us.insert(*it);
     }
     else if (IsDict())
     {
-        DictConstIter endIt = _holder.data.obj.dict.end();
-        for (DictConstIter it = _holder.data.obj.dict.begin(); it != endIt; ++it)
+        DictConstIter endIt = _holder.GetDict().end();
+        for (DictConstIter it = _holder.GetDict().begin(); it != endIt; ++it)
             us.insert(it->first);
     }
 
@@ -865,14 +933,14 @@ LLBC_Variant::operator std::queue<_ElemTy>() const
 
     if (IsSeq())
     {
-        SeqConstIter endIt = _holder.data.obj.seq.end();
-        for (SeqConstIter it = _holder.data.obj.seq.begin(); it != endIt; ++it)
+        SeqConstIter endIt = _holder.GetSeq().end();
+        for (SeqConstIter it = _holder.GetSeq().begin(); it != endIt; ++it)
             q.push(*it);
     }
     else if (IsDict())
     {
-        DictConstIter endIt = _holder.data.obj.dict.end();
-        for (DictConstIter it = _holder.data.obj.dict.begin(); it != endIt; ++it)
+        DictConstIter endIt = _holder.GetDict().end();
+        for (DictConstIter it = _holder.GetDict().begin(); it != endIt; ++it)
             q.push(*it);
     }
 
@@ -888,14 +956,14 @@ LLBC_Variant::operator std::deque<_Ty>() const
 
     if (IsSeq())
     {
-        SeqConstIter endIt = _holder.data.obj.seq.end();
-        for (SeqConstIter it = _holder.data.obj.seq.begin(); it != endIt; ++it)
+        SeqConstIter endIt = _holder.GetSeq().end();
+        for (SeqConstIter it = _holder.GetSeq().begin(); it != endIt; ++it)
             dq.push_back(*it);
     }
     else if (IsDict())
     {
-        DictConstIter endIt = _holder.data.obj.dict.end();
-        for (DictConstIter it = _holder.data.obj.dict.begin(); it != endIt; ++it)
+        DictConstIter endIt = _holder.GetDict().end();
+        for (DictConstIter it = _holder.GetDict().begin(); it != endIt; ++it)
             dq.push_back(*it);
     }
 
@@ -929,12 +997,19 @@ LLBC_Variant::operator std::unordered_map<_Key, _Val>() const
 
 inline void LLBC_Variant::Clear()
 {
-    if (IsStr())
-        _holder.data.obj.str.clear();
+    // Shared payload, don't copy it, just release it and become empty str/seq/dict.
+    if (_holder.IsShared())
+    {
+        const LLBC_VariantType::ENUM ty = _holder.type;
+        _holder.Reset();
+        Become(ty);
+    }
+    else if (IsStr())
+        _holder.GetStr().clear();
     else if (IsSeq())
-        _holder.data.obj.seq.clear();
+        _holder.GetSeq().clear();
     else if (IsDict())
-        _holder.data.obj.dict.clear();
+        _holder.GetDict().clear();
     else if (IsRaw())
         _holder.data.raw.int64Val = 0;
 }
@@ -1049,10 +1124,10 @@ template <typename _T1, typename _T2>
 LLBC_Variant &LLBC_Variant::operator=(const std::pair<_T1, _T2> &pa)
 {
     BecomeSeq();
-    _holder.data.obj.seq.clear();
+    _holder.GetSeq().clear();
 
-    _holder.data.obj.seq.emplace_back(pa.first);
-    _holder.data.obj.seq.emplace_back(pa.second);
+    _holder.GetSeq().emplace_back(pa.first);
+    _holder.GetSeq().emplace_back(pa.second);
 
     return *this;
 }
@@ -1320,7 +1395,7 @@ void LLBC_Variant::CtFromUnaryCont(const _UnaryContainer &unaryCont)
     BecomeSeq();
 
     // clear members.
-    Seq &seq = _holder.data.obj.seq;
+    Seq &seq = _holder.GetSeq();
     seq.clear();
 
     // if giving unary container is empty, return.
@@ -1346,7 +1421,7 @@ void LLBC_Variant::CtFromBinaryCont(const _BinaryContainer &binaryCont)
     BecomeDict();
 
     // clear members.
-    Dict &dict = _holder.data.obj.dict;
+    Dict &dict = _holder.GetDict();
     dict.clear();
 
     // if giving binary container is empty, return.
@@ -1364,8 +1439,8 @@ void LLBC_Variant::CtFromBinaryCont(const _BinaryContainer &binaryCont)
 template <typename _Key, typename _Val, typename _BinaryContainer>
 void LLBC_Variant::CpToBinaryCont(_BinaryContainer &binaryCont) const
 {
-    const DictConstIter endIt = _holder.data.obj.dict.end();
-    for (DictConstIter it = _holder.data.obj.dict.begin(); it != endIt; ++it)
+    const DictConstIter endIt = _holder.GetDict().end();
+    for (DictConstIter it = _holder.GetDict().begin(); it != endIt; ++it)
         binaryCont.emplace(it->first, it->second);
 }
 
@@ -1380,7 +1455,7 @@ _64Ty LLBC_Variant::AsSignedOrUnsigned64() const
 
     if (firstType == LLBC_VariantType::STR)
     {
-        const Str &str = _holder.data.obj.str;
+        const Str &str = _holder.GetStr();
         if (str.empty())
             return 0;
 
@@ -1458,13 +1533,13 @@ struct hash<LLBC_NS LLBC_Variant>
         }
         else if (var.IsStr())
         {
-            const LLBC_NS LLBC_Variant::Str &str = var.GetHolder().data.obj.str;
+            const LLBC_NS LLBC_Variant::Str &str = var.GetHolder().GetStr();
             return !str.empty() ? LLBC_NS LLBC_Hash(str.data(), str.size()) : LLBC_NS LLBC_Hash(nullptr, 0);
         }
         else if (var.IsSeq())
         {
             size_t hashVal = 10000;
-            const LLBC_NS LLBC_Variant::Seq &seq = var.GetHolder().data.obj.seq;
+            const LLBC_NS LLBC_Variant::Seq &seq = var.GetHolder().GetSeq();
             if (seq.empty())
                 return hashVal;
 
@@ -1479,7 +1554,7 @@ struct hash<LLBC_NS LLBC_Variant>
         else if (var.IsDict())
         {
             size_t hashVal = 20000;
-            const LLBC_NS LLBC_Variant::Dict &dict = var.GetHolder().data.obj.dict;
+            const LLBC_NS LLBC_Variant::Dict &dict = var.GetHolder().GetDict();
             if (dict.empty())
                 return hashVal;
 
@@ -0,0 +1,184 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2013 lailongwei<lailongwei@126.com>
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of 
+// this software and associated documentation files (the "Software"), to deal in 
+// the Software without restriction, including without limitation the rights to 
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of 
+// the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS 
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER 
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN 
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+#include "llbc/core/variant/Variant.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The variant compact binary encoding read-only view.
+ *
+ *        Compact encoding(LLBC_Variant::SerializeCompact/DeserializeCompact) layout:
+ *          - header: [magic:1][version:1][key count:varint][key offsets:uint32le * key count][keys]
+ *                    key: [len:varint][bytes], dict str keys appears more than once will be interned
+ *                    to key table, and referenced by key index.
+ *          - value:  [tag:1][payload]
+ *                    nil/bool:   no payload
+ *                    integer:    varint(signed integer zigzag encoded)
+ *                    float:      4 bytes(little endian)
+ *                    double:     8 bytes(little endian)
+ *                    str:        [len:varint][bytes], len < 32 str length inlined in tag
+ *                    key ref:    [key index:varint]
+ *                    seq:        [count:varint][body size:uint32le][elems]
+ *                    dict:       [count:varint][body size:uint32le][key, val pairs]
+ *
+ *        View navigate the encoded buffer lazily, never materialize the whole variant tree,
+ *        view only reference the buffer, don't use view(and sub views) after buffer released.
+ *        Navigating failed(eg: type mismatch, key not found, malformed buffer) return invalid view.
+ */
+class LLBC_EXPORT LLBC_VariantView
+{
+public:
+    /**
+     * Create invalid view.
+     */
+    LLBC_VariantView();
+
+    /**
+     * Create view from compact encoded buffer.
+     * @param[in] buf  - the compact encoded buffer.
+     * @param[in] size - the buffer size.
+     */
+    LLBC_VariantView(const void *buf, size_t size);
+
+public:
+    /**
+     * Encode variant to stream, use compact encoding.
+     * @param[in] var    - the variant.
+     * @param[in] stream - the stream.
+     */
+    static void Encode(const LLBC_Variant &var, LLBC_Stream &stream);
+
+public:
+    /**
+     * Check view is valid or not.
+     * @return bool - return true if valid, otherwise return false.
+     */
+    bool IsValid() const;
+
+    /**
+     * Get view value encoded size, if is root view, included header size.
+     * @return size_t - the encoded size, if view invalid or buffer malformed, return 0.
+     */
+    size_t GetEncodedSize() const;
+
+public:
+    /**
+     * Type check methods, invalid view's type is NIL.
+     */
+    LLBC_VariantType::ENUM GetType() const;
+    LLBC_VariantType::ENUM GetFirstType() const;
+    bool IsNil() const;
+    bool IsRaw() const;
+    bool IsStr() const;
+    bool IsSeq() const;
+    bool IsDict() const;
+
+    /**
+     * Get str length, or seq/dict element count, other types return 0.
+     */
+    size_t Size() const;
+
+    /**
+     * Value fetch methods, same semantics as LLBC_Variant::AsXXX().
+     * Note: AsStr() only return str view of buffer, the returned str view is not NULL-terminated.
+     *       non-str view return empty str view.
+     */
+    bool AsBool() const;
+    sint32 AsInt32() const;
+    uint32 AsUInt32() const;
+    sint64 AsInt64() const;
+    uint64 AsUInt64() const;
+    double AsDouble() const;
+    LLBC_CString AsStr() const;
+
+public:
+    /**
+     * Get seq element view.
+     * @param[in] idx - the element index.
+     * @return LLBC_VariantView - the element view, if not seq or index out of range, return invalid view.
+     */
+    LLBC_VariantView SeqAt(size_t idx) const;
+
+    /**
+     * Find dict value view by key.
+     * @param[in] key - the dict key.
+     * @return LLBC_VariantView - the value view, if not dict or key not found, return invalid view.
+     */
+    LLBC_VariantView DictFind(const LLBC_CString &key) const;
+    LLBC_VariantView DictFind(sint64 key) const;
+    LLBC_VariantView operator[](const LLBC_CString &key) const;
+
+    /**
+     * Foreach seq elements/dict key-value pairs.
+     * seq func signature:  void(const LLBC_VariantView &elem).
+     * dict func signature: void(const LLBC_VariantView &key, const LLBC_VariantView &val).
+     * @return bool - return false if not seq/dict or buffer malformed.
+     */
+    template <typename _Func>
+    bool SeqForeach(_Func &&func) const;
+    template <typename _Func>
+    bool DictForeach(_Func &&func) const;
+
+public:
+    /**
+     * Materialize view to variant.
+     * @param[out] var - the variant.
+     * @return bool - return true if success, otherwise return false(buffer malformed).
+     */
+    bool ToVariant(LLBC_Variant &var) const;
+
+private:
+    // Create sub view.
+    LLBC_VariantView(const LLBC_VariantView &root, size_t valOff);
+
+    // Parse header, return false if malformed.
+    bool ParseHeader();
+
+    // Get value tag, if view invalid or malformed, return 0xff.
+    uint8 GetTag() const;
+    // Parse seq/dict, fetch element count and body range.
+    bool ParseContainer(size_t &count, size_t &bodyBegin, size_t &bodyEnd) const;
+    // Skip value at given offset, return the next value offset, return 0 if malformed.
+    size_t SkipValue(size_t off) const;
+    // Get str(included key ref) value.
+    bool GetStrValue(size_t off, LLBC_CString &str) const;
+    // Decode scalar value to variant(not support seq/dict).
+    bool ToScalarVariant(LLBC_Variant &var) const;
+
+private:
+    const uint8 *_buf;
+    size_t _size;
+
+    uint32 _keyCount;
+    size_t _keyOffsetsOff;
+    size_t _keysOff;
+
+    size_t _valOff;
+    bool _root;
+};
+
+__LLBC_NS_END
+
+#include "llbc/core/variant/VariantViewInl.h"
@@ -0,0 +1,119 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2013 lailongwei<lailongwei@126.com>
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of 
+// this software and associated documentation files (the "Software"), to deal in 
+// the Software without restriction, including without limitation the rights to 
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of 
+// the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS 
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER 
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN 
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#pragma once
+
+__LLBC_NS_BEGIN
+
+inline bool LLBC_VariantView::IsValid() const
+{
+    return _buf != nullptr;
+}
+
+inline bool LLBC_VariantView::IsNil() const
+{
+    return GetType() == LLBC_VariantType::NIL;
+}
+
+inline bool LLBC_VariantView::IsRaw() const
+{
+    return GetFirstType() == LLBC_VariantType::RAW;
+}
+
+inline bool LLBC_VariantView::IsStr() const
+{
+    return GetFirstType() == LLBC_VariantType::STR;
+}
+
+inline bool LLBC_VariantView::IsSeq() const
+{
+    return GetFirstType() == LLBC_VariantType::SEQ;
+}
+
+inline bool LLBC_VariantView::IsDict() const
+{
+    return GetFirstType() == LLBC_VariantType::DICT;
+}
+
+inline LLBC_VariantType::ENUM LLBC_VariantView::GetFirstType() const
+{
+    return static_cast<LLBC_VariantType::ENUM>(GetType() & LLBC_VariantType::MASK_FIRST_TYPE);
+}
+
+inline LLBC_VariantView LLBC_VariantView::operator[](const LLBC_CString &key) const
+{
+    return DictFind(key);
+}
+
+template <typename _Func>
+bool LLBC_VariantView::SeqForeach(_Func &&func) const
+{
+    if (!IsSeq())
+        return false;
+
+    size_t count, bodyBegin, bodyEnd;
+    if (!ParseContainer(count, bodyBegin, bodyEnd))
+        return false;
+
+    size_t off = bodyBegin;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const size_t nextOff = SkipValue(off);
+        if (nextOff == 0 || nextOff > bodyEnd)
+            return false;
+
+        func(LLBC_VariantView(*this, off));
+        off = nextOff;
+    }
+
+    return true;
+}
+
+template <typename _Func>
+bool LLBC_VariantView::DictForeach(_Func &&func) const
+{
+    if (!IsDict())
+        return false;
+
+    size_t count, bodyBegin, bodyEnd;
+    if (!ParseContainer(count, bodyBegin, bodyEnd))
+        return false;
+
+    size_t off = bodyBegin;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const size_t valOff = SkipValue(off);
+        if (valOff == 0 || valOff > bodyEnd)
+            return false;
+
+        const size_t nextOff = SkipValue(valOff);
+        if (nextOff == 0 || nextOff > bodyEnd)
+            return false;
+
+        func(LLBC_VariantView(*this, off), LLBC_VariantView(*this, valOff));
+        off = nextOff;
+    }
+
+    return true;
+}
+
+__LLBC_NS_END
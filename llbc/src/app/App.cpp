@@ -72,6 +72,7 @@ LLBC_App::LLBC_App()
 , _services(*LLBC_ServiceMgrSingleton)
 
 , _loading(0)
+, _cfgSnapshot(new LLBC_AppConfigSnapshot(LLBC_AppConfigType::End, LLBC_Variant::nil, 0))
 , _cfgType(LLBC_AppConfigType::End)
 {
     llbc_assert(!_thisApp && "Not allow create more than one application object");
@@ -118,10 +119,7 @@ bool LLBC_App::HasConfig() const
 
 LLBC_Variant LLBC_App::GetConfig() const
 {
-    LLBC_LockGuard guard(_loadLock);
-    LLBC_Variant cfg = _cfg;
-
-    return cfg;
+    return GetConfigSnapshot()->GetConfig();
 }
 
 LLBC_String LLBC_App::GetConfigPath() const
@@ -218,9 +216,9 @@ int LLBC_App::Start(int argc, char *argv[], const LLBC_String &name)
     // Define app start failed defer.
     int ret = LLBC_FAILED;
     LLBC_Defer(if (ret != LLBC_OK) {
-        _cfg.BecomeNil();
         _cfgPath.clear();
         _cfgType = LLBC_AppConfigType::End;
+        PublishConfigSnapshot(LLBC_Variant::nil);
 
         _name.clear();
 
@@ -427,7 +425,7 @@ void LLBC_App::Stop()
     // Cleanup members.
     _cfgPath.clear();
     _cfgType = LLBC_AppConfigType::End;
-    _cfg.BecomeNil();
+    PublishConfigSnapshot(LLBC_Variant::nil);
 
     _startThreadId = LLBC_INVALID_NATIVE_THREAD_ID;
 
@@ -609,12 +607,15 @@ int LLBC_App::ReloadImpl(bool checkAppStarted, bool callEvMeth)
             LLBC_LoggerMgrSingleton->Reload();
 
         // - Reload detail: Reload config.
+        // Config parsed to new variant, readers still read old snapshot until new snapshot published.
         LLBC_AtomicFetchAndAdd(&_loading, 1);
         LLBC_Defer(LLBC_AtomicFetchAndSub(&_loading, 1));
-        LLBC_ReturnIf(_cfgType != LLBC_AppConfigType::End && ReloadConfig() != LLBC_OK, LLBC_FAILED);
+        LLBC_Variant cfg;
+        LLBC_ReturnIf(_cfgType != LLBC_AppConfigType::End && ReloadConfig(cfg) != LLBC_OK, LLBC_FAILED);
+        PublishConfigSnapshot(cfg);
 
         // - Reload application fps.
-        for (auto cfgItem : _cfg.AsDict())
+        for (auto &cfgItem : cfg.AsDict())
         {
             if (_cfgType == LLBC_AppConfigType::Ini)
             {
@@ -622,7 +623,7 @@ int LLBC_App::ReloadImpl(bool checkAppStarted, bool callEvMeth)
                 if (sectionName != "app" && sectionName != "application")
                     break;
 
-                for (auto cfgSecItem : cfgItem.second.AsDict())
+                for (auto &cfgSecItem : cfgItem.second.AsDict())
                 {
                     if (cfgSecItem.first.AsStr().tolower() == "fps")
                     {
@@ -652,42 +653,45 @@ int LLBC_App::ReloadImpl(bool checkAppStarted, bool callEvMeth)
     if (callEvMeth)
     {
         OnReload();
+
+        // All services share the same config snapshot(copy-on-write variant, not deep copy).
+        const auto cfgSnapshot = GetConfigSnapshot();
         for (auto &svcId : _services.GetAllServiceIds())
         {
             auto svc = _services.GetService(svcId);
             LLBC_ContinueIf(!svc);
 
-            svc->Push(LLBC_SvcEvUtil::BuildAppReloadedEv(_cfgType, _cfg));
+            svc->Push(LLBC_SvcEvUtil::BuildAppReloadedEv(cfgSnapshot->GetConfigType(), cfgSnapshot->GetConfig()));
         }
     }
 
     return LLBC_OK;
 }
 
-int LLBC_App::ReloadConfig()
+int LLBC_App::ReloadConfig(LLBC_Variant &cfg)
 {
     // Check config file exist or not.
     LLBC_SetErrAndReturnIf(!LLBC_File::Exists(_cfgPath), LLBC_ERROR_NOT_FOUND, LLBC_FAILED);
 
     // Reload llbc framework supported config type files.
-    LLBC_DoIf(_cfgType == LLBC_AppConfigType::Ini, return ReloadIniConfig());
-    LLBC_DoIf(_cfgType == LLBC_AppConfigType::Xml, return ReloadXmlConfig());
-    LLBC_DoIf(_cfgType == LLBC_AppConfigType::Property, return ReloadPropertyConfig());
+    LLBC_DoIf(_cfgType == LLBC_AppConfigType::Ini, return ReloadIniConfig(cfg));
+    LLBC_DoIf(_cfgType == LLBC_AppConfigType::Xml, return ReloadXmlConfig(cfg));
+    LLBC_DoIf(_cfgType == LLBC_AppConfigType::Property, return ReloadPropertyConfig(cfg));
     
     LLBC_SetLastError(LLBC_ERROR_NOT_SUPPORT);
     return LLBC_FAILED;
 }
 
-int LLBC_App::ReloadIniConfig()
+int LLBC_App::ReloadIniConfig(LLBC_Variant &cfg)
 {
     LLBC_Ini ini;
     LLBC_ReturnIf(ini.LoadFromFile(_cfgPath) != LLBC_OK, LLBC_FAILED);
 
-    LLBC_VariantUtil::Ini2Variant(ini, _cfg);
+    LLBC_VariantUtil::Ini2Variant(ini, cfg);
     return LLBC_OK;
 }
 
-int LLBC_App::ReloadXmlConfig()
+int LLBC_App::ReloadXmlConfig(LLBC_Variant &cfg)
 {
     LLBC_TINYXML2_NS XMLDocument doc;
     const auto xmlLoadRet = doc.LoadFile(_cfgPath.c_str());
@@ -700,14 +704,22 @@ int LLBC_App::ReloadXmlConfig()
         return LLBC_FAILED;
     }
 
-    LLBC_VariantUtil::Xml2Variant(doc, _cfg);
+    LLBC_VariantUtil::Xml2Variant(doc, cfg);
     return LLBC_OK;
 }
 
-int LLBC_App::ReloadPropertyConfig()
+int LLBC_App::ReloadPropertyConfig(LLBC_Variant &cfg)
+{
+    cfg.BecomeNil();
+    return LLBC_Properties::LoadFromFile(_cfgPath, cfg);
+}
+
+void LLBC_App::PublishConfigSnapshot(const LLBC_Variant &cfg)
 {
-    _cfg.BecomeNil();
-    return LLBC_Properties::LoadFromFile(_cfgPath, _cfg);
+    const auto oldCfgSnapshot = std::atomic_load(&_cfgSnapshot);
+    LLBC_AppConfigSnapshotPtr newCfgSnapshot(
+        new LLBC_AppConfigSnapshot(_cfgType, cfg, oldCfgSnapshot->GetVersion() + 1));
+    std::atomic_store(&_cfgSnapshot, newCfgSnapshot);
 }
 
 void LLBC_App::HandleEvents()
@@ -770,8 +782,9 @@ void LLBC_App::FireAppPhaseChangeEvToServices(bool willStart,
     int cfgType = LLBC_AppConfigType::End;
     if (startFinished)
     {
-        cfg = _cfg;
-        cfgType = _cfgType;
+        const auto cfgSnapshot = GetConfigSnapshot();
+        cfg = cfgSnapshot->GetConfig();
+        cfgType = cfgSnapshot->GetConfigType();
     }
 
     for (auto &svcId : _services.GetAllServiceIds())
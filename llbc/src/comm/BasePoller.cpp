@@ -53,7 +53,9 @@ This::_Handler This::_handlers[LLBC_PollerEvent::End] =
     &This::HandleEv_Close,
     &This::HandleEv_Monitor,
     &This::HandleEv_TakeOverSession,
-    &This::HandleEv_CtrlProtocolStack
+    &This::HandleEv_CtrlProtocolStack,
+    &This::HandleEv_SharedSend,
+    &This::HandleEv_BatchSend
 };
 
 LLBC_BasePoller::LLBC_BasePoller()
@@ -63,6 +65,8 @@ LLBC_BasePoller::LLBC_BasePoller()
 , _brotherCount(0)
 , _svc(nullptr)
 , _pollerMgr(nullptr)
+, _recvBufPool(nullptr)
+, _reactorMode(false)
 {
 }
 
@@ -121,6 +125,21 @@ void LLBC_BasePoller::SetPollerMgr(LLBC_PollerMgr *mgr)
     _pollerMgr = mgr;
 }
 
+LLBC_RecvBufferPool *LLBC_BasePoller::GetRecvBufferPool() const
+{
+    return _recvBufPool;
+}
+
+void LLBC_BasePoller::SetRecvBufferPool(LLBC_RecvBufferPool *recvBufPool)
+{
+    _recvBufPool = recvBufPool;
+}
+
+void LLBC_BasePoller::SetReactorMode(bool reactorMode)
+{
+    _reactorMode = reactorMode;
+}
+
 int LLBC_BasePoller::Start()
 {
     llbc_assert(false && "Please implement LLBC_BasePoller::Start() method!");
@@ -150,7 +169,7 @@ void LLBC_BasePoller::Cleanup()
         block->Read(&ev, sizeof(LLBC_PollerEvent));
         LLBC_PollerEvUtil::DestroyEv(ev);
 
-        delete block;
+        LLBC_Recycle(block);
     }
 
     // Delete all sessions.
@@ -184,16 +203,21 @@ void LLBC_BasePoller::HandleQueuedEvents(int waitTime)
 
         (this->*_handlers[ev.type])(ev);
 
-        delete block;
+        LLBC_Recycle(block);
     }
 }
 
 void LLBC_BasePoller::HandleEv_AddSock(LLBC_PollerEvent &ev)
 {
-    AddSession(CreateSession(ev.un.socket,
-                             ev.sessionId,
-                             *ev.sessionOpts,
-                             nullptr));
+    LLBC_Session *session = CreateSession(ev.un.socket,
+                                          ev.sessionId,
+                                          *ev.sessionOpts,
+                                          nullptr);
+    // Reuse port listen sibling session, accept Id is the primary listen session Id.
+    if (ev.acceptSessionId != 0)
+        session->SetAcceptId(ev.acceptSessionId);
+
+    AddSession(session);
 
     LLBC_XDelete(ev.sessionOpts);
 }
@@ -219,6 +243,38 @@ void LLBC_BasePoller::HandleEv_Send(LLBC_PollerEvent &ev)
         session->OnClose();
 }
 
+void LLBC_BasePoller::HandleEv_SharedSend(LLBC_PollerEvent &ev)
+{
+    _Sessions::iterator it = _sessions.find(ev.sessionId);
+    if (it == _sessions.end())
+    {
+        LLBC_Recycle(ev.un.sharedSendInfo.frame);
+        return;
+    }
+
+    LLBC_Session *session = it->second;
+    if (UNLIKELY(session->IsListen()))
+        LLBC_Recycle(ev.un.sharedSendInfo.frame);
+    else if (UNLIKELY(session->SendSharedFrame(ev.un.sharedSendInfo.frame,
+                                               ev.un.sharedSendInfo.opcode,
+                                               ev.un.sharedSendInfo.status,
+                                               ev.un.sharedSendInfo.flags) != LLBC_OK))
+        session->OnClose();
+}
+
+void LLBC_BasePoller::HandleEv_BatchSend(LLBC_PollerEvent &ev)
+{
+    // Dispatch packets one by one, derived pollers can override this method to
+    // merge the per-session send operations.
+    _Ev sendEv;
+    sendEv.type = _Ev::Send;
+    for (int i = 0; i < ev.un.batchSendInfo.count; ++i)
+    {
+        sendEv.un.packet = ev.un.batchSendInfo.packets[i];
+        HandleEv_Send(sendEv);
+    }
+}
+
 void LLBC_BasePoller::HandleEv_Close(LLBC_PollerEvent &ev)
 {
     _Sessions::iterator it = _sessions.find(ev.sessionId);
@@ -286,15 +342,19 @@ LLBC_Session *LLBC_BasePoller::CreateSession(LLBC_Socket *socket,
                                              const LLBC_SessionOpts &sessionOpts,
                                              LLBC_Session *acceptSession)
 {
+    // If accepted from reuse port listen session, allocate sessionId which belong to this poller,
+    // let this poller own the accepted session.
     if (sessionId == 0)
-        sessionId = _pollerMgr->AllocSessionId();
+        sessionId = acceptSession && acceptSession->GetSessionOpts().IsReusePort() ?
+            _pollerMgr->AllocSessionId(_id) : _pollerMgr->AllocSessionId();
 
     LLBC_Session *session = new LLBC_Session(sessionOpts);
     session->SetId(sessionId);
     session->SetSocket(socket);
     socket->SetSession(session);
     if (acceptSession)
-        session->SetAcceptId(acceptSession->GetId());
+        session->SetAcceptId(acceptSession->GetAcceptId() != 0 ?
+                                 acceptSession->GetAcceptId() : acceptSession->GetId());
 
     session->SetService(_svc);
 
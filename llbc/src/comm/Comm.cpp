@@ -28,12 +28,19 @@ __LLBC_NS_BEGIN
 
 int __LLBC_CommStartup()
 {
+    // Initialize event block pool.
+    if (LLBC_EvBlockPool::Initialize() != LLBC_OK)
+        return LLBC_FAILED;
+
     return LLBC_OK;
 }
 
 void __LLBC_CommCleanup()
 {
     LLBC_ServiceMgrSingleton->StopAll(true, false);
+
+    // Finalize event block pool(after all services stopped).
+    LLBC_EvBlockPool::Finalize();
 }
 
 __LLBC_NS_END
@@ -32,6 +32,8 @@
 
 #if LLBC_TARGET_PLATFORM_LINUX || LLBC_TARGET_PLATFORM_ANDROID
 
+#include <sys/eventfd.h>
+
 namespace
 {
     typedef LLBC_NS LLBC_BasePoller Base;
@@ -42,12 +44,18 @@ __LLBC_NS_BEGIN
 LLBC_EpollPoller::LLBC_EpollPoller()
 : _epoll(LLBC_INVALID_HANDLE)
 , _monitor(nullptr)
+
+, _reactorWakeup(LLBC_INVALID_HANDLE)
+, _reactorWaiting(0)
 {
 }
 
 LLBC_EpollPoller::~LLBC_EpollPoller()
 {
     Stop();
+
+    // Wakeup eventfd closed on destruct, Push() may be called by other threads even if poller stopped.
+    CloseReactorWakeup();
 }
 
 int LLBC_EpollPoller::Start()
@@ -62,7 +70,7 @@ int LLBC_EpollPoller::Start()
             LLBC_CFG_EPOLL_MAX_LISTEN_FD_SIZE)) == LLBC_INVALID_HANDLE)
         return LLBC_FAILED;
 
-    if (StartupMonitor() != LLBC_OK)
+    if ((_reactorMode ? StartupReactorWakeup() : StartupMonitor()) != LLBC_OK)
     {
         LLBC_EpollClose(_epoll);
         _epoll = LLBC_INVALID_HANDLE;
@@ -94,6 +102,12 @@ void LLBC_EpollPoller::Stop()
 
 void LLBC_EpollPoller::Svc()
 {
+    if (_reactorMode)
+    {
+        ReactorSvc();
+        return;
+    }
+
     while (!_stopping)
         HandleQueuedEvents(20);
 }
@@ -108,6 +122,17 @@ void LLBC_EpollPoller::Cleanup()
     Base::Cleanup();
 }
 
+int LLBC_EpollPoller::Push(LLBC_MessageBlock *block)
+{
+    if (Base::Push(block) != LLBC_OK)
+        return LLBC_FAILED;
+
+    if (_reactorMode && LLBC_AtomicGet(&_reactorWaiting) != 0)
+        WakeupReactor();
+
+    return LLBC_OK;
+}
+
 void LLBC_EpollPoller::HandleEv_AddSock(LLBC_PollerEvent &ev)
 {
     Base::HandleEv_AddSock(ev);
@@ -171,72 +196,62 @@ void LLBC_EpollPoller::HandleEv_Send(LLBC_PollerEvent &ev)
     session->OnSend();
 }
 
-void LLBC_EpollPoller::HandleEv_Close(LLBC_PollerEvent &ev)
+void LLBC_EpollPoller::HandleEv_SharedSend(LLBC_PollerEvent &ev)
 {
-    Base::HandleEv_Close(ev);
+    const int sessionId = ev.sessionId;
+
+    Base::HandleEv_SharedSend(ev);
+
+    // In LINUX or ANDROID platform, if use EPOLL ET mode, we must force call OnSend() one time.
+    _Sessions::iterator it = _sessions.find(sessionId);
+    if (it == _sessions.end())
+        return;
+
+    LLBC_Session *&session = it->second;
+    session->OnSend();
 }
 
-void LLBC_EpollPoller::HandleEv_Monitor(LLBC_PollerEvent &ev)
+void LLBC_EpollPoller::HandleEv_BatchSend(LLBC_PollerEvent &ev)
 {
-    const int count = *reinterpret_cast<int *>(ev.un.monitorEv);
-    LLBC_EpollEvent *evs = 
-        reinterpret_cast<LLBC_EpollEvent *>(ev.un.monitorEv + sizeof(int));
-
-    for (int i = 0; i < count; ++i)
+    // Append all packets to sessions send buffer first.
+    _Ev sendEv;
+    sendEv.type = _Ev::Send;
+    _batchSendSessionIds.clear();
+    for (int i = 0; i < ev.un.batchSendInfo.count; ++i)
     {
-        const LLBC_EpollEvent &epev = evs[i];
-        const LLBC_SocketHandle handle = static_cast<int>(epev.data.u64 & 0xffffffffull);
-        if (HandleConnecting(handle, epev.events))
-            continue;
+        sendEv.un.packet = ev.un.batchSendInfo.packets[i];
 
-        const int sessionId = static_cast<int>(epev.data.u64 >> 32);
-        _Sessions::iterator it = _sessions.find(sessionId);
-        if (UNLIKELY(it == _sessions.end()))
-            continue;
+        const int sessionId = sendEv.un.packet->GetSessionId();
+        if (_batchSendSessionIds.empty() || _batchSendSessionIds.back() != sessionId)
+            _batchSendSessionIds.push_back(sessionId);
 
-        LLBC_Session *session = it->second;
-        if (epev.events & (EPOLLHUP | EPOLLERR))
-        {
-            LLBC_Socket *sock = session->GetSocket();
+        Base::HandleEv_Send(sendEv);
+    }
 
-            int sockErr;
-            LLBC_SessionCloseInfo *closeInfo;
-            if (sock->GetPendingError(sockErr) != LLBC_OK)
-            {
-                closeInfo = new LLBC_SessionCloseInfo;
-            }
-            else
-            {
-                closeInfo = new LLBC_SessionCloseInfo(LLBC_ERROR_CLIB, sockErr);
-            }
+    // Then force call OnSend() one time per session(EPOLL ET mode), the session send buffers
+    // will be sent by one gather send operation.
+    std::sort(_batchSendSessionIds.begin(), _batchSendSessionIds.end());
+    const auto sessionIdsEnd = std::unique(_batchSendSessionIds.begin(), _batchSendSessionIds.end());
+    for (auto sessionIt = _batchSendSessionIds.begin(); sessionIt != sessionIdsEnd; ++sessionIt)
+    {
+        _Sessions::iterator it = _sessions.find(*sessionIt);
+        if (it != _sessions.end())
+            it->second->OnSend();
+    }
+}
 
-            session->OnClose(closeInfo);
-        }
-        else
-        {
-            if (epev.events & EPOLLIN)
-            {
-                if (session->IsListen())
-                {
-                    Accept(session);
-                    continue;
-                }
-                else
-                {
-                    session->OnRecv();
-                }
-            }
-            if (epev.events & EPOLLOUT)
-            {
-                // Maybe in session removed while calling OnRecv() method.
-                if ((epev.events & EPOLLIN) &&
-                        UNLIKELY(_sessions.find(sessionId) == _sessions.end()))
-                    continue;
+void LLBC_EpollPoller::HandleEv_Close(LLBC_PollerEvent &ev)
+{
+    Base::HandleEv_Close(ev);
+}
 
-                session->OnSend();
-            }
-       }
-    }
+void LLBC_EpollPoller::HandleEv_Monitor(LLBC_PollerEvent &ev)
+{
+    const int count = *reinterpret_cast<int *>(ev.un.monitorEv);
+    const LLBC_EpollEvent *evs = 
+        reinterpret_cast<LLBC_EpollEvent *>(ev.un.monitorEv + sizeof(int));
+
+    HandleEpollEvents(evs, count);
 
     free(ev.un.monitorEv);
 }
@@ -321,6 +336,130 @@ void LLBC_EpollPoller::MonitorSvc()
     Push(LLBC_PollerEvUtil::BuildEpollMonitorEv(_events, ret));
 }
 
+int LLBC_EpollPoller::StartupReactorWakeup()
+{
+    if (_reactorWakeup == LLBC_INVALID_HANDLE &&
+        (_reactorWakeup = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) == LLBC_INVALID_HANDLE)
+    {
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_FAILED;
+    }
+
+    // Level triggered, eventfd will be drained after epoll_wait() returned.
+    LLBC_EpollEvent epev;
+    epev.events = EPOLLIN;
+    epev.data.u64 = static_cast<uint64>(_reactorWakeup);
+    if (LLBC_EpollCtl(_epoll, EPOLL_CTL_ADD, _reactorWakeup, &epev) != LLBC_OK)
+    {
+        CloseReactorWakeup();
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+}
+
+void LLBC_EpollPoller::CloseReactorWakeup()
+{
+    if (_reactorWakeup == LLBC_INVALID_HANDLE)
+        return;
+
+    close(_reactorWakeup);
+    _reactorWakeup = LLBC_INVALID_HANDLE;
+}
+
+void LLBC_EpollPoller::WakeupReactor()
+{
+    (void)eventfd_write(_reactorWakeup, 1);
+}
+
+void LLBC_EpollPoller::ReactorSvc()
+{
+    while (!_stopping)
+    {
+        // Handle queued events(AddSock/Send/Close/...).
+        HandleQueuedEvents(0);
+
+        // Mark waiting before recheck the queue, makesure the Push() which not seen the
+        // waiting flag has been handled or will be seen by the recheck.
+        (void)LLBC_AtomicFetchAndOr(&_reactorWaiting, 1);
+        const int ret = LLBC_EpollWait(_epoll,
+                                       _events,
+                                       LLBC_CFG_COMM_MAX_EVENT_COUNT,
+                                       GetMessageSize() != 0 ? 0 : 20);
+        (void)LLBC_AtomicFetchAndAnd(&_reactorWaiting, 0);
+
+        if (ret > 0)
+            HandleEpollEvents(_events, ret);
+    }
+}
+
+void LLBC_EpollPoller::HandleEpollEvents(const LLBC_EpollEvent *evs, int count)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        const LLBC_EpollEvent &epev = evs[i];
+        const LLBC_SocketHandle handle = static_cast<int>(epev.data.u64 & 0xffffffffull);
+        if (UNLIKELY(handle == _reactorWakeup))
+        {
+            // Drain wakeup eventfd, the queued events will be handled in next reactor loop.
+            eventfd_t val;
+            (void)eventfd_read(_reactorWakeup, &val);
+            continue;
+        }
+
+        if (HandleConnecting(handle, epev.events))
+            continue;
+
+        const int sessionId = static_cast<int>(epev.data.u64 >> 32);
+        _Sessions::iterator it = _sessions.find(sessionId);
+        if (UNLIKELY(it == _sessions.end()))
+            continue;
+
+        LLBC_Session *session = it->second;
+        if (epev.events & (EPOLLHUP | EPOLLERR))
+        {
+            LLBC_Socket *sock = session->GetSocket();
+
+            int sockErr;
+            LLBC_SessionCloseInfo *closeInfo;
+            if (sock->GetPendingError(sockErr) != LLBC_OK)
+            {
+                closeInfo = new LLBC_SessionCloseInfo;
+            }
+            else
+            {
+                closeInfo = new LLBC_SessionCloseInfo(LLBC_ERROR_CLIB, sockErr);
+            }
+
+            session->OnClose(closeInfo);
+        }
+        else
+        {
+            if (epev.events & EPOLLIN)
+            {
+                if (session->IsListen())
+                {
+                    Accept(session);
+                    continue;
+                }
+                else
+                {
+                    session->OnRecv();
+                }
+            }
+            if (epev.events & EPOLLOUT)
+            {
+                // Maybe in session removed while calling OnRecv() method.
+                if ((epev.events & EPOLLIN) &&
+                        UNLIKELY(_sessions.find(sessionId) == _sessions.end()))
+                    continue;
+
+                session->OnSend();
+            }
+       }
+    }
+}
+
 bool LLBC_EpollPoller::HandleConnecting(LLBC_SocketHandle handle, int events)
 {
     _Connecting::iterator it = _connecting.find(handle);
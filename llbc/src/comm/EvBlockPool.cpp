@@ -0,0 +1,85 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2013 lailongwei<lailongwei@126.com>
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of 
+// this software and associated documentation files (the "Software"), to deal in 
+// the Software without restriction, including without limitation the rights to 
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of 
+// the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS 
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER 
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN 
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+
+#include "llbc/common/Export.h"
+
+#include "llbc/comm/EvBlockPool.h"
+
+namespace
+{
+    // Event blocks built/released in poller threads, service threads and others, use thread-safe pool.
+    LLBC_NS LLBC_ObjPool *__objPool = nullptr;
+    LLBC_NS LLBC_TypedObjPool<LLBC_NS LLBC_MessageBlock> *__typedObjPool = nullptr;
+}
+
+__LLBC_NS_BEGIN
+
+int LLBC_EvBlockPool::Initialize()
+{
+    if (__objPool)
+    {
+        LLBC_SetLastError(LLBC_ERROR_REENTRY);
+        return LLBC_FAILED;
+    }
+
+    __objPool = new LLBC_ObjPool(true);
+    __objPool->SetName("EvBlockPool");
+    __typedObjPool = __objPool->GetTypedObjPool<LLBC_MessageBlock>();
+
+    return LLBC_OK;
+}
+
+void LLBC_EvBlockPool::Finalize()
+{
+    __typedObjPool = nullptr;
+    LLBC_XDelete(__objPool);
+}
+
+LLBC_MessageBlock *LLBC_EvBlockPool::Acquire(size_t size)
+{
+    if (UNLIKELY(!__typedObjPool))
+        return new LLBC_MessageBlock(size);
+
+    // Reused block keep it's buffer, only allocate when buffer not enough.
+    LLBC_MessageBlock *block = __typedObjPool->Acquire();
+    if (UNLIKELY(block->GetSize() < size))
+        block->Allocate(size - block->GetSize());
+
+    return block;
+}
+
+LLBC_String LLBC_EvBlockPool::GetStatistics(int statFmt)
+{
+    if (!__objPool)
+        return LLBC_String();
+
+    return __objPool->GetStatistics(statFmt);
+}
+
+void LLBC_EvBlockPool::Collect(bool deep)
+{
+    if (__typedObjPool)
+        __typedObjPool->Collect(deep);
+}
+
+__LLBC_NS_END
@@ -89,6 +89,7 @@ void LLBC_Packet::Clear()
             else
             {
                 _payload->Clear();
+                ReservePayloadHeadroom();
             }
         }
     }
@@ -184,7 +185,7 @@ bool LLBC_Packet::Encode()
     if (_encoder)
     {
         if (!_payload && _typedObjPool)
-            _payload = _typedObjPool->GetObjPool()->Acquire<LLBC_MessageBlock>();
+            GetMutablePayload();
 
         if (!_encoder->Encode(*this))
             return false;
@@ -25,6 +25,7 @@
 #include "llbc/comm/Packet.h"
 #include "llbc/comm/Socket.h"
 #include "llbc/comm/Session.h"
+#include "llbc/comm/EvBlockPool.h"
 #include "llbc/comm/PollerEvent.h"
 
 namespace
@@ -39,13 +40,15 @@ __LLBC_NS_BEGIN
 
 LLBC_MessageBlock *LLBC_PollerEvUtil::BuildAddSockEv(LLBC_Socket *sock,
                                                      int sessionId,
-                                                     const LLBC_SessionOpts &sessionOpts)
+                                                     const LLBC_SessionOpts &sessionOpts,
+                                                     int acceptSessionId)
 {
-    _Block *block = new _Block(sizeof(_Ev));
+    _Block *block = LLBC_EvBlockPool::Acquire(sizeof(_Ev));
     _Ev &ev = *reinterpret_cast<_Ev *>(block->GetData());
     ev.type = _Ev::AddSock;
     ev.un.socket = sock;
     ev.sessionId = sessionId;
+    ev.acceptSessionId = acceptSessionId;
     ev.sessionOpts = new LLBC_SessionOpts(sessionOpts);
 
     block->SetWritePos(sizeof(_Ev));
@@ -56,7 +59,7 @@ LLBC_MessageBlock *LLBC_PollerEvUtil::BuildAsyncConnEv(int sessionId,
                                                        const LLBC_SessionOpts &sessionOpts,
                                                        const LLBC_SockAddr_IN &peerAddr)
 {
-    _Block *block = new _Block(sizeof(_Ev));
+    _Block *block = LLBC_EvBlockPool::Acquire(sizeof(_Ev));
     _Ev &ev = *reinterpret_cast<_Ev *>(block->GetData());
     ev.type = _Ev::AsyncConn;
     ev.sessionId = sessionId;
@@ -69,7 +72,7 @@ LLBC_MessageBlock *LLBC_PollerEvUtil::BuildAsyncConnEv(int sessionId,
 
 LLBC_MessageBlock *LLBC_PollerEvUtil::BuildSendEv(LLBC_Packet *packet)
 {
-    _Block *block = new _Block(sizeof(_Ev));
+    _Block *block = LLBC_EvBlockPool::Acquire(sizeof(_Ev));
     _Ev &ev = *reinterpret_cast<_Ev *>(block->GetData());
     ev.type = _Ev::Send;
     ev.un.packet = packet;
@@ -80,7 +83,7 @@ LLBC_MessageBlock *LLBC_PollerEvUtil::BuildSendEv(LLBC_Packet *packet)
 
 LLBC_MessageBlock *LLBC_PollerEvUtil::BuildCloseEv(int sessionId, const char *reason)
 {
-    _Block *block = new _Block(sizeof(_Ev));
+    _Block *block = LLBC_EvBlockPool::Acquire(sizeof(_Ev));
     _Ev &ev = *reinterpret_cast<_Ev *>(block->GetData());
     ev.type = _Ev::Close;
     ev.sessionId = sessionId;
@@ -106,7 +109,7 @@ LLBC_MessageBlock *LLBC_PollerEvUtil::BuildIocpMonitorEv(int ret,
                                                          int errNo, 
                                                          int subErrNo)
 {
-    _Block *block = new _Block(sizeof(_Ev));
+    _Block *block = LLBC_EvBlockPool::Acquire(sizeof(_Ev));
     _Ev &ev = *reinterpret_cast<_Ev *>(block->GetData());
     ev.type = _Ev::Monitor;
     ev.un.monitorEv = LLBC_Malloc(char, sizeof(int) + sizeof(LLBC_POverlapped) + sizeof(int) * 2);
@@ -129,7 +132,7 @@ LLBC_MessageBlock *LLBC_PollerEvUtil::BuildIocpMonitorEv(int ret,
 #if LLBC_TARGET_PLATFORM_LINUX || LLBC_TARGET_PLATFORM_ANDROID
 LLBC_MessageBlock *LLBC_PollerEvUtil::BuildEpollMonitorEv(const LLBC_EpollEvent *evs, int count)
 {
-    _Block *block = new _Block(sizeof(_Ev));
+    _Block *block = LLBC_EvBlockPool::Acquire(sizeof(_Ev));
     _Ev &ev = *reinterpret_cast<_Ev *>(block->GetData());
     ev.type = _Ev::Monitor;
     ev.un.monitorEv = LLBC_Malloc(char, sizeof(int) + sizeof(LLBC_EpollEvent) * count);
@@ -146,7 +149,7 @@ LLBC_MessageBlock *LLBC_PollerEvUtil::BuildEpollMonitorEv(const LLBC_EpollEvent
 
 LLBC_MessageBlock *LLBC_PollerEvUtil::BuildTakeOverSessionEv(LLBC_Session *session)
 {
-    _Block *block = new _Block(sizeof(_Ev));
+    _Block *block = LLBC_EvBlockPool::Acquire(sizeof(_Ev));
     _Ev &ev = *reinterpret_cast<_Ev *>(block->GetData());
     ev.type = _Ev::TakeOverSession;
     ev.un.session = session;
@@ -159,7 +162,7 @@ LLBC_MessageBlock * LLBC_PollerEvUtil::BuildCtrlProtocolStackEv(int sessionId,
                                                                 int ctrlCmd,
                                                                 const LLBC_Variant &ctrlData)
 {
-    _Block *block = new _Block(sizeof(_Ev));
+    _Block *block = LLBC_EvBlockPool::Acquire(sizeof(_Ev));
     _Ev &ev = *reinterpret_cast<_Ev *>(block->GetData());
 
     LLBC_Stream ctrlDataStream;
@@ -175,6 +178,40 @@ LLBC_MessageBlock * LLBC_PollerEvUtil::BuildCtrlProtocolStackEv(int sessionId,
     return block;
 }
 
+LLBC_MessageBlock *LLBC_PollerEvUtil::BuildSharedSendEv(int sessionId,
+                                                        LLBC_MessageBlock *frame,
+                                                        int opcode,
+                                                        int status,
+                                                        uint32 flags)
+{
+    _Block *block = LLBC_EvBlockPool::Acquire(sizeof(_Ev));
+    _Ev &ev = *reinterpret_cast<_Ev *>(block->GetData());
+    ev.type = _Ev::SharedSend;
+    ev.sessionId = sessionId;
+    ev.un.sharedSendInfo.frame = frame;
+    ev.un.sharedSendInfo.opcode = opcode;
+    ev.un.sharedSendInfo.status = status;
+    ev.un.sharedSendInfo.flags = flags;
+
+    block->SetWritePos(sizeof(_Ev));
+    return block;
+}
+
+LLBC_MessageBlock *LLBC_PollerEvUtil::BuildBatchSendEv(LLBC_Packet * const *packets, int count)
+{
+    // Packets array stored after the event, in the same block.
+    _Block *block = LLBC_EvBlockPool::Acquire(sizeof(_Ev) + sizeof(LLBC_Packet *) * count);
+    _Ev &ev = *reinterpret_cast<_Ev *>(block->GetData());
+    ev.type = _Ev::BatchSend;
+    ev.un.batchSendInfo.packets =
+        reinterpret_cast<LLBC_Packet **>(reinterpret_cast<char *>(block->GetData()) + sizeof(_Ev));
+    ev.un.batchSendInfo.count = count;
+    memcpy(ev.un.batchSendInfo.packets, packets, sizeof(LLBC_Packet *) * count);
+
+    block->SetWritePos(sizeof(_Ev) + sizeof(LLBC_Packet *) * count);
+    return block;
+}
+
 void LLBC_PollerEvUtil::DestroyEv(LLBC_PollerEvent &ev)
 {
     switch (ev.type)
@@ -208,6 +245,15 @@ void LLBC_PollerEvUtil::DestroyEv(LLBC_PollerEvent &ev)
         delete ev.un.protocolStackCtrlInfo.ctrlData;
         break;
 
+    case _Ev::SharedSend:
+        LLBC_Recycle(ev.un.sharedSendInfo.frame);
+        break;
+
+    case _Ev::BatchSend:
+        for (int i = 0; i < ev.un.batchSendInfo.count; ++i)
+            LLBC_Recycle(ev.un.batchSendInfo.packets[i]);
+        break;
+
     default:
         break;
     }
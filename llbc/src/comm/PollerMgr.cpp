@@ -28,6 +28,7 @@
 #include "llbc/comm/PollerEvent.h"
 #include "llbc/comm/BasePoller.h"
 #include "llbc/comm/PollerMgr.h"
+#include "llbc/comm/RecvBufferPool.h"
 #include "llbc/comm/ServiceImpl.h"
 
 __LLBC_INTERNAL_NS_BEGIN
@@ -48,23 +49,41 @@ static LLBC_NS LLBC_Socket *__CreateSocket(int type)
     return sock;
 }
 
+static bool __IsReusePortSupported()
+{
+#if LLBC_TARGET_PLATFORM_NON_WIN32 && defined(SO_REUSEPORT)
+    return true;
+#else // Not support SO_REUSEPORT
+    return false;
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32 && defined(SO_REUSEPORT)
+}
+
 __LLBC_INTERNAL_NS_END
 
 __LLBC_NS_BEGIN
 
 LLBC_PollerMgr::LLBC_PollerMgr()
 : _type(LLBC_PollerType::End)
+, _reactorMode(false)
+, _lockFreeEventQueue(false)
 , _svc(nullptr)
 , _maxSessionId(1)
 
 , _inited(false)
 , _started(false)
+
+, _sendBatchedCount(0)
+
+, _reusePortListenCount(0)
 {
 }
 
 LLBC_PollerMgr::~LLBC_PollerMgr()
 {
     Finalize();
+
+    // Delete recv buffer pools.
+    LLBC_STLHelper::DeleteContainer(_recvBufPools, true);
 }
 
 void LLBC_PollerMgr::SetPollerType(int type)
@@ -77,6 +96,16 @@ void LLBC_PollerMgr::SetService(LLBC_Service *svc)
     _svc = svc;
 }
 
+void LLBC_PollerMgr::SetReactorMode(bool reactorMode)
+{
+    _reactorMode = reactorMode;
+}
+
+void LLBC_PollerMgr::SetLockFreeEventQueue(bool lockFreeEventQueue)
+{
+    _lockFreeEventQueue = lockFreeEventQueue;
+}
+
 int LLBC_PollerMgr::Init(int pollerCount)
 {
     if (pollerCount <= 0)
@@ -90,6 +119,12 @@ int LLBC_PollerMgr::Init(int pollerCount)
         return LLBC_FAILED;
     }
 
+    // Create recv buffer pools(reuse the pools created by previous Init() call).
+    _recvBufPoolsLock.Lock();
+    for (int i = static_cast<int>(_recvBufPools.size()); i < pollerCount; ++i)
+        _recvBufPools.push_back(new LLBC_RecvBufferPool(i));
+    _recvBufPoolsLock.Unlock();
+
     // Create pollers.
     _pollers.resize(pollerCount);
     for (int i = 0; i < pollerCount; ++i)
@@ -99,10 +134,16 @@ int LLBC_PollerMgr::Init(int pollerCount)
         poller->SetService(_svc);
         poller->SetPollerMgr(this);
         poller->SetBrothersCount(pollerCount);
+        poller->SetRecvBufferPool(_recvBufPools[i]);
+        poller->SetReactorMode(_reactorMode);
+        poller->SetLockFreeMessageQueue(_lockFreeEventQueue);
 
         _pollers[i] = poller;
     }
 
+    // Create send batches.
+    _sendBatches.resize(pollerCount);
+
     // Mask inited.
     _inited = true;
 
@@ -128,6 +169,15 @@ void LLBC_PollerMgr::Finalize()
     // Delete all pollers.
     LLBC_STLHelper::DeleteContainer(_pollers, true);
 
+    // Cleanup send batches(batched but pollers never started).
+    for (auto &sendBatch : _sendBatches)
+    {
+        for (auto &packet : sendBatch)
+            LLBC_Recycle(packet);
+    }
+    _sendBatches.clear();
+    _sendBatchedCount = 0;
+
     // Reset max sessionId.
     _maxSessionId = 1;
 
@@ -154,10 +204,29 @@ int LLBC_PollerMgr::Start()
 
     // Process pending sockets.
     for (auto &pendingAddSockItem : _pendingAddSocks)
-         _pollers[pendingAddSockItem.first % _pollers.size()]->Push(
-             LLBC_PollerEvUtil::BuildAddSockEv(pendingAddSockItem.second.first, 
-                                                    pendingAddSockItem.first,
-                                                    pendingAddSockItem.second.second));
+    {
+        // Find primary listen sessionId, if is reuse port listen sibling session.
+        int acceptSessionId = 0;
+        if (pendingAddSockItem.second.second.IsReusePort())
+        {
+            LLBC_LockGuard guard(_reusePortListensLock);
+            for (auto &reusePortListenItem : _reusePortListens)
+            {
+                auto &siblings = reusePortListenItem.second;
+                if (std::find(siblings.begin(), siblings.end(), pendingAddSockItem.first) != siblings.end())
+                {
+                    acceptSessionId = reusePortListenItem.first;
+                    break;
+                }
+            }
+        }
+
+        _pollers[pendingAddSockItem.first % _pollers.size()]->Push(
+            LLBC_PollerEvUtil::BuildAddSockEv(pendingAddSockItem.second.first,
+                                              pendingAddSockItem.first,
+                                              pendingAddSockItem.second.second,
+                                              acceptSessionId));
+    }
     _pendingAddSocks.clear();
 
     // Process Async-connections.
@@ -181,12 +250,21 @@ void LLBC_PollerMgr::Stop()
     if (!_started)
         return;
 
+    // Flush send batches, keep the same behavior with unbatched sends.
+    FlushSendBatches();
+
     // Stop all pollers.
     for (int i = static_cast<int>(_pollers.size() - 1); i >= 0; --i)
         _pollers[i]->Stop();
 
     // Reset _started flag.
     _started = false;
+
+    // Clear reuse port listen sessions.
+    _reusePortListensLock.Lock();
+    _reusePortListens.clear();
+    LLBC_AtomicSet(&_reusePortListenCount, 0);
+    _reusePortListensLock.Unlock();
 }
 
 int LLBC_PollerMgr::Listen(const char *ip, uint16 port, LLBC_IProtocolFactory *protoFactory, const LLBC_SessionOpts &sessionOpts)
@@ -195,38 +273,55 @@ int LLBC_PollerMgr::Listen(const char *ip, uint16 port, LLBC_IProtocolFactory *p
     if (GetAddr(ip, port, local) != LLBC_OK)
         return 0;
 
-    // Create socket and listen.
-    LLBC_Socket *sock;
-    if (!(sock = LLBC_INL_NS __CreateSocket(_type)))
+    // If reuse port not supported or only one poller, fall back to one listen socket.
+    LLBC_SessionOpts listenOpts(sessionOpts);
+    if (listenOpts.IsReusePort() &&
+        (_pollers.size() <= 1 || !LLBC_INL_NS __IsReusePortSupported()))
+        listenOpts.SetReusePort(false);
+
+    // Create listen sockets, if reuse port, create one listen socket per poller.
+    std::vector<LLBC_Socket *> socks(listenOpts.IsReusePort() ? _pollers.size() : 1);
+    for (size_t i = 0; i < socks.size(); ++i)
     {
-        return 0;
+        if (!(socks[i] = CreateListenSocket(local, listenOpts)))
+        {
+            for (size_t j = 0; j < i; ++j)
+                delete socks[j];
+
+            return 0;
+        }
     }
-    else if (sock->SetNonBlocking() != LLBC_OK ||
-             sock->EnableAddressReusable() != LLBC_OK ||
-             sock->BindTo(local) != LLBC_OK ||
-             sock->SetNoDelay(sessionOpts.IsNoDelay()) ||
-             (sessionOpts.GetSockSendBufSize() != 0 &&
-                sock->SetSendBufSize(sessionOpts.GetSockSendBufSize()) != LLBC_OK) ||
-             (sessionOpts.GetSockRecvBufSize() != 0 &&
-                sock->SetRecvBufSize(sessionOpts.GetSockRecvBufSize()) != LLBC_OK) ||
-             sock->Listen() != LLBC_OK ||
-             sock->SetMaxPacketSize(sessionOpts.GetMaxPacketSize()) != LLBC_OK)
+
+    // Allocate sessionId and add proto factory to service(is exist).
+    if (!listenOpts.IsReusePort())
     {
-        delete sock;
-        return 0;
+        const int sessionId = AllocSessionId();
+        if (protoFactory)
+            _svc->AddSessionProtocolFactory(sessionId, protoFactory);
+
+        AddSock(socks[0], sessionId, listenOpts);
+
+        return sessionId;
     }
 
-    // Allocate sessionId and add proto factory to service(is exist).
-    const int sessionId = AllocSessionId();
+    // Reuse port listen: allocate sessionId per poller(sessionId % pollerCount == pollerId),
+    // the first one is primary listen session, others is sibling listen sessions, all
+    // sibling listen sessions and accepted sessions's accept sessionId is primary listen sessionId.
+    std::vector<int> sessionIds(socks.size());
+    for (size_t i = 0; i < socks.size(); ++i)
+        sessionIds[i] = AllocSessionId(static_cast<int>(i));
+
+    const int sessionId = sessionIds[0];
     if (protoFactory)
         _svc->AddSessionProtocolFactory(sessionId, protoFactory);
 
-    // Add to poller or pending.
-    if (LIKELY(_started))
-        _pollers[sessionId % _pollers.size()]->Push(
-                LLBC_PollerEvUtil::BuildAddSockEv(sock, sessionId, sessionOpts));
-    else
-        _pendingAddSocks.insert(std::make_pair(sessionId, std::make_pair(sock, sessionOpts)));
+    _reusePortListensLock.Lock();
+    _reusePortListens[sessionId].assign(sessionIds.begin() + 1, sessionIds.end());
+    LLBC_AtomicFetchAndAdd(&_reusePortListenCount, 1);
+    _reusePortListensLock.Unlock();
+
+    for (size_t i = 0; i < socks.size(); ++i)
+        AddSock(socks[i], sessionIds[i], listenOpts, i == 0 ? 0 : sessionId);
 
     return sessionId;
 }
@@ -310,8 +405,46 @@ int LLBC_PollerMgr::Send(LLBC_Packet *packet)
     return LLBC_OK;
 }
 
+int LLBC_PollerMgr::SharedSend(int sessionId, LLBC_MessageBlock *frame, int opcode, int status, uint32 flags)
+{
+    _pollers[sessionId % _pollers.size()]->Push(
+        LLBC_PollerEvUtil::BuildSharedSendEv(sessionId, frame, opcode, status, flags));
+    return LLBC_OK;
+}
+
+int LLBC_PollerMgr::BatchSend(LLBC_Packet *packet)
+{
+    const int pollerId = static_cast<int>(packet->GetSessionId() % _pollers.size());
+    std::vector<LLBC_Packet *> &sendBatch = _sendBatches[pollerId];
+    sendBatch.push_back(packet);
+    ++_sendBatchedCount;
+
+    if (UNLIKELY(sendBatch.size() >= LLBC_CFG_COMM_SERVICE_SEND_BATCH_MAX_PACKETS))
+        FlushSendBatch(pollerId);
+
+    return LLBC_OK;
+}
+
+void LLBC_PollerMgr::FlushSendBatches()
+{
+    if (_sendBatchedCount == 0)
+        return;
+
+    const int pollerCount = static_cast<int>(_sendBatches.size());
+    for (int pollerId = 0; pollerId < pollerCount; ++pollerId)
+        FlushSendBatch(pollerId);
+}
+
+bool LLBC_PollerMgr::HasSendBatches() const
+{
+    return _sendBatchedCount != 0;
+}
+
 void LLBC_PollerMgr::Close(int sessionId, const char *reason)
 {
+    if (UNLIKELY(_reusePortListenCount > 0))
+        CloseReusePortListenSiblings(sessionId, reason);
+
     _pollers[sessionId % _pollers.size()]->Push(
         LLBC_PollerEvUtil::BuildCloseEv(sessionId, reason));
 }
@@ -324,11 +457,90 @@ void LLBC_PollerMgr::CtrlProtocolStack(int sessionId,
         LLBC_PollerEvUtil::BuildCtrlProtocolStackEv(sessionId, ctrlCmd, ctrlData));
 }
 
+void LLBC_PollerMgr::GetRecvBufferPoolStats(std::vector<LLBC_RecvBufferPoolStat> &stats) const
+{
+    LLBC_LockGuard guard(_recvBufPoolsLock);
+
+    stats.resize(_recvBufPools.size());
+    for (size_t i = 0; i < _recvBufPools.size(); ++i)
+        _recvBufPools[i]->GetStatistics(stats[i]);
+}
+
 int LLBC_PollerMgr::AllocSessionId()
 {
     return LLBC_AtomicFetchAndAdd(&_maxSessionId, 1);
 }
 
+int LLBC_PollerMgr::AllocSessionId(int pollerId)
+{
+    const int pollerCount = static_cast<int>(_pollers.size());
+    while (true)
+    {
+        const int curMaxSessionId = _maxSessionId;
+        const int sessionId = curMaxSessionId + (pollerId - curMaxSessionId % pollerCount + pollerCount) % pollerCount;
+        if (LLBC_AtomicCompareAndExchange(&_maxSessionId, sessionId + 1, curMaxSessionId) == curMaxSessionId)
+            return sessionId;
+    }
+}
+
+LLBC_Socket *LLBC_PollerMgr::CreateListenSocket(const LLBC_SockAddr_IN &local, const LLBC_SessionOpts &sessionOpts)
+{
+    LLBC_Socket *sock;
+    if (!(sock = LLBC_INL_NS __CreateSocket(_type)))
+    {
+        return nullptr;
+    }
+    else if (sock->SetNonBlocking() != LLBC_OK ||
+             sock->EnableAddressReusable() != LLBC_OK ||
+             (sessionOpts.IsReusePort() &&
+                sock->EnablePortReusable() != LLBC_OK) ||
+             sock->BindTo(local) != LLBC_OK ||
+             sock->SetNoDelay(sessionOpts.IsNoDelay()) ||
+             (sessionOpts.GetSockSendBufSize() != 0 &&
+                sock->SetSendBufSize(sessionOpts.GetSockSendBufSize()) != LLBC_OK) ||
+             (sessionOpts.GetSockRecvBufSize() != 0 &&
+                sock->SetRecvBufSize(sessionOpts.GetSockRecvBufSize()) != LLBC_OK) ||
+             sock->Listen() != LLBC_OK ||
+             sock->SetMaxPacketSize(sessionOpts.GetMaxPacketSize()) != LLBC_OK)
+    {
+        delete sock;
+        return nullptr;
+    }
+
+    return sock;
+}
+
+void LLBC_PollerMgr::AddSock(LLBC_Socket *sock, int sessionId, const LLBC_SessionOpts &sessionOpts, int acceptSessionId)
+{
+    if (LIKELY(_started))
+        _pollers[sessionId % _pollers.size()]->Push(
+            LLBC_PollerEvUtil::BuildAddSockEv(sock, sessionId, sessionOpts, acceptSessionId));
+    else
+        _pendingAddSocks.insert(std::make_pair(sessionId, std::make_pair(sock, sessionOpts)));
+}
+
+void LLBC_PollerMgr::CloseReusePortListenSiblings(int sessionId, const char *reason)
+{
+    std::vector<int> siblings;
+
+    _reusePortListensLock.Lock();
+    auto it = _reusePortListens.find(sessionId);
+    if (it == _reusePortListens.end())
+    {
+        _reusePortListensLock.Unlock();
+        return;
+    }
+
+    siblings.swap(it->second);
+    _reusePortListens.erase(it);
+    LLBC_AtomicFetchAndSub(&_reusePortListenCount, 1);
+    _reusePortListensLock.Unlock();
+
+    for (auto &siblingSessionId : siblings)
+        _pollers[siblingSessionId % _pollers.size()]->Push(
+            LLBC_PollerEvUtil::BuildCloseEv(siblingSessionId, reason));
+}
+
 int LLBC_PollerMgr::PushMsgToPoller(int id, LLBC_MessageBlock *block)
 {
     LLBC_LockGuard guard(_pollerLock);
@@ -342,6 +554,23 @@ int LLBC_PollerMgr::PushMsgToPoller(int id, LLBC_MessageBlock *block)
     return LLBC_FAILED;
 }
 
+void LLBC_PollerMgr::FlushSendBatch(int id)
+{
+    std::vector<LLBC_Packet *> &sendBatch = _sendBatches[id];
+    if (sendBatch.empty())
+        return;
+
+    // Only one packet, use normal Send event.
+    const int count = static_cast<int>(sendBatch.size());
+    if (count == 1)
+        _pollers[id]->Push(LLBC_PollerEvUtil::BuildSendEv(sendBatch[0]));
+    else
+        _pollers[id]->Push(LLBC_PollerEvUtil::BuildBatchSendEv(sendBatch.data(), count));
+
+    sendBatch.clear();
+    _sendBatchedCount -= count;
+}
+
 void LLBC_PollerMgr::OnPollerStop(int id)
 {
     _pollerLock.Lock();
@@ -0,0 +1,172 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2013 lailongwei<lailongwei@126.com>
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of 
+// this software and associated documentation files (the "Software"), to deal in 
+// the Software without restriction, including without limitation the rights to 
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of 
+// the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS 
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER 
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN 
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+
+#include "llbc/common/Export.h"
+
+#include "llbc/comm/RecvBufferPool.h"
+
+__LLBC_NS_BEGIN
+
+LLBC_RecvBufferPoolStat::LLBC_RecvBufferPoolStat()
+: pollerId(-1)
+, unpooledAcquireTimes(0)
+, growTimes(0)
+, shrinkTimes(0)
+{
+}
+
+LLBC_String LLBC_RecvBufferPoolStat::ToString() const
+{
+    LLBC_String desc;
+    desc.format("poller:%d, unpooled:%llu, grow:%llu, shrink:%llu",
+                pollerId, unpooledAcquireTimes, growTimes, shrinkTimes);
+    for (auto &sizeClass : sizeClasses)
+    {
+        if (sizeClass.acquireTimes == 0)
+            continue;
+
+        desc.append_format(", [%lu]acquire:%llu/reuse:%llu/alloc:%llu",
+                           static_cast<LLBC_NS ulong>(sizeClass.bufSize),
+                           sizeClass.acquireTimes,
+                           sizeClass.reuseTimes,
+                           sizeClass.allocTimes);
+    }
+
+    return desc;
+}
+
+LLBC_RecvBufferPool::LLBC_RecvBufferPool(int pollerId)
+: _pollerId(pollerId)
+
+, _unpooledAcquireTimes(0)
+, _growTimes(0)
+, _shrinkTimes(0)
+{
+    for (size_t bufSize = LLBC_CFG_COMM_RECV_BUF_POOL_MIN_SIZE;
+         bufSize <= LLBC_CFG_COMM_RECV_BUF_POOL_MAX_SIZE;
+         bufSize <<= 1)
+    {
+        // Buffer released in poller thread(PacketProtocol) or service thread(RawProtocol), use thread-safe pool.
+        _SizeClass sizeClass;
+        sizeClass.bufSize = bufSize;
+        sizeClass.objPool = new LLBC_ObjPool(true);
+        sizeClass.typedObjPool = sizeClass.objPool->GetTypedObjPool<LLBC_MessageBlock>();
+        sizeClass.acquireTimes = sizeClass.reuseTimes = sizeClass.allocTimes = 0;
+
+        _sizeClasses.push_back(sizeClass);
+    }
+}
+
+LLBC_RecvBufferPool::~LLBC_RecvBufferPool()
+{
+    for (auto &sizeClass : _sizeClasses)
+        delete sizeClass.objPool;
+}
+
+LLBC_MessageBlock *LLBC_RecvBufferPool::Acquire(size_t size)
+{
+    // Greater than max size class, don't pool it.
+    const int classIdx = GetSizeClassIndex(size);
+    if (UNLIKELY(classIdx < 0))
+    {
+        ++_unpooledAcquireTimes;
+        return new LLBC_MessageBlock(size);
+    }
+
+    _SizeClass &sizeClass = _sizeClasses[classIdx];
+    ++sizeClass.acquireTimes;
+
+    // New constructed block(or block reused by other size), allocate size class buffer.
+    LLBC_MessageBlock *block = sizeClass.typedObjPool->Acquire();
+    if (block->GetSize() < sizeClass.bufSize)
+    {
+        ++sizeClass.allocTimes;
+        block->Allocate(sizeClass.bufSize - block->GetSize());
+    }
+    else
+    {
+        ++sizeClass.reuseTimes;
+    }
+
+    return block;
+}
+
+size_t LLBC_RecvBufferPool::AdjustSizeHint(size_t sizeHint, size_t recvedLen, bool bufFull)
+{
+    if (bufFull)
+    {
+        if (sizeHint < LLBC_CFG_COMM_RECV_BUF_POOL_MAX_SIZE)
+        {
+            ++_growTimes;
+            return MIN(sizeHint << 1, static_cast<size_t>(LLBC_CFG_COMM_RECV_BUF_POOL_MAX_SIZE));
+        }
+    }
+    else if (recvedLen < (sizeHint >> 2) &&
+             sizeHint > LLBC_CFG_COMM_RECV_BUF_POOL_MIN_SIZE)
+    {
+        ++_shrinkTimes;
+        return MAX(sizeHint >> 1, static_cast<size_t>(LLBC_CFG_COMM_RECV_BUF_POOL_MIN_SIZE));
+    }
+
+    return sizeHint;
+}
+
+void LLBC_RecvBufferPool::GetStatistics(LLBC_RecvBufferPoolStat &stat) const
+{
+    stat.pollerId = _pollerId;
+    stat.unpooledAcquireTimes = _unpooledAcquireTimes;
+    stat.growTimes = _growTimes;
+    stat.shrinkTimes = _shrinkTimes;
+
+    stat.sizeClasses.resize(_sizeClasses.size());
+    for (size_t i = 0; i < _sizeClasses.size(); ++i)
+    {
+        const _SizeClass &sizeClass = _sizeClasses[i];
+        LLBC_RecvBufferPoolStat::SizeClass &statSizeClass = stat.sizeClasses[i];
+        statSizeClass.bufSize = sizeClass.bufSize;
+        statSizeClass.acquireTimes = sizeClass.acquireTimes;
+        statSizeClass.reuseTimes = sizeClass.reuseTimes;
+        statSizeClass.allocTimes = sizeClass.allocTimes;
+    }
+}
+
+void LLBC_RecvBufferPool::Collect(bool deep)
+{
+    for (auto &sizeClass : _sizeClasses)
+        sizeClass.typedObjPool->Collect(deep);
+}
+
+int LLBC_RecvBufferPool::GetSizeClassIndex(size_t size)
+{
+    int classIdx = 0;
+    size_t bufSize = LLBC_CFG_COMM_RECV_BUF_POOL_MIN_SIZE;
+    while (bufSize < size)
+    {
+        bufSize <<= 1;
+        ++classIdx;
+    }
+
+    return bufSize <= LLBC_CFG_COMM_RECV_BUF_POOL_MAX_SIZE ? classIdx : -1;
+}
+
+__LLBC_NS_END
@@ -23,6 +23,7 @@
 #include "llbc/common/Export.h"
 
 #include "llbc/comm/Packet.h"
+#include "llbc/comm/EvBlockPool.h"
 #include "llbc/comm/ServiceEvent.h"
 
 #include "llbc/app/App.h"
@@ -32,8 +33,10 @@ namespace
     template <typename Ev>
     static inline LLBC_NS LLBC_MessageBlock *__CreateEvBlock(Ev *&ev)
     {
-        ev = new Ev;
-        auto block = new LLBC_NS LLBC_MessageBlock(ev, sizeof(Ev));
+        // Construct event in pooled block buffer.
+        auto block = LLBC_NS LLBC_EvBlockPool::Acquire(sizeof(Ev));
+        ev = new (block->GetData()) Ev;
+        block->SetWritePos(sizeof(Ev));
 
         return block;
     }
@@ -204,10 +207,4 @@ LLBC_MessageBlock *LLBC_SvcEvUtil::BuildComponentEventEv(int eventType,
     return evBlock;
 }
 
-void LLBC_SvcEvUtil::DestroyEvBlock(LLBC_MessageBlock *block)
-{
-    delete reinterpret_cast<LLBC_ServiceEvent *>(block->GetData());
-    delete block;
-}
-
 __LLBC_NS_END
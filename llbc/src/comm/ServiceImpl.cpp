@@ -32,6 +32,7 @@
 #include "llbc/comm/PollerType.h"
 #include "llbc/comm/protocol/IProtocol.h"
 #include "llbc/comm/protocol/ProtocolStack.h"
+#include "llbc/comm/protocol/PacketProtocol.h"
 #include "llbc/comm/protocol/NormalProtocolFactory.h"
 #include "llbc/comm/ServiceImpl.h"
 #include "llbc/comm/ServiceMgr.h"
@@ -114,6 +115,11 @@ LLBC_ServiceImpl::LLBC_ServiceImpl(const LLBC_String &name,
 , _fullStack(fullStack)
 , _pollerCount(0)
 , _suppressedCoderNotFoundWarning(false)
+, _sharedMulticast(LLBC_CFG_COMM_DFT_SERVICE_SHARED_MULTICAST != 0)
+, _eventWakeup(LLBC_CFG_COMM_DFT_SERVICE_EVENT_WAKEUP != 0)
+, _pollerReactorMode(LLBC_CFG_COMM_DFT_SERVICE_POLLER_REACTOR_MODE != 0)
+, _sendBatching(LLBC_CFG_COMM_DFT_SERVICE_SEND_BATCHING != 0)
+, _lockFreeEventQueue(LLBC_CFG_COMM_DFT_SERVICE_LOCK_FREE_EVENT_QUEUE != 0)
 , _dftProtocolFactory(dftProtocolFactory)
 
 , _fps(LLBC_CFG_COMM_DFT_SERVICE_FPS)
@@ -161,7 +167,9 @@ LLBC_ServiceImpl::~LLBC_ServiceImpl()
     DestroyComps(false);
 
     // Clear members.
-    LLBC_STLHelper::DeleteContainer(_coderFactories);
+    for (auto &coderFactoryItem : _coderFactories.GetMap())
+        delete coderFactoryItem.second;
+    _coderFactories.Clear();
     LLBC_STLHelper::DeleteContainer(_sessionProtoFactory);
     LLBC_XDelete(_dftProtocolFactory);
 }
@@ -204,6 +212,52 @@ int LLBC_ServiceImpl::SuppressCoderNotFoundWarning()
     return LLBC_OK;
 }
 
+int LLBC_ServiceImpl::SetSharedMulticast(bool sharedMulticast)
+{
+    LLBC_LockGuard guard(_lock);
+    _sharedMulticast = sharedMulticast;
+
+    return LLBC_OK;
+}
+
+int LLBC_ServiceImpl::SetEventWakeup(bool eventWakeup)
+{
+    LLBC_LockGuard guard(_lock);
+    _eventWakeup = eventWakeup;
+
+    return LLBC_OK;
+}
+
+int LLBC_ServiceImpl::SetPollerReactorMode(bool pollerReactorMode)
+{
+    // Pollers created while service starting, only can change reactor mode in <NotStarted> phase.
+    __LLBC_INL_CHECK_RUNNING_PHASE_EQ(
+        NotStarted, LLBC_ERROR_NOT_ALLOW, LLBC_FAILED);
+    _pollerReactorMode = pollerReactorMode;
+
+    return LLBC_OK;
+}
+
+int LLBC_ServiceImpl::SetSendBatching(bool sendBatching)
+{
+    // Send batches only flushed by service thread, only can change send batching option in <NotStarted> phase.
+    __LLBC_INL_CHECK_RUNNING_PHASE_EQ(
+        NotStarted, LLBC_ERROR_NOT_ALLOW, LLBC_FAILED);
+    _sendBatching = sendBatching;
+
+    return LLBC_OK;
+}
+
+int LLBC_ServiceImpl::SetLockFreeEventQueue(bool lockFreeEventQueue)
+{
+    // Event queues type only can be changed before service/pollers activated.
+    __LLBC_INL_CHECK_RUNNING_PHASE_EQ(
+        NotStarted, LLBC_ERROR_NOT_ALLOW, LLBC_FAILED);
+    _lockFreeEventQueue = lockFreeEventQueue;
+
+    return LLBC_OK;
+}
+
 int LLBC_ServiceImpl::Start(int pollerCount)
 {
     // Normalize pollerCount.
@@ -234,6 +288,13 @@ int LLBC_ServiceImpl::Start(int pollerCount)
         _startSubErrNo = 0;
     );
 
+    // Switch service event queue type.
+    if (SetLockFreeMessageQueue(_lockFreeEventQueue) != LLBC_OK)
+    {
+        _lock.Unlock();
+        return LLBC_FAILED;
+    }
+
     // PreStart -> InitComps -> StartComps.
     if (_driveMode == LLBC_ServiceDriveMode::ExternalDrive)
     {
@@ -434,6 +495,12 @@ int LLBC_ServiceImpl::Send(LLBC_Packet *packet)
     return LockableSend(packet, true, true, true);
 }
 
+int LLBC_ServiceImpl::FlushSends()
+{
+    FlushSendBatches();
+    return LLBC_OK;
+}
+
 int LLBC_ServiceImpl::Multicast(const LLBC_SessionIds &sessionIds,
                                 int opcode,
                                 const void *bytes,
@@ -457,6 +524,10 @@ int LLBC_ServiceImpl::Multicast(const LLBC_SessionIds &sessionIds,
         return LLBC_FAILED;
     }
 
+    // If enabled shared multicast option, call internal method SharedMulticast() to complete.
+    if (_sharedMulticast)
+        return SharedMulticast(sessionIds, opcode, bytes, len, status, flags, true);
+
     // Foreach to call internal method LockableSend() to complete.
     // lock = false
     // checkRunningPhase = false
@@ -495,6 +566,7 @@ int LLBC_ServiceImpl::Broadcast(int opcode,
 
     // Get all non-listen sessionIds.
     thread_local LLBC_SessionIds sessionIds;
+    sessionIds.clear();
 
     _readySessionInfosLock.Lock();
     const auto readySessionInfosEndIt = _readySessionInfos.end();
@@ -512,6 +584,10 @@ int LLBC_ServiceImpl::Broadcast(int opcode,
     if (sessionIds.empty())
         return LLBC_OK;
 
+    // If enabled shared multicast option, call internal method SharedMulticast() to complete.
+    if (_sharedMulticast)
+        return SharedMulticast(sessionIds, opcode, bytes, len, status, flags, false);
+
     // Foreach to call internal method LockableSend() to compolete.
     // lock = false
     // checkRunningPhase = false
@@ -546,6 +622,8 @@ int LLBC_ServiceImpl::RemoveSession(int sessionId, const char *reason)
         return LLBC_FAILED;
     }
 
+    // Flush send batches first, make sure batched packets sent before session close.
+    FlushSendBatches();
     _pollerMgr.Close(sessionId, reason);
 
     delete readySInfoIt->second;
@@ -589,6 +667,7 @@ int LLBC_ServiceImpl::CtrlProtocolStack(int sessionId,
 
     _readySessionInfosLock.Unlock();
 
+    FlushSendBatches();
     _pollerMgr.CtrlProtocolStack(sessionId, ctrlCmd, ctrlData);
 
     return LLBC_OK;
@@ -763,7 +842,7 @@ int LLBC_ServiceImpl::AddCoderFactory(int opcode, LLBC_CoderFactory *coderFactor
     __LLBC_INL_CHECK_RUNNING_PHASE_LE(
         InitingComps, LLBC_ERROR_NOT_ALLOW, LLBC_FAILED);
 
-    if (!_coderFactories.insert(std::make_pair(opcode, coderFactory)).second)
+    if (!_coderFactories.Insert(opcode, coderFactory))
     {
         LLBC_SetLastError(LLBC_ERROR_REPEAT);
         return LLBC_FAILED;
@@ -783,7 +862,7 @@ int LLBC_ServiceImpl::Subscribe(int opcode, const LLBC_Delegate<void(LLBC_Packet
     __LLBC_INL_CHECK_RUNNING_PHASE_LE(
         InitingComps, LLBC_ERROR_NOT_ALLOW, LLBC_FAILED);
 
-    if (!_handlers.insert(std::make_pair(opcode, deleg)).second)
+    if (!_handlers.Insert(opcode, deleg))
     {
         LLBC_SetLastError(LLBC_ERROR_REPEAT);
         return LLBC_FAILED;
@@ -803,7 +882,7 @@ int LLBC_ServiceImpl::PreSubscribe(int opcode, const LLBC_Delegate<bool(LLBC_Pac
     __LLBC_INL_CHECK_RUNNING_PHASE_LE(
         InitingComps, LLBC_ERROR_NOT_ALLOW, LLBC_FAILED);
 
-    if (!_preHandlers.insert(std::make_pair(opcode, deleg)).second)
+    if (!_preHandlers.Insert(opcode, deleg))
     {
         LLBC_SetLastError(LLBC_ERROR_REPEAT);
         return LLBC_FAILED;
@@ -968,6 +1047,10 @@ int LLBC_ServiceImpl::Post(const LLBC_Delegate<void(LLBC_Service *)> &runnable)
     _posts.push_back(runnable);
     _lock.Unlock();
 
+    // If enabled event wakeup option, wakeup service to handle posts immediately.
+    if (_eventWakeup)
+        WakeupMessageWaiting();
+
     return LLBC_OK;
 }
 
@@ -1033,16 +1116,30 @@ void LLBC_ServiceImpl::OnSvc(bool fullFrame)
     // Handle frame-tasks.
     HandlePosts();
 
+    // Frame boundary, flush send batches.
+    FlushSendBatches();
+
     // Process Idle.
     if (fullFrame)
+    {
         ProcessIdle();
+        FlushSendBatches();
+    }
 
     // Sleep FrameInterval - ElapsedTime milli-seconds, if need.
+    // If enabled event wakeup option, wait and handle events/posts until next frame.
     if (fullFrame)
     {
-        const sint64 elapsed = LLBC_GetMilliseconds() - _begSvcTime;
-        if (elapsed >= 0 && elapsed < frameInterval)
-            LLBC_Sleep(static_cast<int>(frameInterval - elapsed));
+        if (_eventWakeup)
+        {
+            HandleEventsUntilNextFrame(frameInterval);
+        }
+        else
+        {
+            const sint64 elapsed = LLBC_GetMilliseconds() - _begSvcTime;
+            if (elapsed >= 0 && elapsed < frameInterval)
+                LLBC_Sleep(static_cast<int>(frameInterval - elapsed));
+        }
     }
 
     // If in stopping phases(StoppingComp/Stopping) and is ExternalDrive mode, Exec cleanup.
@@ -1469,6 +1566,8 @@ int LLBC_ServiceImpl::PreStart()
     }
 
     // Initialize PollerMgr.
+    _pollerMgr.SetReactorMode(_pollerReactorMode);
+    _pollerMgr.SetLockFreeEventQueue(_lockFreeEventQueue);
     if (_pollerMgr.Init(_pollerCount) != LLBC_OK)
         return LLBC_FAILED;
 
@@ -1530,7 +1629,9 @@ LLBC_FORCE_INLINE void LLBC_ServiceImpl::HandlePosts()
     LLBC_ReturnIf(_posts.empty(), void());
 
     std::vector<LLBC_Delegate<void(LLBC_Service *)> > posts;
+    _lock.Lock();
     std::swap(posts, _posts);
+    _lock.Unlock();
 
     const auto endIt = posts.end();
     for (auto it = posts.begin(); it != endIt; ++it)
@@ -1548,15 +1649,36 @@ void LLBC_ServiceImpl::HandleQueuedEvents()
             block = blocks;
             blocks = blocks->GetNext();
 
-            ev = reinterpret_cast<LLBC_ServiceEvent *>(block->GetDataStartWithReadPos());
+            ev = reinterpret_cast<LLBC_ServiceEvent *>(block->GetData());
             (this->*_evHandlers[ev->type])(*ev);
 
-            delete ev;
-            delete block;
+            LLBC_SvcEvUtil::DestroyEvBlock(block);
         }
     }
 }
 
+void LLBC_ServiceImpl::HandleEventsUntilNextFrame(int frameInterval)
+{
+    while (LIKELY(_runningPhase == LLBC_ServiceRunningPhase::Started ||
+                  _runningPhase == LLBC_ServiceRunningPhase::StartingComps))
+    {
+        // Wait events/posts arrival, deadline is next frame boundary.
+        const sint64 elapsed = LLBC_GetMilliseconds() - _begSvcTime;
+        if (elapsed < 0 || elapsed >= frameInterval)
+            break;
+
+        if (TimedWaitMessage(static_cast<int>(frameInterval - elapsed)) != LLBC_OK)
+            continue;
+
+        // Handle posts & queued events.
+        HandlePosts();
+        HandleQueuedEvents();
+
+        // Flush send batches.
+        FlushSendBatches();
+    }
+}
+
 void LLBC_ServiceImpl::HandleEv_SessionCreate(LLBC_ServiceEvent &_)
 {
     typedef LLBC_SvcEv_SessionCreate _Ev;
@@ -1687,12 +1809,11 @@ void LLBC_ServiceImpl::HandleEv_DataArrival(LLBC_ServiceEvent &_)
     if (status != 0)
     {
         # if LLBC_CFG_COMM_ENABLE_STATUS_HANDLER
-        auto stHandlersIt = _statusHandlers.find(opcode);
-        if (stHandlersIt != _statusHandlers.end())
+        auto stHandlers = _statusHandlers.Find(opcode);
+        if (stHandlers)
         {
-            auto &stHandlers = stHandlersIt->second;
-            auto stHandlerIt = stHandlers.find(status);
-            if (stHandlerIt != stHandlers.end())
+            auto stHandlerIt = stHandlers->find(status);
+            if (stHandlerIt != stHandlers->end())
             {
                 stHandlerIt->second(*packet);
                 LLBC_Recycle(packet);
@@ -1705,10 +1826,10 @@ void LLBC_ServiceImpl::HandleEv_DataArrival(LLBC_ServiceEvent &_)
 
     // Firstly, we recognize specified opcode's pre-handler, if registered, call it.
     bool preHandled = false;
-    auto preIt = _preHandlers.find(opcode);
-    if (preIt != _preHandlers.end())
+    auto preHandler = _preHandlers.Find(opcode);
+    if (preHandler)
     {
-        if (!preIt->second(*packet))
+        if (!(*preHandler)(*packet))
         {
             LLBC_Recycle(packet);
             return;
@@ -1730,10 +1851,10 @@ void LLBC_ServiceImpl::HandleEv_DataArrival(LLBC_ServiceEvent &_)
 
     // Finally, search packet handler to handle,
     // if not found any packet handler, dispatch unhandled-packet event to all comps.
-    auto it = _handlers.find(opcode);
-    if (it != _handlers.end())
+    auto handler = _handlers.Find(opcode);
+    if (handler)
     {
-        it->second(*packet);
+        (*handler)(*packet);
     }
     else
     {
@@ -1965,11 +2086,24 @@ int LLBC_ServiceImpl::InitComps()
         return LLBC_FAILED;
     }
 
+    // All coders/handlers registered, compile opcode dispatch tables.
+    CompileDispatchTables();
+
     _runningPhase = LLBC_ServiceRunningPhase::CompsInited;
 
     return LLBC_OK;
 }
 
+void LLBC_ServiceImpl::CompileDispatchTables()
+{
+    _coderFactories.Compile();
+    _handlers.Compile();
+    _preHandlers.Compile();
+    #if LLBC_CFG_COMM_ENABLE_STATUS_HANDLER
+    _statusHandlers.Compile();
+    #endif // LLBC_CFG_COMM_ENABLE_STATUS_HANDLER
+}
+
 // Define component destroy macro.
 #define __LLBC_Inl_DestroyComp(comp, destroyMeth, toPhase)               \
     while (true) {                                                       \
@@ -2307,7 +2441,7 @@ LLBC_FORCE_INLINE int LLBC_ServiceImpl::LockableSend(LLBC_Packet *packet,
     // If enabled full-stack option, send packet and return.
     if (_fullStack)
     {
-        const int ret = _pollerMgr.Send(packet);
+        const int ret = SendToPoller(packet);
         if (lock)
             _lock.Unlock();
 
@@ -2333,7 +2467,7 @@ LLBC_FORCE_INLINE int LLBC_ServiceImpl::LockableSend(LLBC_Packet *packet,
     _readySessionInfosLock.Unlock();
 
     // Send encoded packet.
-    const int ret = _pollerMgr.Send(encoded);
+    const int ret = SendToPoller(encoded);
     if (lock)
         _lock.Unlock();
 
@@ -2363,6 +2497,86 @@ LLBC_FORCE_INLINE int LLBC_ServiceImpl::LockableSend(int sessionId,
     return LockableSend(packet, lock, checkRunningPhase, checkSessionValidity);
 }
 
+int LLBC_ServiceImpl::SharedMulticast(const LLBC_SessionIds &sessionIds,
+                                      int opcode,
+                                      const void *bytes,
+                                      size_t len,
+                                      int status,
+                                      uint32 flags,
+                                      bool checkSessionValidity)
+{
+    // Encode & frame payload once, the frame will be shared by all sessions.
+    LLBC_Packet *packet = _threadSafeObjPool.Acquire<LLBC_Packet>();
+    packet->SetHeader(0, opcode, status, flags);
+    if (UNLIKELY(packet->Write(bytes, len) != LLBC_OK))
+    {
+        LLBC_Recycle(packet);
+        return LLBC_FAILED;
+    }
+
+    LLBC_MessageBlock *frame = LLBC_PacketProtocol::EncodeFrame(packet);
+
+    // Shared frames not batched, flush send batches first to keep packets order.
+    FlushSendBatches();
+
+    // Foreach sessions to send shared frame.
+    const auto sessionIdsEndIt = sessionIds.end();
+    for (auto sessionIt = sessionIds.begin();
+         sessionIt != sessionIdsEndIt;
+         ++sessionIt)
+    {
+        const int sessionId = *sessionIt;
+        if (!_fullStack || checkSessionValidity)
+        {
+            // Check _ReadySessionInfo exist or not, and not allow send to listen session.
+            _readySessionInfosLock.Lock();
+            const auto readySInfoIt = _readySessionInfos.find(sessionId);
+            if (readySInfoIt == _readySessionInfos.end() ||
+                readySInfoIt->second->isListenSession)
+            {
+                _readySessionInfosLock.Unlock();
+                continue;
+            }
+
+            // If codec protocol-stack not support shared frame, fallback to call LockableSend().
+            // lock = false
+            // checkRunningPhase = false
+            if (!_fullStack &&
+                !readySInfoIt->second->codecStack->IsSharedFrameSupported())
+            {
+                _readySessionInfosLock.Unlock();
+                LockableSend(sessionId, opcode, bytes, len, status, flags, false, false, checkSessionValidity);
+
+                continue;
+            }
+
+            _readySessionInfosLock.Unlock();
+        }
+
+        _pollerMgr.SharedSend(sessionId, frame->Share(), opcode, status, flags);
+    }
+
+    // Release the frame, frame buffer will be freed when the last session send finished.
+    LLBC_Recycle(frame);
+
+    return LLBC_OK;
+}
+
+LLBC_FORCE_INLINE int LLBC_ServiceImpl::SendToPoller(LLBC_Packet *packet)
+{
+    if (_sendBatching && LLBC_GetCurrentThreadId() == _svcThreadId)
+        return _pollerMgr.BatchSend(packet);
+
+    return _pollerMgr.Send(packet);
+}
+
+void LLBC_ServiceImpl::FlushSendBatches()
+{
+    if (_sendBatching &&
+        LLBC_GetCurrentThreadId() == _svcThreadId)
+        _pollerMgr.FlushSendBatches();
+}
+
 LLBC_ServiceImpl::_ReadySessionInfo::_ReadySessionInfo(int sessionId,
                                                        int acceptSessionId,
                                                        bool isListenSession,
@@ -23,6 +23,7 @@
 #include "llbc/common/Export.h"
 
 #include "llbc/comm/protocol/ProtocolStack.h"
+#include "llbc/comm/protocol/PacketProtocol.h"
 
 #include "llbc/comm/Packet.h"
 #include "llbc/comm/Socket.h"
@@ -129,11 +130,6 @@ void LLBC_Session::SetService(LLBC_Service *svc)
 
     // Set session to protocol stack.
     _protoStack->SetSession(this);
-
-    // Set socket message block object-pool(if enabled).
-    #if LLBC_CFG_COMM_SESSION_RECV_BUF_USE_OBJ_POOL
-    _socket->SetMsgBlockPoolInst(&_svc->GetMsgBlockObjectPool());
-    #endif // LLBC_CFG_COMM_SESSION_RECV_BUF_USE_OBJ_POOL
 }
 
 void LLBC_Session::SetProtocolStack(LLBC_ProtocolStack *protoStack)
@@ -187,6 +183,23 @@ int LLBC_Session::Send(LLBC_MessageBlock *block)
     return LLBC_OK;
 }
 
+int LLBC_Session::SendSharedFrame(LLBC_MessageBlock *frame, int opcode, int status, uint32 flags)
+{
+    // If protocol stack support shared frame, send it directly(zero copy).
+    if (_protoStack->IsSharedFrameSupported())
+        return Send(frame);
+
+    // Otherwise rebuild packet from frame payload, and send it throw protocol stack.
+    const size_t headerLen = LLBC_PacketProtocol::GetHeaderLength();
+    LLBC_Packet *packet = _svc->GetThreadSafeObjPool().Acquire<LLBC_Packet>();
+    packet->SetHeader(_id, opcode, status, flags);
+    packet->Write(reinterpret_cast<const char *>(frame->GetDataStartWithReadPos()) + headerLen,
+                  frame->GetReadableSize() - headerLen);
+    LLBC_Recycle(frame);
+
+    return Send(packet);
+}
+
 #if LLBC_TARGET_PLATFORM_WIN32
 void LLBC_Session::OnSend(LLBC_POverlapped ol)
 {
@@ -30,6 +30,8 @@
 #include "llbc/comm/PollerType.h"
 #include "llbc/comm/Socket.h"
 #include "llbc/comm/Session.h"
+#include "llbc/comm/BasePoller.h"
+#include "llbc/comm/RecvBufferPool.h"
 
 namespace
 {
@@ -65,16 +67,13 @@ LLBC_Socket::LLBC_Socket(LLBC_SocketHandle handle)
 , _listenSocket(false)
 
 , _maxPacketSize(LLBC_CFG_COMM_DFT_MAX_PACKET_SIZE)
+, _recvBufSizeHint(0)
 
 #if LLBC_TARGET_PLATFORM_WIN32
 , _nonBlocking(false)
 
 , _iocpSendingDataSize(0)
 #endif // LLBC_TARGET_PLATFORM_WIN32
-
-#if LLBC_CFG_COMM_SESSION_RECV_BUF_USE_OBJ_POOL
-, _msgBlockPoolInst(nullptr)
-#endif // LLBC_CFG_COMM_SESSION_RECV_BUF_USE_OBJ_POOL
 {
     if (_handle == LLBC_INVALID_SOCKET_HANDLE)
         _handle = LLBC_CreateTcpSocket();
@@ -93,12 +92,6 @@ void LLBC_Socket::SetSession(LLBC_Session *session)
 {
     _session = session;
 }
-#if LLBC_CFG_COMM_SESSION_RECV_BUF_USE_OBJ_POOL
-void LLBC_Socket::SetMsgBlockPoolInst(LLBC_ObjectPoolInst<LLBC_MessageBlock> *msgBlockPoolInst)
-{
-    _msgBlockPoolInst = msgBlockPoolInst;
-}
-#endif // LLBC_CFG_COMM_SESSION_RECV_BUF_USE_OBJ_POOL
 
 int LLBC_Socket::GetPollerType() const
 {
@@ -171,6 +164,11 @@ int LLBC_Socket::DisableAddressReusable()
     return LLBC_DisableAddressReusable(_handle);
 }
 
+int LLBC_Socket::EnablePortReusable()
+{
+    return LLBC_EnablePortReusable(_handle);
+}
+
 bool LLBC_Socket::IsNoDelay() const
 {
     int noDelay = 0;
@@ -535,16 +533,51 @@ void LLBC_Socket::OnSend()
 
     int len = 0, totalLen = 0;
     const LLBC_MessageBlock *firstBlock = _willSend.FirstBlock();
-    while (firstBlock)
+    if (_session->GetSessionOpts().IsGatherSend())
     {
-        if ((len = LLBC_Send(_handle, 
-                             firstBlock->GetDataStartWithReadPos(), 
-                             static_cast<int>(firstBlock->GetReadableSize()), 0)) < 0)
-            break;
-
-        totalLen += len;
-        _willSend.Remove(len);
-        firstBlock = _willSend.FirstBlock();
+        LLBC_SockBuf bufs[LLBC_CFG_COMM_GATHER_SEND_MAX_BUF_COUNT];
+        while (firstBlock)
+        {
+            // Collect will send blocks, limited by buffer count and bytes.
+            int bufCount = 0;
+            size_t gatherLen = 0;
+            for (const LLBC_MessageBlock *block = firstBlock;
+                 block &&
+                 bufCount < LLBC_CFG_COMM_GATHER_SEND_MAX_BUF_COUNT &&
+                 gatherLen < LLBC_CFG_COMM_GATHER_SEND_MAX_BYTES;
+                 block = block->GetNext())
+            {
+                bufs[bufCount].buf = reinterpret_cast<char *>(block->GetDataStartWithReadPos());
+                bufs[bufCount].len = static_cast<ulong>(block->GetReadableSize());
+                gatherLen += bufs[bufCount++].len;
+            }
+
+            if ((len = LLBC_SendV(_handle, bufs, bufCount)) < 0)
+                break;
+
+            totalLen += len;
+            _willSend.Remove(len);
+
+            // Partial write, socket send buffer full, wait next writable event.
+            if (static_cast<size_t>(len) < gatherLen)
+                break;
+
+            firstBlock = _willSend.FirstBlock();
+        }
+    }
+    else
+    {
+        while (firstBlock)
+        {
+            if ((len = LLBC_Send(_handle,
+                                 firstBlock->GetDataStartWithReadPos(),
+                                 static_cast<int>(firstBlock->GetReadableSize()), 0)) < 0)
+                break;
+
+            totalLen += len;
+            _willSend.Remove(len);
+            firstBlock = _willSend.FirstBlock();
+        }
     }
 
     if (len < 0 && LLBC_GetLastError() != LLBC_ERROR_WBLOCK
@@ -630,85 +663,78 @@ void LLBC_Socket::OnRecv()
 #endif // LLBC_TARGET_PLATFORM_WIN32
 
     int len;
-    bool recvFlag = false;
-    #if LLBC_CFG_COMM_SESSION_RECV_BUF_USE_OBJ_POOL
-    LLBC_MessageBlock *block = _msgBlockPoolInst->GetObject();
-    #else
-    LLBC_MessageBlock *block = new LLBC_MessageBlock(_session->GetSessionOpts().GetSessionRecvBufSize());
-    #endif
-    while ((len = LLBC_Recv(_handle,
-                            block->GetDataStartWithWritePos(),
-                            static_cast<int>(block->GetWritableSize()),
-                            0)) > 0)
+    bool recvFlag;
+    bool bufFull;
+    size_t recvedLen = 0;
+    int errNo = LLBC_ERROR_SUCCESS;
+    int subErrNo = LLBC_ERROR_SUCCESS;
+
+    // Acquire recv buffer from poller recv buffer pool, buffer size adaptive adjust by recent read sizes.
+    LLBC_RecvBufferPool *recvBufPool = _session->GetPoller()->GetRecvBufferPool();
+    if (_recvBufSizeHint == 0)
+        _recvBufSizeHint = _session->GetSessionOpts().GetSessionRecvBufSize();
+
+    do
     {
-        recvFlag = true;
-        block->ShiftWritePos(len);
-        if (block->GetWritableSize() == 0)
+        // Recv data until would block or buffer filled, if buffer filled, process it and
+        // acquire next buffer to continue recv(buffer never expand, always keep in size class).
+        recvFlag = bufFull = false;
+        LLBC_MessageBlock *block = recvBufPool->Acquire(_recvBufSizeHint);
+        while ((len = LLBC_Recv(_handle,
+                                block->GetDataStartWithWritePos(),
+                                static_cast<int>(block->GetWritableSize()),
+                                0)) > 0)
         {
-            #if LLBC_TARGET_PLATFORM_WIN32
-            LLBC_NS ulong pendingBytes;
-            if (UNLIKELY(ioctlsocket(_handle, FIONREAD, &pendingBytes) == SOCKET_ERROR))
-            {
-                LLBC_SetLastError(LLBC_ERROR_NETAPI);
-            #else // Non-Win32
-            int pendingBytes;
-            if (UNLIKELY(::ioctl(_handle, FIONREAD, &pendingBytes) != 0))
+            recvFlag = true;
+            recvedLen += len;
+            block->ShiftWritePos(len);
+            if (block->GetWritableSize() == 0)
             {
-                LLBC_SetLastError(LLBC_ERROR_CLIB);
-            #endif
-                len = -1;
+                bufFull = true;
                 break;
             }
-
-            // If no any ready data to read, set errno to LLBC_ERROR_WBLOCK.
-            if (pendingBytes == 0)
-            {
-                LLBC_SetLastError(LLBC_ERROR_WBLOCK);
-                break;
-            }
-
-            block->Allocate(pendingBytes);
         }
-    }
 
-    // If recv failed, firstly get last error.
-    int errNo = LLBC_ERROR_SUCCESS;
-    int subErrNo = LLBC_ERROR_SUCCESS;
-    if (len < 0)
-    {
-        errNo = LLBC_GetLastError();
-        if (LLBC_ERROR_TYPE_IS_LIBRARY(errNo))
-            subErrNo = 0;
-        else
-            subErrNo = LLBC_GetSubErrorNo();
-    }
+        // Adjust next recv buffer size hint.
+        _recvBufSizeHint = recvBufPool->AdjustSizeHint(_recvBufSizeHint, recvedLen, bufFull);
 
-    // Try process already received data, whether the errors occurred or not.
-    if (recvFlag)
-    {
-        bool sessionRemoved;
-        if (!_session->OnRecved(block, sessionRemoved))
+        // If recv failed, firstly get last error.
+        if (len < 0)
         {
-            #if LLBC_TARGET_PLATFORM_WIN32
-            if (sessionRemoved)
-                return;
+            errNo = LLBC_GetLastError();
+            if (LLBC_ERROR_TYPE_IS_LIBRARY(errNo))
+                subErrNo = 0;
+            else
+                subErrNo = LLBC_GetSubErrorNo();
+        }
 
-            // In WIN32 platform & poller model is IOCP model, we post a Zero-WSASend overlapped.
-            if (len > 0 &&
-                _pollerType == _PollerType::IocpPoller)
+        // Try process already received data, whether the errors occurred or not.
+        if (recvFlag)
+        {
+            bool sessionRemoved;
+            if (!_session->OnRecved(block, sessionRemoved))
             {
-                if (UNLIKELY(PostZeroWSARecv() != LLBC_OK))
-                    _session->OnClose();
-            }
-            #endif // LLBC_TARGET_PLATFORM_WIN32
+                #if LLBC_TARGET_PLATFORM_WIN32
+                if (sessionRemoved)
+                    return;
+
+                // In WIN32 platform & poller model is IOCP model, we post a Zero-WSASend overlapped.
+                if (len > 0 &&
+                    _pollerType == _PollerType::IocpPoller)
+                {
+                    if (UNLIKELY(PostZeroWSARecv() != LLBC_OK))
+                        _session->OnClose();
+                }
+                #endif // LLBC_TARGET_PLATFORM_WIN32
 
-            return;
+                return;
+            }
         }
-    }
-    else
-    {
-        LLBC_Recycle(block);
-    }
+        else
+        {
+            LLBC_Recycle(block);
+        }
+    } while (bufFull);
 
     // Process errors.
     if (len < 0)
@@ -83,10 +83,10 @@ int LLBC_CodecProtocol::Send(void *in, void *&out, bool &removeSession)
 int LLBC_CodecProtocol::Recv(void *in, void *&out, bool &removeSession)
 {
     LLBC_Packet *packet = reinterpret_cast<LLBC_Packet *>(in);
-    Coders::const_iterator it = _coders->find(packet->GetOpcode());
-    if (it != _coders->end())
+    LLBC_CoderFactory * const *coderFactory = _coders->Find(packet->GetOpcode());
+    if (coderFactory)
     {
-        LLBC_Coder *coder = it->second->Create();
+        LLBC_Coder *coder = (*coderFactory)->Create();
         if (UNLIKELY(!coder->Decode(*packet)))
         {
             LLBC_String reportMsg = LLBC_String().format(
@@ -139,4 +139,10 @@ int LLBC_CodecProtocol::Recv(void *in, void *&out, bool &removeSession)
     return LLBC_OK;
 }
 
+bool LLBC_CodecProtocol::IsSharedFrameSupported() const
+{
+    // Shared frame only contain raw bytes payload, not need encode.
+    return true;
+}
+
 __LLBC_NS_END
@@ -52,6 +52,11 @@ int LLBC_CompressProtocol::Recv(void *in, void *&out, bool &removeSession)
     return LLBC_OK;
 }
 
+bool LLBC_CompressProtocol::IsSharedFrameSupported() const
+{
+    return true;
+}
+
 int LLBC_CompressProtocol::AddCoder(int opcode, LLBC_CoderFactory *coder)
 {
     LLBC_SetLastError(LLBC_ERROR_NOT_IMPL);
@@ -75,6 +75,11 @@ bool LLBC_IProtocol::Ctrl(int cmd, const LLBC_Variant &ctrlData, bool &removeSes
     return true;
 }
 
+bool LLBC_IProtocol::IsSharedFrameSupported() const
+{
+    return false;
+}
+
 void LLBC_IProtocol::SetSession(LLBC_Session *session)
 {
     _session = session;
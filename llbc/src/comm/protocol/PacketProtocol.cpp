@@ -58,6 +58,28 @@ void inline __DelPacketList(void *&data)
     data = nullptr;
 }
 
+static void __WriteHeader(LLBC_NS LLBC_MessageBlock *block, const LLBC_NS LLBC_Packet *packet, LLBC_NS uint32 length)
+{
+    LLBC_NS sint32 opcode = packet->GetOpcode();
+    LLBC_NS sint16 status = static_cast<LLBC_NS sint16>(packet->GetStatus());
+    LLBC_NS uint16 flags = static_cast<LLBC_NS uint16>(packet->GetFlags());
+    LLBC_NS sint64 extData1 = packet->GetExtData1();
+
+#if LLBC_CFG_COMM_ORDER_IS_NET_ORDER
+    length = LLBC_NS LLBC_Host2Net(length);
+    opcode = LLBC_NS LLBC_Host2Net(opcode);
+    status = LLBC_NS LLBC_Host2Net(status);
+    flags = LLBC_NS LLBC_Host2Net(flags);
+    extData1 = LLBC_NS LLBC_Host2Net(extData1);
+#endif // Net order.
+
+    block->Write(&length, sizeof(length));
+    block->Write(&opcode, sizeof(opcode));
+    block->Write(&status, sizeof(status));
+    block->Write(&flags, sizeof(flags));
+    block->Write(&extData1, sizeof(extData1));
+}
+
 __LLBC_INTERNAL_NS_END
 
 __LLBC_NS_BEGIN
@@ -83,40 +105,49 @@ int LLBC_PacketProtocol::GetLayer() const
 
 int LLBC_PacketProtocol::Send(void *in, void *&out, bool &removeSession)
 {
-    LLBC_Packet *packet = reinterpret_cast<LLBC_Packet *>(in);
+    out = EncodeFrame(reinterpret_cast<LLBC_Packet *>(in));
 
-    uint32 length = static_cast<uint32>(
-        LLBC_INL_NS __llbc_headerLen + packet->GetPayloadLength());
+    return LLBC_OK;
+}
 
-    // Create block and write header in.
-    LLBC_MessageBlock *block = new LLBC_MessageBlock(length);
+bool LLBC_PacketProtocol::IsSharedFrameSupported() const
+{
+    return true;
+}
 
-    sint32 opcode = packet->GetOpcode();
-    sint16 status = static_cast<sint16>(packet->GetStatus());
-    uint16 flags = static_cast<uint16>(packet->GetFlags());
-    sint64 extData1 = packet->GetExtData1();
+size_t LLBC_PacketProtocol::GetHeaderLength()
+{
+    return LLBC_INL_NS __llbc_headerLen;
+}
 
-#if LLBC_CFG_COMM_ORDER_IS_NET_ORDER
-    length = LLBC_Host2Net(length);
-    opcode = LLBC_Host2Net(opcode);
-    status = LLBC_Host2Net(status);
-    flags = LLBC_Host2Net(flags);
-    extData1 = LLBC_Host2Net(extData1);
-#endif // Net order.
+LLBC_MessageBlock *LLBC_PacketProtocol::EncodeFrame(LLBC_Packet *packet)
+{
+    uint32 length = static_cast<uint32>(
+        LLBC_INL_NS __llbc_headerLen + packet->GetPayloadLength());
 
-    block->Write(&length, sizeof(length));
-    block->Write(&opcode, sizeof(opcode));
-    block->Write(&status, sizeof(status));
-    block->Write(&flags, sizeof(flags));
-    block->Write(&extData1, sizeof(extData1));
+    // Try detach payload and write header into the payload headroom(zero copy),
+    // if payload headroom not enough, create block and write header in.
+    LLBC_MessageBlock *block = packet->DetachPayloadWithHeadroom(LLBC_INL_NS __llbc_headerLen);
+    if (block)
+    {
+        const size_t payloadWritePos = block->GetWritePos();
+        block->SetWritePos(block->GetReadPos());
+        LLBC_INL_NS __WriteHeader(block, packet, length);
+        block->SetWritePos(payloadWritePos);
+    }
+    else
+    {
+        block = new LLBC_MessageBlock(length);
+        LLBC_INL_NS __WriteHeader(block, packet, length);
 
-    // Write packet data and delete packet.
-    block->Write(packet->GetPayload(), packet->GetPayloadLength());
-    LLBC_Recycle(packet);
+        // Write packet data.
+        block->Write(packet->GetPayload(), packet->GetPayloadLength());
+    }
 
-    out = block;
+    // Delete packet.
+    LLBC_Recycle(packet);
 
-    return LLBC_OK;
+    return block;
 }
 
 int LLBC_PacketProtocol::Recv(void *in, void *&out, bool &removeSession)
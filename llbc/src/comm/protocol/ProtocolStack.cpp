@@ -168,6 +168,22 @@ int LLBC_ProtocolStack::SetFilter(LLBC_IProtocolFilter *filter, int toProto)
     return LLBC_OK;
 }
 
+bool LLBC_ProtocolStack::IsSharedFrameSupported() const
+{
+    // Shared frame already packed, pack-layer protocol must exist in Pack/Full stack.
+    if (_type != This::CodecStack && !_protos[_Layer::PackLayer])
+        return false;
+
+    for (int i = _Layer::Begin; i < _Layer::End; ++i)
+    {
+        const LLBC_IProtocol *proto = _protos[i];
+        if (proto && !proto->IsSharedFrameSupported())
+            return false;
+    }
+
+    return true;
+}
+
 int LLBC_ProtocolStack::SendCodec(LLBC_Packet *willEncode, LLBC_Packet *&encoded, bool &removeSession)
 {
     void *in, *out = willEncode;
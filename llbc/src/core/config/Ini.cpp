@@ -29,6 +29,18 @@ namespace
 {
     static const LLBC_NS LLBC_Variant __nil;
     static const LLBC_NS LLBC_String __emptyStr;
+
+    static void __LStrip(const char *str, size_t &beg, size_t end)
+    {
+        while (beg < end && LLBC_IsSpace(str[beg]))
+            ++beg;
+    }
+
+    static void __RStrip(const char *str, size_t beg, size_t &end)
+    {
+        while (end > beg && LLBC_IsSpace(str[end - 1]))
+            --end;
+    }
 }
 
 __LLBC_NS_BEGIN
@@ -144,12 +156,23 @@ int LLBC_Ini::LoadFromContent(const LLBC_String &content)
     LLBC_STLHelper::DeleteContainer(_sections);
     _sectionNames.clear();
 
-    LLBC_String sectionName;
-    const LLBC_Strings lines = content.split("\n");
-    for (size_t i = 0; i < lines.size(); ++i)
+    LLBC_IniSection *section = nullptr;
+    const char *lineBeg = content.data();
+    const char * const contentEnd = lineBeg + content.size();
+    for (size_t lineNum = 1; ; ++lineNum)
     {
-        if (ParseLine(lines[i], i + 1, sectionName) != LLBC_OK)
+        const char *lineEnd =
+            static_cast<const char *>(memchr(lineBeg, '\n', contentEnd - lineBeg));
+        if (lineEnd == nullptr)
+            lineEnd = contentEnd;
+
+        if (ParseLine(lineBeg, lineEnd - lineBeg, lineNum, section) != LLBC_OK)
             return LLBC_FAILED;
+
+        if (lineEnd == contentEnd)
+            break;
+
+        lineBeg = lineEnd + 1;
     }
 
     _errMsg = "success";
@@ -338,159 +361,177 @@ LLBC_Ini &LLBC_Ini::operator=(const This &another)
     return *this;
 }
 
-int LLBC_Ini::ParseLine(const LLBC_String &line, size_t lineNum, LLBC_String &sectionName)
+int LLBC_Ini::ParseLine(const char *line, size_t lineLen, size_t lineNum, LLBC_IniSection *&section)
 {
-    if (line.empty())
+    if (lineLen == 0)
         return LLBC_OK;
 
     // Split non-comment/comment parts.
-    LLBC_String nonComment, comment;
-    int ret = Split(line, lineNum, 0, CommentBegin, nonComment, comment);
+    size_t commentPos;
+    int ret = FindSeparator(line, lineLen, lineNum, 0, CommentBegin, commentPos);
     if (ret != LLBC_OK)
         return LLBC_FAILED;
 
     // Strip non-comment/comment.
-    const size_t nonCommentLen = nonComment.length();
-
-    nonComment.lstrip();
-    const size_t leftStripLen = nonCommentLen - nonComment.length();
-    nonComment.rstrip();
-    if (nonComment.empty())
+    size_t nonCommentBeg = 0;
+    size_t nonCommentEnd = commentPos;
+    __LStrip(line, nonCommentBeg, nonCommentEnd);
+    __RStrip(line, nonCommentBeg, nonCommentEnd);
+    if (nonCommentBeg == nonCommentEnd)
         return LLBC_OK;
 
-    comment.strip();
+    LLBC_String comment;
+    if (commentPos != lineLen)
+    {
+        size_t commentBeg = commentPos + 1;
+        size_t commentEnd = lineLen;
+        __LStrip(line, commentBeg, commentEnd);
+        __RStrip(line, commentBeg, commentEnd);
+        comment.assign(line + commentBeg, commentEnd - commentBeg);
+    }
+
+    const char *nonComment = line + nonCommentBeg;
+    const size_t nonCommentLen = nonCommentEnd - nonCommentBeg;
 
     // Try as section name config to parse.
     bool failedContinue;
-    if ((ret = TryParseSectionName(
-        nonComment, comment, lineNum, leftStripLen, sectionName, failedContinue)) == LLBC_OK ||
+    if ((ret = TryParseSectionName(nonComment,
+                                   nonCommentLen,
+                                   comment,
+                                   lineNum,
+                                   nonCommentBeg,
+                                   section,
+                                   failedContinue)) == LLBC_OK ||
         !failedContinue)
         return ret;
 
     // Split key/value parts.
-    LLBC_String key, value;
-    if ((ret = Split(nonComment, lineNum,
-        leftStripLen, KeyValueSeparator, key, value, true)) != LLBC_OK)
+    size_t sepPos;
+    if ((ret = FindSeparator(nonComment,
+                             nonCommentLen,
+                             lineNum,
+                             nonCommentBeg,
+                             KeyValueSeparator,
+                             sepPos,
+                             true)) != LLBC_OK)
         return ret;
 
     // Right-Strip And UnEscape key.
-    if (key.rstrip().empty())
+    size_t keyEnd = sepPos;
+    __RStrip(nonComment, 0, keyEnd);
+    if (keyEnd == 0)
     {
-        Err_KeyEmpty(lineNum, leftStripLen + 1);
+        Err_KeyEmpty(lineNum, nonCommentBeg + 1);
         LLBC_SetLastError(LLBC_ERROR_FORMAT);
         return LLBC_FAILED;
     }
 
-    size_t unescapedTimes = 0;
-    if ((ret = UnEscape(
-        key, lineNum, leftStripLen, unescapedTimes)) != LLBC_OK)
+    LLBC_String key;
+    if ((ret = UnEscape(nonComment, keyEnd, lineNum, nonCommentBeg, key)) != LLBC_OK)
         return ret;
 
     // Left-Strip And UnEscape value.
-    const size_t unLeftStripValueLen = value.length();
-    size_t valBeginPos = leftStripLen + key.length() + 1;
-
-    value.lstrip();
-    valBeginPos += unLeftStripValueLen - value.length();
-    if ((ret = UnEscape(
-        value, lineNum, valBeginPos, unescapedTimes)) != LLBC_OK)
+    size_t valBeg = sepPos + 1;
+    __LStrip(nonComment, valBeg, nonCommentLen);
+
+    LLBC_String value;
+    if ((ret = UnEscape(nonComment + valBeg,
+                        nonCommentLen - valBeg,
+                        lineNum,
+                        nonCommentBeg + valBeg,
+                        value)) != LLBC_OK)
         return ret;
 
-    if (sectionName.empty())
+    if (section == nullptr)
     {
-        Err_UnSpecificSection(lineNum, leftStripLen + 1);
+        Err_UnSpecificSection(lineNum, nonCommentBeg + 1);
         LLBC_SetLastError(LLBC_ERROR_FORMAT);
         return LLBC_FAILED;
     }
 
     // Store key/value pair to IniSection object.
-    LLBC_IniSection *iniSection = _sections.find(sectionName)->second;
-    if (iniSection->IsHasKey(key))
+    if (!section->_values.emplace(key, LLBC_Variant(value)).second)
     {
-        Err_KeyRepeat(lineNum, leftStripLen + 1, key);
+        Err_KeyRepeat(lineNum, nonCommentBeg + 1, key);
         LLBC_SetLastError(LLBC_ERROR_FORMAT);
         return LLBC_FAILED;
     }
 
-    return iniSection->SetValue(key, value, comment);
+    section->_keys.push_back(key);
+    section->_comments[key] = comment;
+
+    return LLBC_OK;
 }
 
-int LLBC_Ini::TryParseSectionName(const LLBC_String &content,
+int LLBC_Ini::TryParseSectionName(const char *content,
+                                  size_t contentLen,
                                   const LLBC_String &comment,
                                   size_t lineNum,
                                   size_t contentBeginPos,
-                                  LLBC_String &sectionName,
+                                  LLBC_IniSection *&section,
                                   bool &failedContinue)
 {
-    LLBC_String rawSection = content;
-
-    // Unescape.
-    size_t unescapedTimes;
-    if (UnEscape(rawSection, lineNum, contentBeginPos, unescapedTimes) != LLBC_OK)
+    // Unescape(only when content contains escape char).
+    LLBC_String unescaped;
+    if (memchr(content, EscapeChar, contentLen) != nullptr)
     {
-        failedContinue = false;
-        Err_InvalidEscapeFormat(lineNum, contentBeginPos);
-        LLBC_SetLastError(LLBC_ERROR_FORMAT);
+        if (UnEscape(content, contentLen, lineNum, contentBeginPos, unescaped) != LLBC_OK)
+        {
+            failedContinue = false;
+            Err_InvalidEscapeFormat(lineNum, contentBeginPos);
+            LLBC_SetLastError(LLBC_ERROR_FORMAT);
 
-        return LLBC_FAILED;
+            return LLBC_FAILED;
+        }
+
+        content = unescaped.data();
+        contentLen = unescaped.size();
     }
 
     // Confirm format.
-    if (rawSection.length() < 3 ||
-        (rawSection[0] != SectionBegin || 
-         rawSection[rawSection.length() - 1] != SectionEnd))
+    if (contentLen < 3 ||
+        (content[0] != SectionBegin ||
+         content[contentLen - 1] != SectionEnd))
     {
         failedContinue = true;
         return LLBC_FAILED;
     }
 
     // Store section.
-    sectionName = rawSection.substr(1, rawSection.length() - 2);
-    std::map<LLBC_String, LLBC_IniSection *>::iterator it = _sections.find(sectionName);
+    const LLBC_String sectionName(content + 1, contentLen - 2);
+    LLBC_IniSections::iterator it = _sections.find(sectionName);
     if (it == _sections.end())
     {
-        _sections.insert(std::make_pair(sectionName, 
-            new LLBC_IniSection)).first->second->SetSectionComment(comment);
+        section = new LLBC_IniSection;
+        section->SetSectionComment(comment);
+
+        _sections.insert(std::make_pair(sectionName, section));
         _sectionNames.push_back(sectionName);
     }
-    else if (it->second->GetSectionComment().empty())
+    else
     {
-        it->second->SetSectionComment(comment);
+        section = it->second;
+        if (section->GetSectionComment().empty())
+            section->SetSectionComment(comment);
     }
 
     return LLBC_OK;
 }
 
-int LLBC_Ini::Split(const LLBC_String &str,
-                    size_t lineNum,
-                    size_t beginPos,
-                    char sep,
-                    LLBC_String &left,
-                    LLBC_String &right,
-                    bool requireFoundSep)
+int LLBC_Ini::FindSeparator(const char *str,
+                            size_t len,
+                            size_t lineNum,
+                            size_t beginPos,
+                            char sep,
+                            size_t &sepPos,
+                            bool requireFoundSep)
 {
-    left.clear(), right.clear();
-    if (str.empty())
-    {
-        if (requireFoundSep)
-        {
-            Err_SeparatorNotFound(lineNum, beginPos + 1, sep);
-            LLBC_SetLastError(LLBC_ERROR_FORMAT);
-
-            return LLBC_FAILED;
-        }
-
-        return LLBC_OK;
-    }
-
-    bool foundSep = false;
-    const size_t len = str.length();
-    for (size_t pos = 0; pos < str.length(); ++pos)
+    for (size_t pos = 0; pos < len; ++pos)
     {
         const char ch = str[pos];
         if (ch == EscapeChar)
         {
-            if (pos == len - 1 || 
+            if (pos == len - 1 ||
                 BeEscapedChars.find(str[pos + 1]) == LLBC_String::npos)
             {
                 Err_InvalidEscapeFormat(lineNum, beginPos + 1 + pos + 1);
@@ -505,25 +546,18 @@ int LLBC_Ini::Split(const LLBC_String &str,
 
         if (ch == sep)
         {
-            foundSep = true;
-            left = str.substr(0, pos);
-            right = str.substr(pos + 1);
-
-            break;
+            sepPos = pos;
+            return LLBC_OK;
         }
     }
 
-    if (!foundSep)
+    sepPos = len;
+    if (requireFoundSep)
     {
-        if (requireFoundSep)
-        {
-            Err_SeparatorNotFound(lineNum, beginPos + 1 + len, sep);
-            LLBC_SetLastError(LLBC_ERROR_FORMAT);
-
-            return LLBC_FAILED;
-        }
+        Err_SeparatorNotFound(lineNum, beginPos + 1 + len, sep);
+        LLBC_SetLastError(LLBC_ERROR_FORMAT);
 
-        left = str;
+        return LLBC_FAILED;
     }
 
     return LLBC_OK;
@@ -534,21 +568,32 @@ LLBC_String LLBC_Ini::Escape(const LLBC_String &str) const
     return str.escape(BeEscapedChars, EscapeChar);
 }
 
-int LLBC_Ini::UnEscape(LLBC_String &str,
+int LLBC_Ini::UnEscape(const char *str,
+                       size_t len,
                        size_t lineNum,
                        size_t beginPos,
-                       size_t &unescapedTimes)
+                       LLBC_String &unescaped)
 {
-    unescapedTimes = 0;
-    if (str.empty())
+    // Fast path: no escape char found, direct assign.
+    const char *escapeBeg = len != 0 ?
+        static_cast<const char *>(memchr(str, EscapeChar, len)) : nullptr;
+    if (escapeBeg == nullptr)
+    {
+        unescaped.assign(str, len);
         return LLBC_OK;
+    }
 
-    for (size_t i = 0; i < str.length(); ++i)
+    unescaped.reserve(len);
+    unescaped.assign(str, escapeBeg - str);
+    for (size_t i = escapeBeg - str; i < len; ++i)
     {
         if (str[i] != EscapeChar)
+        {
+            unescaped.append(1, str[i]);
             continue;
+        }
 
-        if (i == str.length() - 1 ||
+        if (i == len - 1 ||
             BeEscapedChars.find(str[i + 1]) == LLBC_String::npos)
         {
             Err_InvalidEscapeFormat(lineNum, beginPos + 1 + i + 1);
@@ -557,8 +602,7 @@ int LLBC_Ini::UnEscape(LLBC_String &str,
             return LLBC_FAILED;
         }
 
-        str.erase(i, 1);
-        unescapedTimes += 1;
+        unescaped.append(1, str[++i]);
     }
 
     return LLBC_OK;
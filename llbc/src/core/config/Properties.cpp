@@ -70,32 +70,58 @@ int LLBC_Properties::LoadFromString(const LLBC_String &str,
                                     LLBC_String *errMsg)
 {
     LLBC_String value;
-    LLBC_Strings keyItems;
+    LLBC_String keyItem;
+    std::vector<LLBC_CString> keyItems;
+
+    // The intermediate property nodes of previous line, consecutive lines
+    // usually share the same key prefix, reuse these nodes to avoid lookup again.
+    std::vector<std::pair<LLBC_CString, LLBC_Variant *> > prevNodes;
 
     // Foreach parse property lines.
     properties.BecomeDict();
-    const auto lines = str.split("\n", -1, true);
-    for (size_t i = 0; i < lines.size(); ++i)
+    const char *lineBeg = str.data();
+    const char * const strEnd = lineBeg + str.size();
+    for (int lineNo = 1; ; ++lineNo)
     {
+        const char *lineEnd =
+            static_cast<const char *>(memchr(lineBeg, '\n', strEnd - lineBeg));
+        if (lineEnd == nullptr)
+            lineEnd = strEnd;
+
         // Parse line.
-        value.clear();
         keyItems.clear();
-        if (ParseLine(static_cast<int>(i) + 1, lines[i], keyItems, value, errMsg) != LLBC_OK)
+        if (ParseLine(lineNo, LLBC_CString(lineBeg, lineEnd - lineBeg), keyItems, value, errMsg) != LLBC_OK)
             return LLBC_FAILED;
 
-        // If keyItems is empty, continue.
-        if (keyItems.empty())
-            continue;
-
-        // Fill property line content variant object.
-        LLBC_Variant *prevProperty = &properties;
-        for (size_t i = 0; i < keyItems.size() - 1; ++i)
+        // If keyItems not empty, fill property line content variant object.
+        if (!keyItems.empty())
         {
-            prevProperty = &(*prevProperty)[keyItems[i]];
-            prevProperty->BecomeDict();
+            const size_t nodeCount = keyItems.size() - 1;
+            size_t reusedCount = 0;
+            while (reusedCount < nodeCount &&
+                   reusedCount < prevNodes.size() &&
+                   prevNodes[reusedCount].first == keyItems[reusedCount])
+                ++reusedCount;
+            prevNodes.resize(reusedCount);
+
+            LLBC_Variant *prevProperty = reusedCount != 0 ? prevNodes.back().second : &properties;
+            for (size_t i = reusedCount; i < nodeCount; ++i)
+            {
+                keyItem.assign(keyItems[i].data(), keyItems[i].size());
+                prevProperty = &(*prevProperty)[keyItem];
+                prevProperty->BecomeDict();
+
+                prevNodes.emplace_back(keyItems[i], prevProperty);
+            }
+
+            keyItem.assign(keyItems[nodeCount].data(), keyItems[nodeCount].size());
+            (*prevProperty)[keyItem] = value;
         }
 
-        (*prevProperty)[keyItems[keyItems.size() - 1]] = value;
+        if (lineEnd == strEnd)
+            break;
+
+        lineBeg = lineEnd + 1;
     }
 
     LLBC_DoIf(errMsg, errMsg->assign("Success"));
@@ -154,20 +180,26 @@ int LLBC_Properties::SaveToString(const LLBC_Variant &properties,
 }
 
 int LLBC_Properties::ParseLine(int lineNo,
-                               const LLBC_String &line,
-                               LLBC_Strings &keyItems,
+                               const LLBC_CString &line,
+                               std::vector<LLBC_CString> &keyItems,
                                LLBC_String &value,
                                LLBC_String *errMsg)
 {
     // Skip comment line/empty line.
-    auto lstrippedLine = line.lstrip();
-    if (lstrippedLine.empty() ||
-        lstrippedLine[0] == __LLBC_PropertySeps::CommonBegSep)
+    const char *lineData = line.data();
+    const size_t lineLen = line.size();
+
+    size_t keyBeg = 0;
+    while (keyBeg < lineLen && LLBC_IsSpace(lineData[keyBeg]))
+        ++keyBeg;
+    if (keyBeg == lineLen ||
+        lineData[keyBeg] == __LLBC_PropertySeps::CommonBegSep)
         return LLBC_OK;
 
     // Split key & value, format a.b.c = xxxx
-    const auto keyValuePair = lstrippedLine.split(__LLBC_PropertySeps::KeyValueSep, 1);
-    if (keyValuePair.size() != 2)
+    const char *sep = static_cast<const char *>(
+        memchr(lineData + keyBeg, __LLBC_PropertySeps::KeyValueSep, lineLen - keyBeg));
+    if (sep == nullptr)
     {
         LLBC_SetLastError(LLBC_ERROR_FORMAT);
         LLBC_DoIf(errMsg,
@@ -177,77 +209,70 @@ int LLBC_Properties::ParseLine(int lineNo,
     }
 
     // Split key items.
-    const auto key = keyValuePair[0].strip();
-    keyItems = key.split(__LLBC_PropertySeps::KeyItemSep, -1, false);
+    size_t keyEnd = sep - lineData;
+    while (keyEnd > keyBeg && LLBC_IsSpace(lineData[keyEnd - 1]))
+        --keyEnd;
+
+    size_t itemBeg = keyBeg;
+    for (size_t i = keyBeg; i <= keyEnd; ++i)
+    {
+        if (i != keyEnd && lineData[i] != __LLBC_PropertySeps::KeyItemSep)
+            continue;
+
+        keyItems.emplace_back(lineData + itemBeg, i - itemBeg);
+        itemBeg = i + 1;
+    }
+
     if (!CheckKeyItems(keyItems))
     {
         LLBC_SetLastError(LLBC_ERROR_FORMAT);
-        LLBC_DoIf(errMsg, errMsg->format("#%d: Property key invalid, key:'%s'", lineNo, key.c_str()));
+        LLBC_DoIf(errMsg, errMsg->format("#%d: Property key invalid, key:'%.*s'",
+                                         lineNo, static_cast<int>(keyEnd - keyBeg), lineData + keyBeg));
         return LLBC_FAILED;
     }
 
     // Get value.
-    size_t valueEndPos = LLBC_String::npos;
-    const auto &valueComment = keyValuePair[1].lstrip();
-    for (size_t i = 0; i < valueComment.size(); ++i)
+    size_t valueBeg = sep - lineData + 1;
+    while (valueBeg < lineLen && LLBC_IsSpace(lineData[valueBeg]))
+        ++valueBeg;
+
+    size_t valueEnd = lineLen;
+    for (size_t i = valueBeg; i < lineLen; ++i)
     {
         // If ch is not a common begin separator, continue.
-        if (valueComment[i] != __LLBC_PropertySeps::CommonBegSep)
+        if (lineData[i] != __LLBC_PropertySeps::CommonBegSep)
             continue;
 
         // Count consecutive escape char count.
         size_t escapeCharCnt = 0;
-        for (int j = static_cast<int>(i - 1); j >= 0; --j)
-        {
-            if (valueComment[j] != __LLBC_PropertySeps::EscapeChar)
-                break;
+        for (size_t j = i; j > valueBeg && lineData[j - 1] == __LLBC_PropertySeps::EscapeChar; --j)
             ++escapeCharCnt;
-        }
 
         // If consecutive escape char count is even, mark as value end.
         if (escapeCharCnt % 2 == 0)
         {
-            valueEndPos = i;
+            valueEnd = i;
             break;
         }
     }
 
-    const auto rawValue =
-        valueEndPos != LLBC_String::npos ? valueComment.substr(0, valueEndPos) : valueComment;
-
-    // Right-Strip value.
-    size_t rstripPos = rawValue.size();
-    for (int i = static_cast<int>(rawValue.size()) - 1; i >= 0; --i)
+    // Right-Strip value(escaped spaces are kept).
+    while (valueEnd > valueBeg && LLBC_IsSpace(lineData[valueEnd - 1]))
     {
-        // If ch is not a space, break.
-        if (!LLBC_IsSpace(rawValue[i]))
-            break;
-
         // Count consecutive escape char count.
         size_t escapeCharCnt = 0;
-        for (int j = i - 1; j >= 0; --j)
-        {
-            if (rawValue[j] != __LLBC_PropertySeps::EscapeChar)
-                break;
+        for (size_t j = valueEnd - 1; j > valueBeg && lineData[j - 1] == __LLBC_PropertySeps::EscapeChar; --j)
             ++escapeCharCnt;
-        }
 
-        // If consecutive escape char count is even, mark as value end.
-        if (escapeCharCnt % 2 == 0)
-        {
-            rstripPos = i;
-            continue;
-        }
+        // If consecutive escape char count is odd, space is escaped, stop strip.
+        if (escapeCharCnt % 2 != 0)
+            break;
+
+        --valueEnd;
     }
 
     // Unescape value(process escape).
-    if (UnescapeValue(lineNo,
-                      rstripPos != rawValue.size() ? rawValue.substr(0, rstripPos) : rawValue,
-                      value,
-                      errMsg) != LLBC_OK)
-        return LLBC_FAILED;
-
-    return LLBC_OK;
+    return UnescapeValue(lineNo, LLBC_CString(lineData + valueBeg, valueEnd - valueBeg), value, errMsg);
 }
 
 int LLBC_Properties::SaveLine(const LLBC_String key,
@@ -277,7 +302,7 @@ int LLBC_Properties::SaveLine(const LLBC_String key,
             const auto keyItem = it->first.AsStr();
             const auto newPropKey =
                 key.empty() ? keyItem : key + __LLBC_PropertySeps::KeyItemSep + keyItem;
-            if (!CheckKeyItem(keyItem))
+            if (!CheckKeyItem(LLBC_CString(keyItem)))
             {
                 LLBC_DoIf(errMsg, errMsg->format("Property key invalid, key:'%s'", newPropKey.c_str()));
                 LLBC_SetLastError(LLBC_ERROR_FORMAT);
@@ -294,7 +319,7 @@ int LLBC_Properties::SaveLine(const LLBC_String key,
     return writePropLine();
 }
 
-bool LLBC_Properties::CheckKeyItem(const LLBC_String &keyItem)
+bool LLBC_Properties::CheckKeyItem(const LLBC_CString &keyItem)
 {
     if (keyItem.empty())
         return false;
@@ -312,7 +337,7 @@ bool LLBC_Properties::CheckKeyItem(const LLBC_String &keyItem)
     return true;
 }
 
-bool LLBC_Properties::CheckKeyItems(const LLBC_Strings &keyItems)
+bool LLBC_Properties::CheckKeyItems(const std::vector<LLBC_CString> &keyItems)
 {
     if (keyItems.empty())
         return false;
@@ -340,32 +365,35 @@ void LLBC_Properties::EscapeValue(const LLBC_String &rawValue, LLBC_String &esca
 }
 
 int LLBC_Properties::UnescapeValue(int lineNo,
-                                   const LLBC_String &escapedValue,
+                                   const LLBC_CString &escapedValue,
                                    LLBC_String &rawValue,
                                    LLBC_String *errMsg)
 {
+    const char *escapedData = escapedValue.data();
+    const size_t escapedSize = escapedValue.size();
+
     rawValue.clear();
-    for (size_t i = 0; i < escapedValue.size(); ++i)
+    for (size_t i = 0; i < escapedSize; ++i)
     {
-        if (escapedValue[i] == __LLBC_PropertySeps::EscapeChar)
+        if (escapedData[i] == __LLBC_PropertySeps::EscapeChar)
         {
-            if (i + 1 == escapedValue.size())
+            if (i + 1 == escapedSize)
             {
                 LLBC_DoIf(errMsg,
-                          errMsg->format("#%d: Found escape char('\\') at value end, value:'%s'",
-                                         lineNo, escapedValue.c_str()));
+                          errMsg->format("#%d: Found escape char('\\') at value end, value:'%.*s'",
+                                         lineNo, static_cast<int>(escapedSize), escapedData));
                 LLBC_SetLastError(LLBC_ERROR_FORMAT);
                 return LLBC_FAILED;
             }
 
-            const auto &nextCh = escapedValue[i + 1];
+            const auto &nextCh = escapedData[i + 1];
             if (!LLBC_IsSpace(nextCh) &&
                 nextCh != __LLBC_PropertySeps::EscapeChar &&
                 nextCh != __LLBC_PropertySeps::CommonBegSep)
             {
                 LLBC_DoIf(errMsg,
-                          errMsg->format("#%d: Found invalid escape char('\\%c') at value, value:'%s'",
-                                         lineNo, nextCh, escapedValue.c_str()));
+                          errMsg->format("#%d: Found invalid escape char('\\%c') at value, value:'%.*s'",
+                                         lineNo, nextCh, static_cast<int>(escapedSize), escapedData));
                 LLBC_SetLastError(LLBC_ERROR_FORMAT);
                 return LLBC_FAILED;
             }
@@ -375,7 +403,11 @@ int LLBC_Properties::UnescapeValue(int lineNo,
         }
         else
         {
-            rawValue.append(1, escapedValue[i]);
+            const char *escapeChar = static_cast<const char *>(
+                memchr(escapedData + i, __LLBC_PropertySeps::EscapeChar, escapedSize - i));
+            const size_t plainEnd = escapeChar != nullptr ? escapeChar - escapedData : escapedSize;
+            rawValue.append(escapedData + i, plainEnd - i);
+            i = plainEnd - 1;
         }
     }
 
@@ -39,17 +39,52 @@ __LLBC_NS_BEGIN
 
 LLBC_EventMgr::_ListenerInfo::_ListenerInfo()
 : evId(0)
+, removed(false)
 , stub(0)
 , listener(nullptr)
 {
 }
 
+LLBC_EventMgr::_ListenerInfo::_ListenerInfo(_ListenerInfo &&other) noexcept
+: evId(other.evId)
+, removed(other.removed)
+, stub(other.stub)
+, listener(other.listener)
+, deleg(std::move(other.deleg))
+{
+    other.listener = nullptr;
+}
+
 LLBC_EventMgr::_ListenerInfo::~_ListenerInfo()
 {
     if (listener)
         LLBC_Recycle(listener);
 }
 
+LLBC_EventMgr::_ListenerInfo &LLBC_EventMgr::_ListenerInfo::operator=(_ListenerInfo &&other) noexcept
+{
+    if (this == &other)
+        return *this;
+
+    if (listener)
+        LLBC_Recycle(listener);
+
+    evId = other.evId;
+    removed = other.removed;
+    stub = other.stub;
+    listener = other.listener;
+    deleg = std::move(other.deleg);
+
+    other.listener = nullptr;
+
+    return *this;
+}
+
+LLBC_EventMgr::_EventListeners::_EventListeners()
+: tombstoneCount(0)
+{
+}
+
 LLBC_EventMgr::LLBC_EventMgr()
 : _firing(0)
 , _pendingRemoveAllListeners(false)
@@ -71,9 +106,9 @@ LLBC_EventMgr::~LLBC_EventMgr()
     // Assert: Make sure pending event operations is empty.
     llbc_assert(_pendingEventOps.empty() && "llbc framework internal error: _pendingEventOps is not empty!");
 
-    // Recycle all listener infos.
-    for (auto it = _id2ListenerInfos.begin(); it != _id2ListenerInfos.end(); ++it)
-        LLBC_STLHelper::RecycleContainer(it->second);
+    // Delete all event listeners.
+    LLBC_STLHelper::DeleteContainer(_directEvListeners);
+    LLBC_STLHelper::DeleteContainer(_sparseEvListeners);
 }
 
 #if LLBC_CFG_CORE_ENABLE_EVENT_HOOK
@@ -99,10 +134,10 @@ LLBC_ListenerStub LLBC_EventMgr::AddListener(int id,
     if (AddListenerCheck(boundStub, stub) != LLBC_OK)
         return 0;
 
-    _ListenerInfo *listenerInfo = new _ListenerInfo;
-    listenerInfo->evId = id;
-    listenerInfo->stub = stub;
-    listenerInfo->deleg = listener;
+    _ListenerInfo listenerInfo;
+    listenerInfo.evId = id;
+    listenerInfo.stub = stub;
+    listenerInfo.deleg = listener;
 
     AddListenerInfo(listenerInfo);
 
@@ -123,10 +158,10 @@ LLBC_ListenerStub LLBC_EventMgr::AddListener(int id,
     if (AddListenerCheck(boundStub, stub) != LLBC_OK)
         return 0;
 
-    _ListenerInfo *listenerInfo = new _ListenerInfo;
-    listenerInfo->evId = id;
-    listenerInfo->stub = stub;
-    listenerInfo->listener = listener;
+    _ListenerInfo listenerInfo;
+    listenerInfo.evId = id;
+    listenerInfo.stub = stub;
+    listenerInfo.listener = listener;
 
     AddListenerInfo(listenerInfo);
 
@@ -156,19 +191,13 @@ int LLBC_EventMgr::RemoveListener(int id)
     }
 
     // Find event listeners and remove it.
-    const auto idIt = _id2ListenerInfos.find(id);
-    if (idIt == _id2ListenerInfos.end())
+    if (!FindEventListeners(id))
     {
         LLBC_SetLastError(LLBC_ERROR_NOT_FOUND);
         return LLBC_FAILED;
     }
 
-    _ListenerInfos &listenerInfos = idIt->second;
-    for (auto it = listenerInfos.begin(); it != listenerInfos.end(); ++it)
-        _stub2ListenerInfos.erase((*it)->stub);
-
-    LLBC_STLHelper::RecycleContainer(listenerInfos);
-    _id2ListenerInfos.erase(idIt);
+    DeleteEventListeners(id);
 
     return LLBC_OK;
 }
@@ -182,38 +211,56 @@ int LLBC_EventMgr::RemoveListener(const LLBC_ListenerStub &stub)
         return LLBC_FAILED;
     }
 
-    // If in firing, pending operation.
+    // Find listener.
+    const auto stubIt = _stub2EvIds.find(stub);
+    _EventListeners *evListeners = stubIt != _stub2EvIds.end() ? FindEventListeners(stubIt->second) : nullptr;
+    _ListenerInfo *listenerInfo = nullptr;
+    if (evListeners)
+    {
+        for (auto &info : evListeners->infos)
+        {
+            if (info.stub == stub)
+            {
+                listenerInfo = &info;
+                break;
+            }
+        }
+    }
+
+    // If in firing, tombstone the listener(if found) and pending operation.
     if (IsFiring())
     {
+        if (listenerInfo && !listenerInfo->removed)
+        {
+            listenerInfo->removed = true;
+            if (evListeners->tombstoneCount++ == 0)
+                _tombstonedEvIds.push_back(listenerInfo->evId);
+        }
+
         _PendingEventOp *pendingOp = new _PendingEventOp(_PendingEventOp::RemoveListenerByStub);
         pendingOp->opInfo.eventStub = stub;
         _pendingEventOps.push_back(pendingOp);
-        _pendingRemoveStubs_.insert(stub);
 
         LLBC_SetLastError(LLBC_ERROR_PENDING);
 
         return LLBC_FAILED;
     }
 
-    // Find listener and remove it.
-    const auto stubIt = _stub2ListenerInfos.find(stub);
-    if (stubIt == _stub2ListenerInfos.end())
+    if (!listenerInfo)
     {
         LLBC_SetLastError(LLBC_ERROR_NOT_FOUND);
         return LLBC_FAILED;
     }
 
-    const int evId = stubIt->second.first;
-    const auto idIt = _id2ListenerInfos.find(evId);
-    _ListenerInfos &listenerInfos = idIt->second;
-
-    _ListenerInfos::iterator &listenerIt = stubIt->second.second;
-    LLBC_Recycle(*listenerIt);
-    listenerInfos.erase(listenerIt);
-    if (listenerInfos.empty())
-        _id2ListenerInfos.erase(idIt);
+    // Remove listener, tombstoned listener will be removed in compaction.
+    _stub2EvIds.erase(stubIt);
+    if (listenerInfo->removed)
+        return LLBC_OK;
 
-    _stub2ListenerInfos.erase(stubIt);
+    if (evListeners->infos.size() == 1)
+        DeleteEventListeners(listenerInfo->evId);
+    else
+        evListeners->infos.erase(evListeners->infos.begin() + (listenerInfo - evListeners->infos.data()));
 
     return LLBC_OK;
 }
@@ -230,9 +277,9 @@ int LLBC_EventMgr::RemoveAllListeners()
         return LLBC_FAILED;
     }
 
-    _stub2ListenerInfos.clear();
-    for (auto &listenerInfosItem : _id2ListenerInfos)
-        LLBC_STLHelper::RecycleContainer(listenerInfosItem.second);
+    _stub2EvIds.clear();
+    LLBC_STLHelper::DeleteContainer(_directEvListeners);
+    LLBC_STLHelper::DeleteContainer(_sparseEvListeners);
 
     return LLBC_OK;
 }
@@ -263,19 +310,23 @@ int LLBC_EventMgr::Fire(LLBC_Event *ev)
     }
 
     // Call all listeners.
-    const auto idIt = _id2ListenerInfos.find(ev->GetId());
-    if (idIt != _id2ListenerInfos.end() && !idIt->second.empty())
+    // Note: In firing, listeners add/remove operations will be pending(remove by stub operation will
+    //       tombstone the listener), so listener infos array will not be reallocated in here.
+    _EventListeners *evListeners = FindEventListeners(ev->GetId());
+    if (evListeners)
     {
-        for (auto &listenerInfo : idIt->second)
+        _ListenerInfo *listenerInfos = evListeners->infos.data();
+        const size_t listenerCount = evListeners->infos.size();
+        for (size_t i = 0; i < listenerCount; ++i)
         {
-            if (!_pendingRemoveStubs_.empty() &&
-                _pendingRemoveStubs_.find(listenerInfo->stub) != _pendingRemoveStubs_.end())
+            _ListenerInfo &listenerInfo = listenerInfos[i];
+            if (UNLIKELY(listenerInfo.removed))
                 continue;
 
-            if (listenerInfo->deleg)
-                listenerInfo->deleg(*ev);
+            if (listenerInfo.deleg)
+                listenerInfo.deleg(*ev);
             else
-                listenerInfo->listener->Invoke(*ev);
+                listenerInfo.listener->Invoke(*ev);
         }
     }
 
@@ -299,7 +350,7 @@ LLBC_EventFirer LLBC_EventMgr::BeginFire(int evId)
 
 bool LLBC_EventMgr::HasStub(const LLBC_ListenerStub &stub) const
 {
-    return _stub2ListenerInfos.find(stub) != _stub2ListenerInfos.end();
+    return _stub2EvIds.find(stub) != _stub2EvIds.end();
 }
 
 int LLBC_EventMgr::BeforeFireEvent(LLBC_Event *ev)
@@ -359,14 +410,17 @@ void LLBC_EventMgr::AfterFireEvent(LLBC_Event *ev)
                 "llbc framework internal error: LLBC_EventMgr._firingEventIds is not empty!");
     #endif // LLBC_CFG_CORE_ENABLE_EVENT_FIRE_DEAD_LOOP_DETECTION
 
+    // Fast path: no pending event ops.
+    if (LIKELY(_pendingEventOps.empty()))
+        return;
+
     // Process pending event ops(add/remove).
     for (auto &pendingEventOp : _pendingEventOps)
     {
         const auto opType = pendingEventOp->opType;
         if (opType == _PendingEventOp::AddListener)
         {
-            AddListenerInfo(pendingEventOp->opInfo.listenerInfo);
-            pendingEventOp->opInfo.listenerInfo = nullptr;
+            AddListenerInfo(*pendingEventOp->opInfo.listenerInfo);
         }
         else if (opType == _PendingEventOp::RemoveAllListeners)
         {
@@ -385,7 +439,9 @@ void LLBC_EventMgr::AfterFireEvent(LLBC_Event *ev)
     LLBC_STLHelper::DeleteContainer(_pendingEventOps);
     _pendingRemoveAllListeners = false;
     _pendingRemoveEventIds_.clear();
-    _pendingRemoveStubs_.clear();
+
+    // Compact tombstoned event listeners.
+    CompactEventListeners();
 }
 
 LLBC_EventMgr::_PendingEventOp::_PendingEventOp(_PendingEventOpType opType)
@@ -422,12 +478,12 @@ int LLBC_EventMgr::AddListenerCheck(const LLBC_ListenerStub &boundStub, LLBC_Lis
     return LLBC_OK;
 }
 
-int LLBC_EventMgr::AddListenerInfo(_ListenerInfo *listenerInfo)
+int LLBC_EventMgr::AddListenerInfo(_ListenerInfo &listenerInfo)
 {
     if (IsFiring())
     {
         _PendingEventOp *pendingOp = new _PendingEventOp(_PendingEventOp::AddListener);
-        pendingOp->opInfo.listenerInfo = listenerInfo;
+        pendingOp->opInfo.listenerInfo = new _ListenerInfo(std::move(listenerInfo));
         _pendingEventOps.push_back(pendingOp);
 
         LLBC_SetLastError(LLBC_ERROR_PENDING);
@@ -435,12 +491,86 @@ int LLBC_EventMgr::AddListenerInfo(_ListenerInfo *listenerInfo)
         return LLBC_FAILED;
     }
 
-    auto &listenerInfos = _id2ListenerInfos[listenerInfo->evId];
-    listenerInfos.push_back(listenerInfo);
-
-    _stub2ListenerInfos[listenerInfo->stub] = std::make_pair(listenerInfo->evId, --listenerInfos.end());
+    _stub2EvIds[listenerInfo.stub] = listenerInfo.evId;
+    GetEventListeners(listenerInfo.evId).infos.emplace_back(std::move(listenerInfo));
 
     return LLBC_OK;
 }
 
+LLBC_FORCE_INLINE LLBC_EventMgr::_EventListeners *LLBC_EventMgr::FindEventListeners(int id) const
+{
+    if (LIKELY(id < LLBC_CFG_CORE_EVENT_DIRECT_INDEX_ID_LIMIT))
+        return static_cast<size_t>(id) < _directEvListeners.size() ? _directEvListeners[id] : nullptr;
+
+    const auto it = _sparseEvListeners.find(id);
+    return it != _sparseEvListeners.end() ? it->second : nullptr;
+}
+
+LLBC_EventMgr::_EventListeners &LLBC_EventMgr::GetEventListeners(int id)
+{
+    _EventListeners **evListeners;
+    if (id < LLBC_CFG_CORE_EVENT_DIRECT_INDEX_ID_LIMIT)
+    {
+        if (static_cast<size_t>(id) >= _directEvListeners.size())
+            _directEvListeners.resize(
+                MIN(MAX(static_cast<size_t>(id) + 1, _directEvListeners.size() * 2),
+                    static_cast<size_t>(LLBC_CFG_CORE_EVENT_DIRECT_INDEX_ID_LIMIT)));
+
+        evListeners = &_directEvListeners[id];
+    }
+    else
+    {
+        evListeners = &_sparseEvListeners[id];
+    }
+
+    if (!*evListeners)
+        *evListeners = new _EventListeners;
+
+    return **evListeners;
+}
+
+void LLBC_EventMgr::DeleteEventListeners(int id)
+{
+    _EventListeners *evListeners;
+    if (id < LLBC_CFG_CORE_EVENT_DIRECT_INDEX_ID_LIMIT)
+    {
+        evListeners = _directEvListeners[id];
+        _directEvListeners[id] = nullptr;
+    }
+    else
+    {
+        const auto it = _sparseEvListeners.find(id);
+        evListeners = it->second;
+        _sparseEvListeners.erase(it);
+    }
+
+    for (auto &listenerInfo : evListeners->infos)
+        _stub2EvIds.erase(listenerInfo.stub);
+
+    delete evListeners;
+}
+
+void LLBC_EventMgr::CompactEventListeners()
+{
+    for (auto &evId : _tombstonedEvIds)
+    {
+        // Event listeners maybe removed(or recreated) by pending operations.
+        _EventListeners *evListeners = FindEventListeners(evId);
+        if (!evListeners || evListeners->tombstoneCount == 0)
+            continue;
+
+        auto &infos = evListeners->infos;
+        infos.erase(std::remove_if(infos.begin(),
+                                   infos.end(),
+                                   [](const _ListenerInfo &listenerInfo) { return listenerInfo.removed; }),
+                    infos.end());
+        evListeners->tombstoneCount = 0;
+
+        if (infos.empty())
+            DeleteEventListeners(evId);
+    }
+
+    _tombstonedEvIds.clear();
+}
+
 __LLBC_NS_END
@@ -26,6 +26,195 @@
 
 #include "llbc/core/log/LogData.h"
 
+__LLBC_INTERNAL_NS_BEGIN
+
+/**
+ * Deferred format argument type tags.
+ */
+enum
+{
+    __LogFmtArg_Int32 = 1,
+    __LogFmtArg_Int64,
+    __LogFmtArg_Double,
+    __LogFmtArg_LongDouble,
+    __LogFmtArg_Str,
+    __LogFmtArg_NullStr,
+    __LogFmtArg_Ptr,
+};
+
+/**
+ * Format conversion specification.
+ */
+struct __LogFmtSpec
+{
+    const char *beg; // Specification begin(point to '%').
+    int len;         // Specification length.
+    bool widthStar;  // Width given by argument('*').
+    bool precStar;   // Precision given by argument('*').
+    int prec;        // Precision, -1 if not specific.
+    char lenMod;     // Length modifier, 'H': hh, 'q': ll.
+    char conv;       // Conversion specifier.
+};
+
+/**
+ * Parse format conversion specification, p must point to '%'.
+ */
+static bool __ParseLogFmtSpec(const char *p, __LogFmtSpec &spec)
+{
+    spec.beg = p++;
+    spec.widthStar = false;
+    spec.precStar = false;
+    spec.prec = -1;
+    spec.lenMod = '\0';
+
+    // Flags.
+    while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0')
+        ++p;
+
+    // Width.
+    if (*p == '*')
+    {
+        spec.widthStar = true;
+        ++p;
+    }
+    else
+    {
+        while (*p >= '0' && *p <= '9')
+            ++p;
+    }
+
+    // Precision.
+    if (*p == '.')
+    {
+        if (*++p == '*')
+        {
+            spec.precStar = true;
+            ++p;
+        }
+        else
+        {
+            spec.prec = 0;
+            while (*p >= '0' && *p <= '9')
+                spec.prec = spec.prec * 10 + (*p++ - '0');
+        }
+    }
+
+    // Length modifier.
+    if (*p == 'h' || *p == 'l')
+    {
+        spec.lenMod = *p;
+        if (*++p == spec.lenMod)
+        {
+            spec.lenMod = spec.lenMod == 'h' ? 'H' : 'q';
+            ++p;
+        }
+    }
+    else if (*p == 'j' || *p == 'z' || *p == 't' || *p == 'L')
+    {
+        spec.lenMod = *p++;
+    }
+
+    spec.conv = *p;
+    spec.len = static_cast<int>(p + 1 - spec.beg);
+
+    return spec.conv != '\0' && spec.len < 32;
+}
+
+/**
+ * Append deferred format argument to log data.
+ */
+template <typename T>
+static LLBC_FORCE_INLINE void __PutLogFmtArg(LLBC_NS LLBC_LogData &data, char tag, const T &val)
+{
+    const int size = static_cast<int>(sizeof(char) + sizeof(T));
+    if (UNLIKELY(data.fmtArgsLen + size > data.fmtArgsCap))
+    {
+        data.fmtArgsCap = MAX(data.fmtArgsLen + size, MAX(data.fmtArgsCap * 2, 64));
+        data.fmtArgs = LLBC_Realloc(char, data.fmtArgs, data.fmtArgsCap);
+    }
+
+    char *buf = data.fmtArgs + data.fmtArgsLen;
+    *buf = tag;
+    memcpy(buf + 1, &val, sizeof(T));
+    data.fmtArgsLen += size;
+}
+
+/**
+ * Append deferred format integer argument to log data.
+ */
+template <typename T>
+static LLBC_FORCE_INLINE void __PutLogFmtIntArg(LLBC_NS LLBC_LogData &data, T val)
+{
+    if (sizeof(T) <= sizeof(LLBC_NS sint32))
+        __PutLogFmtArg(data, __LogFmtArg_Int32, static_cast<LLBC_NS sint32>(val));
+    else
+        __PutLogFmtArg(data, __LogFmtArg_Int64, static_cast<LLBC_NS sint64>(val));
+}
+
+/**
+ * Append deferred format string argument to log data(string will be copied).
+ */
+static void __PutLogFmtStrArg(LLBC_NS LLBC_LogData &data, const char *str, int prec)
+{
+    if (!str)
+    {
+        __PutLogFmtArg(data, __LogFmtArg_NullStr, '\0');
+        return;
+    }
+
+    // Calculate copy length, string maybe not null-terminated if precision specific.
+    LLBC_NS uint32 len = 0;
+    const LLBC_NS uint32 maxLen = static_cast<LLBC_NS uint32>(
+        prec >= 0 ? MIN(prec, (LLBC_CFG_LOG_FORMAT_BUF_SIZE)) : (LLBC_CFG_LOG_FORMAT_BUF_SIZE));
+    while (len < maxLen && str[len] != '\0')
+        ++len;
+
+    __PutLogFmtArg(data, __LogFmtArg_Str, len);
+    if (UNLIKELY(data.fmtArgsLen + static_cast<int>(len) + 1 > data.fmtArgsCap))
+    {
+        data.fmtArgsCap = MAX(data.fmtArgsLen + static_cast<int>(len) + 1, data.fmtArgsCap * 2);
+        data.fmtArgs = LLBC_Realloc(char, data.fmtArgs, data.fmtArgsCap);
+    }
+
+    memcpy(data.fmtArgs + data.fmtArgsLen, str, len);
+    data.fmtArgs[data.fmtArgsLen + len] = '\0';
+    data.fmtArgsLen += static_cast<int>(len) + 1;
+}
+
+/**
+ * Read deferred format argument.
+ */
+template <typename T>
+static LLBC_FORCE_INLINE T __GetLogFmtArg(const char *&args)
+{
+    T val;
+    memcpy(&val, args, sizeof(T));
+    args += sizeof(T);
+
+    return val;
+}
+
+/**
+ * Format single conversion specification.
+ */
+template <typename T>
+static LLBC_FORCE_INLINE int __FormatLogFmtArg(char *buf,
+                                               size_t bufSize,
+                                               const char *spec,
+                                               int starCount,
+                                               const int *stars,
+                                               T val)
+{
+    if (starCount == 0)
+        return snprintf(buf, bufSize, spec, val);
+    else if (starCount == 1)
+        return snprintf(buf, bufSize, spec, stars[0], val);
+    else
+        return snprintf(buf, bufSize, spec, stars[0], stars[1], val);
+}
+
+__LLBC_INTERNAL_NS_END
+
 __LLBC_NS_BEGIN
 // Note: Some data members don't need init.
 LLBC_LogData::LLBC_LogData()
@@ -46,6 +235,13 @@ LLBC_LogData::LLBC_LogData()
 
 // , threadId(LLBC_INVALID_NATIVE_THREAD_ID)
 
+, next(nullptr)
+
+, fmt(nullptr)
+, fmtArgs(nullptr)
+, fmtArgsLen(0)
+, fmtArgsCap(0)
+
 , _typedObjPool(nullptr)
 {
 }
@@ -54,6 +250,228 @@ LLBC_LogData::~LLBC_LogData()
 {
     if (msg)
         free(msg);
+    if (fmtArgs)
+        free(fmtArgs);
+}
+
+int LLBC_LogData::CaptureFmtArgs(const char *fmt, va_list va)
+{
+    fmtArgsLen = 0;
+
+    LLBC_INL_NS __LogFmtSpec spec;
+    const char *p = fmt;
+    while ((p = strchr(p, '%')) != nullptr)
+    {
+        // Skip "%%".
+        if (p[1] == '%')
+        {
+            p += 2;
+            continue;
+        }
+
+        // Parse conversion specification.
+        if (UNLIKELY(!LLBC_INL_NS __ParseLogFmtSpec(p, spec)))
+            break;
+        p += spec.len;
+
+        // Capture width/precision arguments.
+        if (spec.widthStar)
+            LLBC_INL_NS __PutLogFmtIntArg(*this, va_arg(va, int));
+        if (spec.precStar)
+        {
+            spec.prec = va_arg(va, int);
+            LLBC_INL_NS __PutLogFmtIntArg(*this, spec.prec);
+        }
+
+        // Capture argument.
+        const char conv = spec.conv;
+        if (conv == 'd' || conv == 'i' ||
+            conv == 'u' || conv == 'o' || conv == 'x' || conv == 'X')
+        {
+            if (spec.lenMod == '\0' || spec.lenMod == 'h' || spec.lenMod == 'H')
+                LLBC_INL_NS __PutLogFmtIntArg(*this, va_arg(va, int));
+            else if (spec.lenMod == 'l')
+                LLBC_INL_NS __PutLogFmtIntArg(*this, va_arg(va, long));
+            else if (spec.lenMod == 'q')
+                LLBC_INL_NS __PutLogFmtIntArg(*this, va_arg(va, long long));
+            else if (spec.lenMod == 'j')
+                LLBC_INL_NS __PutLogFmtIntArg(*this, va_arg(va, intmax_t));
+            else if (spec.lenMod == 'z')
+                LLBC_INL_NS __PutLogFmtIntArg(*this, va_arg(va, size_t));
+            else if (spec.lenMod == 't')
+                LLBC_INL_NS __PutLogFmtIntArg(*this, va_arg(va, ptrdiff_t));
+            else
+                break;
+        }
+        else if (conv == 'f' || conv == 'F' || conv == 'e' || conv == 'E' ||
+                 conv == 'g' || conv == 'G' || conv == 'a' || conv == 'A')
+        {
+            if (spec.lenMod == 'L')
+                LLBC_INL_NS __PutLogFmtArg(*this, LLBC_INL_NS __LogFmtArg_LongDouble, va_arg(va, long double));
+            else
+                LLBC_INL_NS __PutLogFmtArg(*this, LLBC_INL_NS __LogFmtArg_Double, va_arg(va, double));
+        }
+        else if (conv == 'c' && spec.lenMod == '\0')
+        {
+            LLBC_INL_NS __PutLogFmtIntArg(*this, va_arg(va, int));
+        }
+        else if (conv == 's' && spec.lenMod == '\0')
+        {
+            LLBC_INL_NS __PutLogFmtStrArg(*this, va_arg(va, const char *), spec.prec);
+        }
+        else if (conv == 'p')
+        {
+            LLBC_INL_NS __PutLogFmtArg(*this, LLBC_INL_NS __LogFmtArg_Ptr, va_arg(va, void *));
+        }
+        else
+        {
+            // Not supported conversion, eg: %n, %ls, %lc, positional arguments.
+            break;
+        }
+    }
+
+    // If not all conversion specifications captured, capture failed.
+    if (UNLIKELY(p != nullptr))
+    {
+        fmtArgsLen = 0;
+        LLBC_SetLastError(LLBC_ERROR_NOT_SUPPORT);
+
+        return LLBC_FAILED;
+    }
+
+    this->fmt = fmt;
+
+    return LLBC_OK;
+}
+
+void LLBC_LogData::FormatDeferredMsg()
+{
+    if (!fmt)
+        return;
+
+    __LLBC_LibTls *libTls = __LLBC_GetLibTls();
+    char *buf = libTls->coreTls.loggerFmtBuf;
+    const int bufSize = static_cast<int>(sizeof(libTls->coreTls.loggerFmtBuf));
+
+    int len = 0;
+    const char *args = fmtArgs;
+    const char *p = fmt;
+    LLBC_INL_NS __LogFmtSpec spec;
+    while (len < bufSize - 1)
+    {
+        // Copy literal text.
+        const char *specBeg = strchr(p, '%');
+        const int literalLen = specBeg ? static_cast<int>(specBeg - p) : static_cast<int>(strlen(p));
+        const int copyLen = MIN(literalLen, bufSize - 1 - len);
+        memcpy(buf + len, p, copyLen);
+        len += copyLen;
+        if (!specBeg || len == bufSize - 1)
+            break;
+
+        // Process "%%".
+        if (specBeg[1] == '%')
+        {
+            buf[len++] = '%';
+            p = specBeg + 2;
+            continue;
+        }
+
+        // Parse conversion specification(has been validated in capture stage).
+        (void)LLBC_INL_NS __ParseLogFmtSpec(specBeg, spec);
+        p = specBeg + spec.len;
+
+        char specStr[32];
+        memcpy(specStr, spec.beg, spec.len);
+        specStr[spec.len] = '\0';
+
+        // Read width/precision arguments.
+        int stars[2];
+        int starCount = 0;
+        for (int i = 0; i < static_cast<int>(spec.widthStar) + static_cast<int>(spec.precStar); ++i)
+        {
+            ++args; // Skip tag.
+            stars[starCount++] = LLBC_INL_NS __GetLogFmtArg<sint32>(args);
+        }
+
+        // Format argument.
+        int ret;
+        char * const outBuf = buf + len;
+        const size_t outBufSize = static_cast<size_t>(bufSize - len);
+        const char tag = *args++;
+        if (tag == LLBC_INL_NS __LogFmtArg_Int32)
+        {
+            ret = LLBC_INL_NS __FormatLogFmtArg(
+                outBuf, outBufSize, specStr, starCount, stars, LLBC_INL_NS __GetLogFmtArg<sint32>(args));
+        }
+        else if (tag == LLBC_INL_NS __LogFmtArg_Int64)
+        {
+            const sint64 val = LLBC_INL_NS __GetLogFmtArg<sint64>(args);
+            if (spec.lenMod == 'l')
+                ret = LLBC_INL_NS __FormatLogFmtArg(
+                    outBuf, outBufSize, specStr, starCount, stars, static_cast<long>(val));
+            else if (spec.lenMod == 'z')
+                ret = LLBC_INL_NS __FormatLogFmtArg(
+                    outBuf, outBufSize, specStr, starCount, stars, static_cast<size_t>(val));
+            else if (spec.lenMod == 't')
+                ret = LLBC_INL_NS __FormatLogFmtArg(
+                    outBuf, outBufSize, specStr, starCount, stars, static_cast<ptrdiff_t>(val));
+            else if (spec.lenMod == 'j')
+                ret = LLBC_INL_NS __FormatLogFmtArg(
+                    outBuf, outBufSize, specStr, starCount, stars, static_cast<intmax_t>(val));
+            else
+                ret = LLBC_INL_NS __FormatLogFmtArg(
+                    outBuf, outBufSize, specStr, starCount, stars, static_cast<long long>(val));
+        }
+        else if (tag == LLBC_INL_NS __LogFmtArg_Double)
+        {
+            ret = LLBC_INL_NS __FormatLogFmtArg(
+                outBuf, outBufSize, specStr, starCount, stars, LLBC_INL_NS __GetLogFmtArg<double>(args));
+        }
+        else if (tag == LLBC_INL_NS __LogFmtArg_LongDouble)
+        {
+            ret = LLBC_INL_NS __FormatLogFmtArg(
+                outBuf, outBufSize, specStr, starCount, stars, LLBC_INL_NS __GetLogFmtArg<long double>(args));
+        }
+        else if (tag == LLBC_INL_NS __LogFmtArg_Str)
+        {
+            const uint32 strLen = LLBC_INL_NS __GetLogFmtArg<uint32>(args);
+            ret = LLBC_INL_NS __FormatLogFmtArg(outBuf, outBufSize, specStr, starCount, stars, args);
+            args += strLen + 1;
+        }
+        else if (tag == LLBC_INL_NS __LogFmtArg_NullStr)
+        {
+            ++args;
+            ret = LLBC_INL_NS __FormatLogFmtArg(outBuf, outBufSize, specStr, starCount, stars, "(null)");
+        }
+        else if (tag == LLBC_INL_NS __LogFmtArg_Ptr)
+        {
+            ret = LLBC_INL_NS __FormatLogFmtArg(
+                outBuf, outBufSize, specStr, starCount, stars, LLBC_INL_NS __GetLogFmtArg<void *>(args));
+        }
+        else
+        {
+            break;
+        }
+
+        if (UNLIKELY(ret < 0))
+            break;
+        len += MIN(ret, bufSize - 1 - len);
+    }
+
+    // Copy formatted message.
+    if (UNLIKELY(msgCap < len + 1))
+    {
+        msgCap = MAX(len + 1, 192);
+        msg = LLBC_Realloc(char, msg, msgCap);
+    }
+
+    msgLen = len;
+    if (LIKELY(len > 0))
+        memcpy(msg, buf, len);
+    msg[len] = '\0';
+
+    fmt = nullptr;
+    fmtArgsLen = 0;
 }
 
 void LLBC_LogData::Reuse()
@@ -81,6 +499,15 @@ void LLBC_LogData::Reuse()
 
     logTrace.reset();
 
+    fmt = nullptr;
+    fmtArgsLen = 0;
+    if (fmtArgsCap >= MAX(1024, (LLBC_CFG_LOG_FORMAT_BUF_SIZE * 7 / 8)))
+    {
+        free(fmtArgs);
+        fmtArgs = nullptr;
+        fmtArgsCap = 0;
+    }
+
     // line = 0;
 
     // threadId = LLBC_INVALID_NATIVE_THREAD_ID;
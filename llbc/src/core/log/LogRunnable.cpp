@@ -22,6 +22,7 @@
 
 #include "llbc/common/Export.h"
 
+#include "llbc/core/os/OS_Atomic.h"
 #include "llbc/core/objpool/ObjPool.h"
 
 #include "llbc/core/log/LogData.h"
@@ -33,9 +34,10 @@ __LLBC_NS_BEGIN
     LLBC_LogRunnable::LLBC_LogRunnable()
 : _stopping(false)
 , _logTimeAccessor(nullptr)
+
+, _logDataHead(nullptr)
+, _waiting(0)
 {
-    for (size_t i = 0; i < sizeof(_logDatas) / sizeof(_logDatas[0]); ++i)
-        _logDatas[i].reserve(4096);
 }
 
 LLBC_LogRunnable::~LLBC_LogRunnable()
@@ -70,8 +72,9 @@ void LLBC_LogRunnable::Stop()
 {
     LLBC_ReturnIf(GetTaskState() == LLBC_TaskState::NotActivated, void());
 
-    // Mask stopping and waiting for thread stopped.
+    // Mask stopping, wakeup and waiting for thread stopped.
     _stopping = true;
+    _waitSem.Post();
     LLBC_ReturnIf(Wait() == LLBC_OK, void());
 
     // If Wait() call failed, maybe call LogRunnable::Stop() in difference thread(eg: in crash hook),
@@ -82,9 +85,22 @@ void LLBC_LogRunnable::Stop()
 
 void LLBC_LogRunnable::PushLogData(LLBC_LogData *logData)
 {
-    _logDataLock.Lock();
-    _logDatas[0].push_back(logData);
-    _logDataLock.Unlock();
+    // Push to list head.
+    LLBC_LogData *head = _logDataHead;
+    while (true)
+    {
+        logData->next = head;
+        LLBC_LogData *oldHead = LLBC_AtomicCompareAndExchange(&_logDataHead, logData, head);
+        if (LIKELY(oldHead == head))
+            break;
+
+        head = oldHead;
+    }
+
+    // If queue empty -> non-empty and log thread is waiting, wakeup it.
+    if (!head &&
+        LLBC_AtomicCompareAndExchange(&_waiting, 0, 1) == 1)
+        _waitSem.Post();
 }
 
 void LLBC_LogRunnable::Svc()
@@ -92,7 +108,7 @@ void LLBC_LogRunnable::Svc()
     while (LIKELY(!_stopping))
     {
         if (!TryPopAndProcLogDatas())
-            LLBC_Sleep(1);
+            WaitLogDatas();
 
         FlushLoggers(false, _logTimeAccessor->NowInMilliseconds());
     }
@@ -112,25 +128,49 @@ void LLBC_LogRunnable::Cleanup()
 
 LLBC_FORCE_INLINE bool LLBC_LogRunnable::TryPopAndProcLogDatas()
 {
-    _logDataLock.Lock();
-    std::swap(_logDatas[0], _logDatas[1]);
-    _logDataLock.Unlock();
-
-    auto &logDatas = _logDatas[1];
-    if (logDatas.empty())
+    // Pop all log datas.
+    LLBC_LogData *head = _logDataHead;
+    if (!head)
         return false;
 
-    for (auto &logData : logDatas)
+    LLBC_LogData *oldHead;
+    while ((oldHead = LLBC_AtomicCompareAndExchange(&_logDataHead, static_cast<LLBC_LogData *>(nullptr), head)) != head)
+        head = oldHead;
+
+    // Reverse to FIFO order.
+    LLBC_LogData *logData = nullptr;
+    while (head)
+    {
+        LLBC_LogData *next = head->next;
+        head->next = logData;
+        logData = head;
+        head = next;
+    }
+
+    // Process log datas.
+    while (logData)
     {
+        LLBC_LogData *next = logData->next;
+        logData->FormatDeferredMsg();
         logData->logger->OutputLogData(*logData);
         LLBC_Recycle(logData);
-    }
 
-    logDatas.clear();
+        logData = next;
+    }
 
     return true;
 }
 
+LLBC_FORCE_INLINE void LLBC_LogRunnable::WaitLogDatas()
+{
+    // Mask waiting and recheck queue, avoid lost wakeup.
+    (void)LLBC_AtomicCompareAndExchange(&_waiting, 1, 0);
+    if (!_logDataHead && LIKELY(!_stopping))
+        (void)_waitSem.TimedWait(LLBC_CFG_LOG_RUNNABLE_IDLE_WAIT_TIME);
+
+    (void)LLBC_AtomicCompareAndExchange(&_waiting, 0, 1);
+}
+
 LLBC_FORCE_INLINE void LLBC_LogRunnable::FlushLoggers(bool force, sint64 now)
 {
     const size_t loggerCnt = _loggers.size();
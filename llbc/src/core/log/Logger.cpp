@@ -309,11 +309,6 @@ int LLBC_Logger::SetLogHook(std::initializer_list<int> logLevels,
     return LLBC_OK;
 }
 
-bool LLBC_Logger::GetColorLogTag() const
-{
-    return LIKELY(_logTraceMgr) ? _logTraceMgr->GetColorLogTag() : false;
-}
-
 int LLBC_Logger::AddColorLogTrace(const LLBC_LogTrace &logTrace)
 {
     if (!_logTraceMgr)
@@ -452,15 +447,29 @@ int LLBC_Logger::VOutput(int level,
     if (level < _logLevel && !GetColorLogTag())
         return LLBC_OK;
 
-    LLBC_LogData *data = BuildLogData(level,
-                                      tag,
-                                      file,
-                                      line,
-                                      func,
-                                      fmt,
-                                      va);
-    if (UNLIKELY(!data))
-        return LLBC_FAILED;
+    // Try build deferred format log data, if deferred format enabled and no log hook installed.
+    LLBC_LogData *data = nullptr;
+    if (_config->IsDeferredFormat() && !_logHooks[level])
+        data = BuildDeferredLogData(level,
+                                    tag,
+                                    file,
+                                    line,
+                                    func,
+                                    fmt,
+                                    va);
+
+    if (!data)
+    {
+        data = BuildLogData(level,
+                            tag,
+                            file,
+                            line,
+                            func,
+                            fmt,
+                            va);
+        if (UNLIKELY(!data))
+            return LLBC_FAILED;
+    }
 
     if (_logHooks[level])
         _logHooks[level](data);
@@ -570,6 +579,40 @@ LLBC_FORCE_INLINE LLBC_LogData *LLBC_Logger::BuildLogData(int level,
     return data;
 }
 
+LLBC_LogData *LLBC_Logger::BuildDeferredLogData(int level,
+                                                const char *tag,
+                                                const char *file,
+                                                int line,
+                                                const char *func,
+                                                const char *fmt,
+                                                va_list va)
+{
+    // Capture format arguments(use copied va_list, if capture failed, caller can fallback to format).
+    LLBC_LogData *data = _logDataTypedObjPool.Acquire();
+
+    va_list capVa;
+    va_copy(capVa, va);
+    const int ret = data->CaptureFmtArgs(fmt, capVa);
+    va_end(capVa);
+    if (UNLIKELY(ret != LLBC_OK))
+    {
+        LLBC_Recycle(data);
+        return nullptr;
+    }
+
+    // Fill other LogData members.
+    FillLogDataNonMsgMembers(level,
+                             tag,
+                             file,
+                             line,
+                             func,
+                             _logTimeAccessor->NowInMicroseconds(),
+                             data,
+                             __LLBC_GetLibTls());
+
+    return data;
+}
+
 LLBC_FORCE_INLINE LLBC_LogData *LLBC_Logger::BuildLogData(int level,
                                                           const char *tag,
                                                           const char *file,
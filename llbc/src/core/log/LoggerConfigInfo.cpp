@@ -51,6 +51,7 @@ LLBC_LoggerConfigInfo::LLBC_LoggerConfigInfo()
 
 , _asyncMode(false)
 , _independentThread(false)
+, _deferredFormat(false)
 , _flushInterval(0)
 
 , _addTimestampInJsonLog(0)
@@ -131,8 +132,12 @@ int LLBC_LoggerConfigInfo::Initialize(const LLBC_String &loggerName,
     _asyncMode = __LLBC_GetLogCfg(
         "asynchronous", ASYNC_MODE, IsAsyncMode, AsLooseBool);
     if (_asyncMode)
+    {
         _independentThread = __LLBC_GetLogCfg(
             "independentThread", INDEPENDENT_THREAD, IsIndependentThread, AsLooseBool);
+        _deferredFormat = __LLBC_GetLogCfg(
+            "deferredFormat", DEFERRED_FORMAT, IsDeferredFormat, AsLooseBool);
+    }
      _flushInterval = __LLBC_GetLogCfg(
          "flushInterval", LOG_FLUSH_INTERVAL, GetFlushInterval, AsInt32);
 
@@ -24,6 +24,7 @@
 
 #include "llbc/core/time/Time.h"
 
+#include "llbc/core/os/OS_Atomic.h"
 #include "llbc/core/os/OS_Console.h"
 
 #include "llbc/core/thread/Guard.h"
@@ -42,6 +43,7 @@ LLBC_LoggerMgr::LLBC_LoggerMgr()
 : _sharedLogRunnable(nullptr)
 
 , _rootLogger(nullptr)
+, _generation(1)
 {
 }
 
@@ -132,6 +134,9 @@ int LLBC_LoggerMgr::Initialize(const LLBC_String &cfgFilePath,
     if (_sharedLogRunnable)
         _sharedLogRunnable->Activate(1, LLBC_ThreadPriority::BelowNormal);
 
+    // Update generation, invalidate all cached logger handles.
+    (void)LLBC_AtomicFetchAndAdd(&_generation, 1);
+
     return LLBC_OK;
 }
 
@@ -163,6 +168,9 @@ int LLBC_LoggerMgr::Reload(const LLBC_String &newCfgFilePath)
             return LLBC_FAILED;
     }
 
+    // Update generation, invalidate all cached logger handles.
+    (void)LLBC_AtomicFetchAndAdd(&_generation, 1);
+
     return LLBC_OK;
 }
 
@@ -172,6 +180,9 @@ void LLBC_LoggerMgr::Finalize()
     if (_rootLogger == nullptr)
         return;
 
+    // Update generation, invalidate all cached logger handles.
+    (void)LLBC_AtomicFetchAndAdd(&_generation, 1);
+
     // Delete shared log runnable.
     if (_sharedLogRunnable)
     {
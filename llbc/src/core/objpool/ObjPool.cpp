@@ -0,0 +1,112 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2013 lailongwei<lailongwei@126.com>
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of 
+// this software and associated documentation files (the "Software"), to deal in 
+// the Software without restriction, including without limitation the rights to 
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of 
+// the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS 
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER 
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN 
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+
+#include "llbc/common/Export.h"
+
+#include "llbc/core/thread/SpinLock.h"
+#include "llbc/core/thread/Guard.h"
+#include "llbc/core/objpool/ObjPool.h"
+
+__LLBC_INTERNAL_NS_BEGIN
+
+// The object pool thread index allocator, never delete, thread index maybe freed after static objects
+// destructed.
+struct __LLBC_ObjPoolThreadIndexAllocator
+{
+    LLBC_NS LLBC_SpinLock lock;
+    std::vector<int> freeIndexes;
+    int nextIndex = 0;
+};
+
+__LLBC_ObjPoolThreadIndexAllocator &__GetObjPoolThreadIndexAllocator()
+{
+    static auto *allocator = new __LLBC_ObjPoolThreadIndexAllocator;
+    return *allocator;
+}
+
+// The object pool thread index holder, thread index free when thread exit, then the thread caches
+// of this index will be reused by new thread.
+struct __LLBC_ObjPoolThreadIndexHolder
+{
+    ~__LLBC_ObjPoolThreadIndexHolder();
+};
+
+// Current thread index, -1 means not allocate, -2 means freed(thread exiting).
+thread_local int __objPoolThreadIndex = -1;
+
+__LLBC_ObjPoolThreadIndexHolder::~__LLBC_ObjPoolThreadIndexHolder()
+{
+    auto &allocator = __GetObjPoolThreadIndexAllocator();
+    LLBC_NS LLBC_LockGuard guard(allocator.lock);
+    allocator.freeIndexes.push_back(__objPoolThreadIndex);
+
+    __objPoolThreadIndex = -2;
+}
+
+__LLBC_INTERNAL_NS_END
+
+__LLBC_NS_BEGIN
+
+int LLBC_ObjPool::GetThreadIndex()
+{
+    int &threadIndex = LLBC_INL_NS __objPoolThreadIndex;
+    if (LIKELY(threadIndex >= 0))
+        return threadIndex;
+
+    // Allocate thread index, if thread exiting(thread index freed), allocate new index and never free it.
+    const bool threadExiting = threadIndex == -2;
+    auto &allocator = LLBC_INL_NS __GetObjPoolThreadIndexAllocator();
+    allocator.lock.Lock();
+    if (!threadExiting && !allocator.freeIndexes.empty())
+    {
+        threadIndex = allocator.freeIndexes.back();
+        allocator.freeIndexes.pop_back();
+    }
+    else
+    {
+        threadIndex = allocator.nextIndex++;
+    }
+    allocator.lock.Unlock();
+
+    // Free thread index when thread exit.
+    if (!threadExiting)
+    {
+        thread_local LLBC_INL_NS __LLBC_ObjPoolThreadIndexHolder holder;
+        (void)holder;
+    }
+
+    return threadIndex;
+}
+
+int LLBC_ObjPool::GetTypeIndex(const char *rttiName)
+{
+    // Type indexes are keyed by rtti name, so the same type always has the same index, even if
+    // instantiated in different modules.
+    static LLBC_SpinLock lock;
+    static std::map<LLBC_CString, int> typeIndexes;
+
+    LLBC_LockGuard guard(lock);
+    return typeIndexes.emplace(rttiName, static_cast<int>(typeIndexes.size())).first->second;
+}
+
+__LLBC_NS_END
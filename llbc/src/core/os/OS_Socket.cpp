@@ -24,6 +24,8 @@
 
 #if LLBC_TARGET_PLATFORM_NON_WIN32
  #include <fcntl.h>
+ #include <limits.h>
+ #include <sys/uio.h>
 #endif // Non-Win32
 
 #include "llbc/core/os/OS_Socket.h"
@@ -336,6 +338,73 @@ int LLBC_Send(LLBC_SocketHandle handle, const void *buf, int len, int flags)
 #endif // LLBC_TARGET_PLATFORM_NON_WIN32
 }
 
+int LLBC_SendV(LLBC_SocketHandle handle, const LLBC_SockBuf *buffers, int bufferCount)
+{
+    if (UNLIKELY(!buffers || bufferCount <= 0))
+    {
+        LLBC_SetLastError(LLBC_ERROR_ARG);
+        return LLBC_FAILED;
+    }
+
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    #ifdef IOV_MAX
+    if (bufferCount > IOV_MAX)
+        bufferCount = IOV_MAX;
+    #endif // IOV_MAX
+
+    struct iovec iovs[LLBC_CFG_COMM_GATHER_SEND_MAX_BUF_COUNT];
+    if (bufferCount > LLBC_CFG_COMM_GATHER_SEND_MAX_BUF_COUNT)
+        bufferCount = LLBC_CFG_COMM_GATHER_SEND_MAX_BUF_COUNT;
+    for (int i = 0; i < bufferCount; ++i)
+    {
+        iovs[i].iov_base = buffers[i].buf;
+        iovs[i].iov_len = buffers[i].len;
+    }
+
+    ssize_t ret;
+    while ((ret = writev(handle, iovs, bufferCount)) < 0 && errno == EINTR);
+    if (ret == -1)
+    {
+        if (errno == EWOULDBLOCK)
+        {
+            LLBC_SetLastError(LLBC_ERROR_WBLOCK);
+            return LLBC_FAILED;
+        }
+        else if (errno == EAGAIN)
+        {
+            LLBC_SetLastError(LLBC_ERROR_AGAIN);
+            return LLBC_FAILED;
+        }
+
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_FAILED;
+    }
+
+    return static_cast<int>(ret);
+#else // LLBC_TARGET_PLATFORM_WIN32
+    DWORD bytesSent = 0;
+    if (::WSASend(handle,
+                  const_cast<LLBC_SockBuf *>(buffers),
+                  static_cast<DWORD>(bufferCount),
+                  &bytesSent,
+                  0,
+                  nullptr,
+                  nullptr) == SOCKET_ERROR)
+    {
+        if (::WSAGetLastError() == WSAEWOULDBLOCK)
+        {
+            LLBC_SetLastError(LLBC_ERROR_WBLOCK);
+            return LLBC_FAILED;
+        }
+
+        LLBC_SetLastError(LLBC_ERROR_NETAPI);
+        return LLBC_FAILED;
+    }
+
+    return static_cast<int>(bytesSent);
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+}
+
 int LLBC_SendEx(LLBC_SocketHandle handle,
                 LLBC_SockBuf *buffers,
                 ulong bufferCount,
@@ -574,6 +643,24 @@ int LLBC_DisableAddressReusable(LLBC_SocketHandle handle)
 #endif // LLBC_TARGET_PLATFORM_NON_WIN32
 }
 
+int LLBC_EnablePortReusable(LLBC_SocketHandle handle)
+{
+#if LLBC_TARGET_PLATFORM_NON_WIN32 && defined(SO_REUSEPORT)
+    int reuse = 1;
+    if (::setsockopt(handle, SOL_SOCKET,
+        SO_REUSEPORT, reinterpret_cast<const char *>(&reuse), sizeof(int)) != 0)
+    {
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_FAILED;
+    }
+
+    return LLBC_OK;
+#else // Not support SO_REUSEPORT
+    LLBC_SetLastError(LLBC_ERROR_NOT_IMPL);
+    return LLBC_FAILED;
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32 && defined(SO_REUSEPORT)
+}
+
 int LLBC_SetSendBufSize(LLBC_SocketHandle handle, size_t size)
 {
     if (size <= 0)
@@ -0,0 +1,250 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2013 lailongwei<lailongwei@126.com>
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of 
+// this software and associated documentation files (the "Software"), to deal in 
+// the Software without restriction, including without limitation the rights to 
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of 
+// the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS 
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER 
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN 
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+#include "llbc/common/Export.h"
+
+#if LLBC_TARGET_PLATFORM_LINUX
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif // LLBC_TARGET_PLATFORM_LINUX
+
+#include "llbc/core/os/OS_Time.h"
+#include "llbc/core/objpool/ObjPool.h"
+
+#include "llbc/core/thread/MessageBlock.h"
+#include "llbc/core/thread/LockFreeMessageQueue.h"
+
+__LLBC_NS_BEGIN
+
+LLBC_LockFreeMessageQueue::LLBC_LockFreeMessageQueue()
+: _pushed(nullptr)
+, _size(0)
+, _sleeping(0)
+, _wakeup(false)
+
+, _head(nullptr)
+, _tail(nullptr)
+, _fetchedCount(0)
+{
+}
+
+LLBC_LockFreeMessageQueue::~LLBC_LockFreeMessageQueue()
+{
+    Cleanup();
+}
+
+void LLBC_LockFreeMessageQueue::PushBack(LLBC_MessageBlock *block)
+{
+    // Incr size before block visible to consumer, make sure size never underflow.
+    _size.fetch_add(1, std::memory_order_relaxed);
+
+    LLBC_MessageBlock *top = _pushed.load(std::memory_order_relaxed);
+    do
+    {
+        block->SetNext(top);
+    } while (!_pushed.compare_exchange_weak(top, block, std::memory_order_seq_cst, std::memory_order_relaxed));
+
+    // Pairs with the sleeping flag store/pushed blocks load in Sleep(): either producer see the
+    // sleeping flag, or consumer see the pushed block, the wakeup never lost.
+    if (_sleeping.load(std::memory_order_seq_cst) != 0)
+        WakeupSleeper();
+}
+
+bool LLBC_LockFreeMessageQueue::PopAll(LLBC_MessageBlock *&blocks)
+{
+    if (!Fetch())
+        return false;
+
+    blocks = _head;
+    _size.fetch_sub(_fetchedCount, std::memory_order_relaxed);
+
+    _head = _tail = nullptr;
+    _fetchedCount = 0;
+
+    return true;
+}
+
+bool LLBC_LockFreeMessageQueue::TryPopFront(LLBC_MessageBlock *&block)
+{
+    if (!_head && !Fetch())
+        return false;
+
+    block = _head;
+    if (!(_head = _head->GetNext()))
+        _tail = nullptr;
+    else
+        _head->SetPrev(nullptr);
+
+    --_fetchedCount;
+    _size.fetch_sub(1, std::memory_order_relaxed);
+
+    return true;
+}
+
+bool LLBC_LockFreeMessageQueue::TimedPopFront(LLBC_MessageBlock *&block, int interval)
+{
+    if (TryPopFront(block))
+        return true;
+    else if (interval == 0)
+        return false;
+
+    const sint64 deadline = interval != LLBC_INFINITE ? LLBC_GetMilliseconds() + interval : 0;
+    while (true)
+    {
+        Sleep(interval);
+        if (TryPopFront(block))
+            return true;
+
+        if (interval != LLBC_INFINITE &&
+            (interval = static_cast<int>(deadline - LLBC_GetMilliseconds())) <= 0)
+            return false;
+    }
+}
+
+bool LLBC_LockFreeMessageQueue::TimedWait(int interval)
+{
+    if (interval != 0 &&
+        !_head &&
+        !_pushed.load(std::memory_order_acquire) &&
+        !_wakeup.load(std::memory_order_acquire))
+        Sleep(interval);
+
+    const bool wokenUp = _wakeup.exchange(false, std::memory_order_acq_rel);
+    return wokenUp || _head || _pushed.load(std::memory_order_acquire);
+}
+
+void LLBC_LockFreeMessageQueue::Wakeup()
+{
+    _wakeup.store(true, std::memory_order_seq_cst);
+    if (_sleeping.load(std::memory_order_seq_cst) != 0)
+        WakeupSleeper();
+}
+
+void LLBC_LockFreeMessageQueue::Cleanup()
+{
+    LLBC_MessageBlock *blocks;
+    while (PopAll(blocks))
+    {
+        while (blocks)
+        {
+            LLBC_MessageBlock *block = blocks;
+            blocks = blocks->GetNext();
+
+            LLBC_Recycle(block);
+        }
+    }
+}
+
+bool LLBC_LockFreeMessageQueue::Fetch()
+{
+    // Take all pushed blocks by one atomic exchange.
+    LLBC_MessageBlock *pushed = _pushed.exchange(nullptr, std::memory_order_acquire);
+    if (!pushed)
+        return _head != nullptr;
+
+    // Reverse to FIFO order.
+    LLBC_MessageBlock *fetchedHead = nullptr;
+    LLBC_MessageBlock *fetchedTail = pushed;
+    while (pushed)
+    {
+        LLBC_MessageBlock *next = pushed->GetNext();
+        pushed->SetNext(fetchedHead);
+        if (fetchedHead)
+            fetchedHead->SetPrev(pushed);
+
+        fetchedHead = pushed;
+        ++_fetchedCount;
+
+        pushed = next;
+    }
+
+    // Append to consumer FIFO list.
+    fetchedHead->SetPrev(_tail);
+    if (_tail)
+        _tail->SetNext(fetchedHead);
+    else
+        _head = fetchedHead;
+    _tail = fetchedTail;
+
+    return true;
+}
+
+void LLBC_LockFreeMessageQueue::Sleep(int interval)
+{
+    _sleeping.store(1, std::memory_order_seq_cst);
+    if (_pushed.load(std::memory_order_seq_cst) ||
+        _wakeup.load(std::memory_order_seq_cst))
+    {
+        _sleeping.store(0, std::memory_order_relaxed);
+        return;
+    }
+
+#if LLBC_TARGET_PLATFORM_LINUX
+    static_assert(sizeof(std::atomic<int>) == sizeof(int), "futex word size mismatch");
+
+    // If producer cleared sleeping flag before we wait, futex wait will return immediately.
+    struct timespec ts;
+    if (interval != LLBC_INFINITE)
+    {
+        ts.tv_sec = interval / 1000;
+        ts.tv_nsec = (interval % 1000) * 1000000;
+    }
+
+    (void)syscall(SYS_futex,
+                  reinterpret_cast<int *>(&_sleeping),
+                  FUTEX_WAIT_PRIVATE,
+                  1,
+                  interval != LLBC_INFINITE ? &ts : nullptr,
+                  nullptr,
+                  0);
+#else // !LLBC_TARGET_PLATFORM_LINUX
+    _sleepLock.Lock();
+    if (_sleeping.load(std::memory_order_seq_cst) != 0)
+        _sleepCond.TimedWait(_sleepLock, interval);
+    _sleepLock.Unlock();
+#endif // LLBC_TARGET_PLATFORM_LINUX
+
+    _sleeping.store(0, std::memory_order_relaxed);
+}
+
+void LLBC_LockFreeMessageQueue::WakeupSleeper()
+{
+    // Only one producer make the wakeup syscall.
+    if (_sleeping.exchange(0, std::memory_order_seq_cst) == 0)
+        return;
+
+#if LLBC_TARGET_PLATFORM_LINUX
+    (void)syscall(SYS_futex,
+                  reinterpret_cast<int *>(&_sleeping),
+                  FUTEX_WAKE_PRIVATE,
+                  1,
+                  nullptr,
+                  nullptr,
+                  0);
+#else // !LLBC_TARGET_PLATFORM_LINUX
+    _sleepLock.Lock();
+    _sleepCond.Notify();
+    _sleepLock.Unlock();
+#endif // LLBC_TARGET_PLATFORM_LINUX
+}
+
+__LLBC_NS_END
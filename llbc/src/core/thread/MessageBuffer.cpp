@@ -113,7 +113,8 @@ int LLBC_MessageBuffer::Write(const char *buf, size_t len)
     }
 
     // If message buffer not empty and _tail block has writable size, try execute fast write.
-    const size_t tailWritableSize = _tail->GetWritableSize();
+    // Note: Attached/Shared tail block could not resize, only can execute normal write.
+    const size_t tailWritableSize = _tail->IsShared() ? 0 : _tail->GetWritableSize();
     if (tailWritableSize >= len)
 
     {
@@ -122,7 +123,8 @@ int LLBC_MessageBuffer::Write(const char *buf, size_t len)
 
         return LLBC_OK;
     }
-    else if (_tail->GetWritePos() + len < 
+    else if (!_tail->IsAttach() &&
+             _tail->GetWritePos() + len < 
                  LLBC_CFG_COMM_MSG_BUFFER_ELEM_RESIZE_LIMIT) // writableSize >= len or (writableSize < len and tail msg block auto resize not reach to limit).
     {
         _tail->Resize(MIN(MAX(_tail->GetWritePos() + len, _tail->GetSize() * 2), LLBC_CFG_COMM_MSG_BUFFER_ELEM_RESIZE_LIMIT));
@@ -176,8 +178,16 @@ LLBC_MessageBlock *LLBC_MessageBuffer::MergeBlocksAndDetach()
     if (!_head)
         return nullptr;
 
+    // If head block is attached/shared, could not merge other blocks into it, copy head block first.
     LLBC_MessageBlock *mergedBlock = _head;
     LLBC_MessageBlock *curBlock = _head->GetNext();
+    if (mergedBlock->IsAttach() && curBlock)
+    {
+        mergedBlock = new LLBC_MessageBlock(_size);
+        mergedBlock->Write(_head->GetDataStartWithReadPos(), _head->GetReadableSize());
+        LLBC_Recycle(_head);
+    }
+
     while (curBlock)
     {
         mergedBlock->Write(
@@ -226,7 +236,8 @@ int LLBC_MessageBuffer::Append(LLBC_MessageBlock *block)
     }
 
     // If tail block writable size >= will append block readable size, execute fast append.
-    if (_tail->GetWritableSize() >= block->GetReadableSize())
+    if (!_tail->IsShared() &&
+        _tail->GetWritableSize() >= block->GetReadableSize())
     {
         _tail->Write(block->GetDataStartWithReadPos(), block->GetReadableSize());
         LLBC_Recycle(block);
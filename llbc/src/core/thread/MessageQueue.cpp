@@ -34,6 +34,7 @@ LLBC_MessageQueue::LLBC_MessageQueue()
 , _tail(nullptr)
 
 , _size(0)
+, _wakeup(false)
 {
 }
 
@@ -256,6 +257,55 @@ bool LLBC_MessageQueue::Pop(LLBC_MessageBlock *&block, int interval, bool front)
     #endif // Non-Win32
 }
 
+bool LLBC_MessageQueue::TimedWait(int interval)
+{
+    _lock.Lock();
+    if (_size > 0 || _wakeup)
+    {
+        _wakeup = false;
+        _lock.Unlock();
+
+        return true;
+    }
+
+    #if LLBC_TARGET_PLATFORM_NON_WIN32
+    if (interval != 0)
+        _cond.TimedWait(_lock, interval);
+    #else // Win32
+    _lock.Unlock();
+    if (interval != 0 && _sem.TimedWait(interval))
+    {
+        // Semaphore count means message block count, give it back if not signaled by Wakeup().
+        _lock.Lock();
+        if (!_wakeup)
+            _sem.Post();
+    }
+    else
+    {
+        _lock.Lock();
+    }
+    #endif // Non-Win32
+
+    const bool ret = _size > 0 || _wakeup;
+    _wakeup = false;
+    _lock.Unlock();
+
+    return ret;
+}
+
+void LLBC_MessageQueue::Wakeup()
+{
+    _lock.Lock();
+    _wakeup = true;
+    _lock.Unlock();
+
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    _cond.Notify();
+#else // LLBC_TARGET_PLATFORM_WIN32
+    _sem.Post();
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+}
+
 LLBC_FORCE_INLINE void LLBC_MessageQueue::PopFrontNonLock(LLBC_MessageBlock *&block)
 {
     block = _head;
@@ -26,6 +26,7 @@
 
 #include "llbc/core/thread/ThreadMgr.h"
 #include "llbc/core/thread/Guard.h"
+#include "llbc/core/thread/MessageBlock.h"
 #include "llbc/core/thread/Task.h"
 
 __LLBC_NS_BEGIN
@@ -40,6 +41,8 @@ LLBC_Task::LLBC_Task(LLBC_ThreadMgr *threadMgr)
 , _threadNum(0)
 , _activatingThreadNum(0)
 , _inSvcMethThreadNum(0)
+
+, _useLockFreeMsgQueue(false)
 {
 }
 
@@ -67,6 +70,15 @@ int LLBC_Task::Activate(int threadNum,
         return LLBC_FAILED;
     }
 
+    // Lock-free message queue only support single consumer.
+    if (_useLockFreeMsgQueue && threadNum > 1)
+    {
+        _lock.Unlock();
+        LLBC_SetLastError(LLBC_ERROR_NOT_ALLOW);
+
+        return LLBC_FAILED;
+    }
+
     // Update task state to <Activating>.
     _taskState = LLBC_TaskState::Activating;
 
@@ -106,6 +118,36 @@ int LLBC_Task::Activate(int threadNum,
     return LLBC_OK;
 }
 
+int LLBC_Task::SetLockFreeMessageQueue(bool lockFree)
+{
+    LLBC_LockGuard guard(_lock);
+    if (_taskState != LLBC_TaskState::NotActivated)
+    {
+        LLBC_SetLastError(LLBC_ERROR_NOT_ALLOW);
+        return LLBC_FAILED;
+    }
+
+    if (lockFree == _useLockFreeMsgQueue)
+        return LLBC_OK;
+
+    // Move queued messages to new message queue.
+    LLBC_MessageBlock *blocks;
+    if (_useLockFreeMsgQueue ? _lockFreeMsgQueue.PopAll(blocks) : _msgQueue.PopAll(blocks))
+    {
+        while (blocks)
+        {
+            LLBC_MessageBlock *block = blocks;
+            blocks = blocks->GetNext();
+
+            lockFree ? _lockFreeMsgQueue.PushBack(block) : _msgQueue.PushBack(block);
+        }
+    }
+
+    _useLockFreeMsgQueue = lockFree;
+
+    return LLBC_OK;
+}
+
 int LLBC_Task::Wait()
 {
     // Task state check.
@@ -145,6 +187,7 @@ void LLBC_Task::InternalCleanup()
         return;
 
     _msgQueue.Cleanup();
+    _lockFreeMsgQueue.Cleanup();
 
     _threadNum = 0;
     _activatingThreadNum = 0;
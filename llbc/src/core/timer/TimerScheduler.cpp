@@ -20,6 +20,7 @@
 // CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 
+
 #include "llbc/common/Export.h"
 
 #include "llbc/core/os/OS_Time.h"
@@ -29,23 +30,51 @@
 #include "llbc/core/timer/TimerData.h"
 #include "llbc/core/timer/TimerScheduler.h"
 
+__LLBC_INTERNAL_NS_BEGIN
+
+// Timing wheel layout: level 0 has 256 slots(1 ms per slot), level 1~4 each has 64 slots,
+// total cover 2^32 ms(about 49 days), longer timers will be cascaded again when reach the wheel end.
+static const int __wheelLevels = 5;
+static const int __wheelL0Bits = 8;
+static const int __wheelLnBits = 6;
+static const size_t __wheelL0Size = 1 << __wheelL0Bits;
+static const size_t __wheelLnSize = 1 << __wheelLnBits;
+static const size_t __wheelL0Mask = __wheelL0Size - 1;
+static const size_t __wheelLnMask = __wheelLnSize - 1;
+static const size_t __wheelSlotCount = __wheelL0Size + (__wheelLevels - 1) * __wheelLnSize;
+static const LLBC_NS uint64 __wheelMaxDelta = 0xffffffffllu;
+
+__LLBC_INTERNAL_NS_END
+
 __LLBC_NS_BEGIN
 
 sint64 LLBC_TimerScheduler::_maxTimerId = 1;
 
-LLBC_TimerScheduler::LLBC_TimerScheduler()
-: _enabled(true)
+LLBC_TimerScheduler::LLBC_TimerScheduler(int backend)
+: _backend(backend == LLBC_TimerSchedulerBackend::TimingWheel ?
+               LLBC_TimerSchedulerBackend::TimingWheel : LLBC_TimerSchedulerBackend::Heap)
+, _enabled(true)
 , _destroying(false)
 , _cancelingAll(false)
+
+, _wheelTick(0)
+, _wheelTimerCount(0)
 {
+    if (_backend == LLBC_TimerSchedulerBackend::TimingWheel)
+    {
+        _wheelTick = LLBC_GetMilliseconds();
+        _wheelSlots.resize(LLBC_INL_NS __wheelSlotCount, nullptr);
+    }
 }
 
 LLBC_TimerScheduler::~LLBC_TimerScheduler()
 {
     _destroying = true;
-    for(auto &elem : _heap)
+
+    std::vector<LLBC_TimerData *> datas;
+    GetTimerDatas(datas);
+    for(auto &data : datas)
     {
-        LLBC_TimerData *data = elem;
         if (data->unStatus.status.isScheduled)
         {
             llbc_assert(!data->unStatus.status.isHandlingTimeout && !data->unStatus.status.isHandlingCancel &&
@@ -70,69 +99,18 @@ LLBC_TimerScheduler::_This *LLBC_TimerScheduler::GetCurrentThreadScheduler()
 
 void LLBC_TimerScheduler::Update()
 {
-    if (_enabled == false || _heap.empty())
+    if (_enabled == false)
         return;
 
-    const sint64 now = LLBC_GetMilliseconds();
-    do
+    if (_backend == LLBC_TimerSchedulerBackend::Heap)
     {
-        // Get top timerData, if not timeout, break.
-        LLBC_TimerData *data = _heap.top();
-        if (now < data->handle)
-            break;
-
-        // Pop top timerData.
-        _heap.pop();
-
-        // Process cancelled timerData.
-        if (!data->unStatus.status.isScheduled)
-        {
-            if (--data->refCount == 0)
-                delete data;
-
-            continue;
-        }
-
-        // Incr refCount && Mark is timeout-handling.
-        ++data->refCount;
-        data->unStatus.status.isHandlingTimeout = true;
-        // Incr has been timeout times.
-        ++data->triggeredCount;
-
-        // Call OnTimeout.
-        bool reSchedule = true;
-        LLBC_Timer *timer = data->timer;
-        timer->OnTimeout();
-
-        // If Cancel() or Schedule() called during OnTimeout() call, set reSchedule flag to false.
-        if (!data->unStatus.status.isScheduled)
-            reSchedule = false;
-
-        // Reach max schedule times, reset <isScheduled> flag && reset reSchedule flag.
-        if (data->totalTriggerCount != static_cast<size_t>(LLBC_INFINITE) &&
-            data->triggeredCount >= data->totalTriggerCount)
-        {
-            data->unStatus.status.isScheduled = false;
-            reSchedule = false;
-        }
-
-        // Reset isHandlingTimeout flag && Decr refCount.
-        data->unStatus.status.isHandlingTimeout = false;
-        --data->refCount;
-
-        // Reschedule or try delete timerData.
-        if (reSchedule)
-        {
-            sint64 delay = (data->period != 0) ? (now - data->handle) % data->period : 0;
-            data->handle = now + data->period - delay;
-            _heap.push(data);
-        }
-        else
-        {
-            if (data->refCount == 0 || --data->refCount == 0)
-                delete data;
-        }
-    } while (!_heap.empty());
+        if (!_heap.empty())
+            UpdateHeap(LLBC_GetMilliseconds());
+    }
+    else
+    {
+        UpdateWheel(LLBC_GetMilliseconds());
+    }
 }
 
 bool LLBC_TimerScheduler::IsEnabled() const
@@ -145,9 +123,14 @@ void LLBC_TimerScheduler::SetEnabled(bool enabled)
     _enabled = enabled;
 }
 
+int LLBC_TimerScheduler::GetBackend() const
+{
+    return _backend;
+}
+
 size_t LLBC_TimerScheduler::GetTimerCount() const
 {
-    return _heap.size();
+    return _backend == LLBC_TimerSchedulerBackend::Heap ? _heap.size() : _wheelTimerCount;
 }
 
 bool LLBC_TimerScheduler::IsDestroyed() const
@@ -182,6 +165,8 @@ int LLBC_TimerScheduler::Schedule(LLBC_Timer *timer,
     data->timer = timer;
     data->unStatus.statusVal = 0x1; // isScheduled = true
     data->refCount = 2; // LLBC_TimerScheduler:1, LLBC_Timer:1
+    data->wheelNext = nullptr;
+    data->wheelPPrev = nullptr;
 
     if (timer->_timerData)
     {
@@ -190,7 +175,10 @@ int LLBC_TimerScheduler::Schedule(LLBC_Timer *timer,
     }
 
     timer->_timerData = data;
-    _heap.push(data);
+    if (_backend == LLBC_TimerSchedulerBackend::Heap)
+        _heap.push(data);
+    else
+        AddToWheel(data);
 
     return LLBC_OK;
 }
@@ -215,8 +203,22 @@ int LLBC_TimerScheduler::Cancel(LLBC_Timer *timer)
     if (data->unStatus.status.isHandlingTimeout)
         return LLBC_OK;
 
-    if (!_cancelingAll &&
-        data->handle - LLBC_GetMilliseconds() >= LLBC_CFG_CORE_TIMER_LONG_TIMEOUT_TIME)
+    if (_backend == LLBC_TimerSchedulerBackend::TimingWheel)
+    {
+        // Timing wheel always remove immediately(O(1)), CancelAll() iterate on timer datas snapshot.
+        if (data->wheelPPrev)
+        {
+            RemoveFromWheel(data);
+            --_wheelTimerCount;
+            if (--data->refCount == 0)
+            {
+                delete data;
+                timer->_timerData = nullptr;
+            }
+        }
+    }
+    else if (!_cancelingAll &&
+             data->handle - LLBC_GetMilliseconds() >= LLBC_CFG_CORE_TIMER_LONG_TIMEOUT_TIME)
     {
         _heap.erase(data, true);
         if (--data->refCount == 0)
@@ -235,14 +237,253 @@ void LLBC_TimerScheduler::CancelAll()
         return;
 
     _cancelingAll = true;
-    for(auto &elem : _heap)
+    if (_backend == LLBC_TimerSchedulerBackend::Heap)
     {
-        LLBC_TimerData *data = elem;
-        if (LIKELY(data->unStatus.status.isScheduled))
-            data->timer->Cancel();
+        for(auto &elem : _heap)
+        {
+            LLBC_TimerData *data = elem;
+            if (LIKELY(data->unStatus.status.isScheduled))
+                data->timer->Cancel();
+        }
+    }
+    else
+    {
+        // Hold timer datas during cancel, cancel handler maybe cancel/delete other timers.
+        std::vector<LLBC_TimerData *> datas;
+        GetTimerDatas(datas);
+        for (auto &data : datas)
+            ++data->refCount;
+
+        for (auto &data : datas)
+        {
+            if (LIKELY(data->unStatus.status.isScheduled))
+                data->timer->Cancel();
+
+            if (--data->refCount == 0)
+                delete data;
+        }
     }
 
     _cancelingAll = false;
 }
 
+void LLBC_TimerScheduler::UpdateHeap(sint64 now)
+{
+    do
+    {
+        // Get top timerData, if not timeout, break.
+        LLBC_TimerData *data = _heap.top();
+        if (now < data->handle)
+            break;
+
+        // Pop top timerData.
+        _heap.pop();
+
+        // Process cancelled timerData.
+        if (!data->unStatus.status.isScheduled)
+        {
+            if (--data->refCount == 0)
+                delete data;
+
+            continue;
+        }
+
+        // Handle timeout, and reschedule if need.
+        if (HandleTimeout(data, now))
+            _heap.push(data);
+    } while (!_heap.empty());
+}
+
+void LLBC_TimerScheduler::UpdateWheel(sint64 now)
+{
+    // No any timer, fast forward.
+    if (_wheelTimerCount == 0)
+    {
+        _wheelTick = MAX(_wheelTick, now + 1);
+        return;
+    }
+
+    while (_wheelTick <= now)
+    {
+        // Cascade higher level slots when level 0 wheel round.
+        const uint64 tick = static_cast<uint64>(_wheelTick);
+        const size_t l0Idx = static_cast<size_t>(tick & LLBC_INL_NS __wheelL0Mask);
+        if (l0Idx == 0)
+        {
+            for (int level = 1; level < LLBC_INL_NS __wheelLevels; ++level)
+            {
+                const int shift = LLBC_INL_NS __wheelL0Bits + (level - 1) * LLBC_INL_NS __wheelLnBits;
+                const size_t lnIdx = static_cast<size_t>((tick >> shift) & LLBC_INL_NS __wheelLnMask);
+                CascadeWheel(LLBC_INL_NS __wheelL0Size + (level - 1) * LLBC_INL_NS __wheelLnSize + lnIdx);
+                if (lnIdx != 0)
+                    break;
+            }
+        }
+
+        // Detach expired slot, then forward tick(rescheduled timers will add to next ticks).
+        LLBC_TimerData *expired = _wheelSlots[l0Idx];
+        ++_wheelTick;
+        if (!expired)
+            continue;
+
+        _wheelSlots[l0Idx] = nullptr;
+        expired->wheelPPrev = &expired;
+
+        while (expired)
+        {
+            LLBC_TimerData *data = expired;
+            RemoveFromWheel(data);
+            --_wheelTimerCount;
+
+            // Not reach timeout time(timeout time exceed the wheel range), add to wheel again.
+            if (UNLIKELY(data->handle >= _wheelTick))
+            {
+                AddToWheel(data);
+                continue;
+            }
+
+            // Handle timeout, and reschedule if need.
+            if (HandleTimeout(data, now))
+                AddToWheel(data);
+        }
+
+        if (_wheelTimerCount == 0)
+        {
+            _wheelTick = MAX(_wheelTick, now + 1);
+            break;
+        }
+    }
+}
+
+bool LLBC_TimerScheduler::HandleTimeout(LLBC_TimerData *data, sint64 now)
+{
+    // Incr refCount && Mark is timeout-handling.
+    ++data->refCount;
+    data->unStatus.status.isHandlingTimeout = true;
+    // Incr has been timeout times.
+    ++data->triggeredCount;
+
+    // Call OnTimeout.
+    bool reSchedule = true;
+    LLBC_Timer *timer = data->timer;
+    timer->OnTimeout();
+
+    // If Cancel() or Schedule() called during OnTimeout() call, set reSchedule flag to false.
+    if (!data->unStatus.status.isScheduled)
+        reSchedule = false;
+
+    // Reach max schedule times, reset <isScheduled> flag && reset reSchedule flag.
+    if (data->totalTriggerCount != static_cast<size_t>(LLBC_INFINITE) &&
+        data->triggeredCount >= data->totalTriggerCount)
+    {
+        data->unStatus.status.isScheduled = false;
+        reSchedule = false;
+    }
+
+    // Reset isHandlingTimeout flag && Decr refCount.
+    data->unStatus.status.isHandlingTimeout = false;
+    --data->refCount;
+
+    // Reschedule or try delete timerData.
+    if (reSchedule)
+    {
+        sint64 delay = (data->period != 0) ? (now - data->handle) % data->period : 0;
+        data->handle = now + data->period - delay;
+
+        return true;
+    }
+
+    if (data->refCount == 0 || --data->refCount == 0)
+        delete data;
+
+    return false;
+}
+
+void LLBC_TimerScheduler::AddToWheel(LLBC_TimerData *data)
+{
+    // Expired timer, add to next tick slot.
+    sint64 expires = MAX(data->handle, _wheelTick);
+    uint64 delta = static_cast<uint64>(expires - _wheelTick);
+
+    // Find wheel slot.
+    size_t slotIdx;
+    if (delta < LLBC_INL_NS __wheelL0Size)
+    {
+        slotIdx = static_cast<size_t>(static_cast<uint64>(expires) & LLBC_INL_NS __wheelL0Mask);
+    }
+    else
+    {
+        // Exceed the wheel range, clamp to the wheel end.
+        if (delta > LLBC_INL_NS __wheelMaxDelta)
+        {
+            delta = LLBC_INL_NS __wheelMaxDelta;
+            expires = _wheelTick + static_cast<sint64>(delta);
+        }
+
+        int level = 1;
+        int shift = LLBC_INL_NS __wheelL0Bits;
+        while (level < LLBC_INL_NS __wheelLevels - 1 &&
+               delta >= (1llu << (shift + LLBC_INL_NS __wheelLnBits)))
+        {
+            ++level;
+            shift += LLBC_INL_NS __wheelLnBits;
+        }
+
+        slotIdx = LLBC_INL_NS __wheelL0Size +
+            (level - 1) * LLBC_INL_NS __wheelLnSize +
+                static_cast<size_t>((static_cast<uint64>(expires) >> shift) & LLBC_INL_NS __wheelLnMask);
+    }
+
+    // Link to slot list head.
+    LLBC_TimerData *&slot = _wheelSlots[slotIdx];
+    data->wheelNext = slot;
+    if (slot)
+        slot->wheelPPrev = &data->wheelNext;
+    slot = data;
+    data->wheelPPrev = &slot;
+
+    ++_wheelTimerCount;
+}
+
+void LLBC_TimerScheduler::RemoveFromWheel(LLBC_TimerData *data)
+{
+    *data->wheelPPrev = data->wheelNext;
+    if (data->wheelNext)
+        data->wheelNext->wheelPPrev = data->wheelPPrev;
+
+    data->wheelNext = nullptr;
+    data->wheelPPrev = nullptr;
+}
+
+void LLBC_TimerScheduler::CascadeWheel(size_t slotIdx)
+{
+    LLBC_TimerData *data = _wheelSlots[slotIdx];
+    _wheelSlots[slotIdx] = nullptr;
+    while (data)
+    {
+        LLBC_TimerData *next = data->wheelNext;
+
+        --_wheelTimerCount;
+        AddToWheel(data);
+
+        data = next;
+    }
+}
+
+void LLBC_TimerScheduler::GetTimerDatas(std::vector<LLBC_TimerData *> &datas) const
+{
+    if (_backend == LLBC_TimerSchedulerBackend::Heap)
+    {
+        datas.assign(_heap.begin(), _heap.end());
+        return;
+    }
+
+    datas.reserve(_wheelTimerCount);
+    for (auto slot : _wheelSlots)
+    {
+        for (; slot; slot = slot->wheelNext)
+            datas.push_back(slot);
+    }
+}
+
 __LLBC_NS_END
@@ -24,8 +24,10 @@
 
 #include <float.h>
 
+#include "llbc/core/os/OS_Atomic.h"
 #include "llbc/core/utils/Util_Text.h"
 #include "llbc/core/variant/Variant.h"
+#include "llbc/core/variant/VariantView.h"
 
 __LLBC_INTERNAL_NS_BEGIN
 
@@ -75,6 +77,37 @@ const LLBC_String &LLBC_VariantType::Type2Str(int type)
     return (it != LLBC_INL_NS __g_typeDescs.end()) ? it->second : LLBC_INL_NS __g_typeDescs[NIL];
 }
 
+size_t LLBC_Variant::DictKeyHash::operator()(const LLBC_Variant &key) const noexcept
+{
+    const Holder &holder = key.GetHolder();
+    if (key.IsFloat() || key.IsDouble())
+    {
+        // Integral double key hash as integer key, make 1.0 and 1 hash to same bucket.
+        const double doubleVal = holder.data.raw.doubleVal;
+        if (doubleVal >= static_cast<double>(std::numeric_limits<sint64>::min()) &&
+            doubleVal < static_cast<double>(std::numeric_limits<sint64>::max()) &&
+            static_cast<double>(static_cast<sint64>(doubleVal)) == doubleVal)
+            return static_cast<size_t>(static_cast<sint64>(doubleVal));
+
+        return std::hash<double>()(doubleVal);
+    }
+    else if (key.IsRaw())
+    {
+        return static_cast<size_t>(holder.data.raw.uint64Val);
+    }
+    else if (key.IsNil())
+    {
+        return 0;
+    }
+
+    return std::hash<LLBC_Variant>()(key);
+}
+
+bool LLBC_Variant::DictKeyEqual::operator()(const LLBC_Variant &left, const LLBC_Variant &right) const
+{
+    return left.GetFirstType() == right.GetFirstType() && left == right;
+}
+
 __LLBC_NS_END
 
 std::ostream &operator<<(std::ostream &o, const LLBC_NS LLBC_Variant &variant)
@@ -89,12 +122,8 @@ __LLBC_NS_BEGIN
 LLBC_Variant::Holder::Holder(const Holder &other)
 : type(other.type)
 {
-    if (type == LLBC_VariantType::STR_DFT)
-        new (&data.obj.str) Str(other.data.obj.str);
-    else if (type == LLBC_VariantType::SEQ_DFT)
-        new (&data.obj.seq) Seq(other.data.obj.seq);
-    else if (type == LLBC_VariantType::DICT_DFT)
-        new (&data.obj.dict) Dict(other.data.obj.dict);
+    if (GetFirstType() & (LLBC_VariantType::STR | LLBC_VariantType::SEQ | LLBC_VariantType::DICT))
+        ShareObj(other);
     else
         data.raw.uint64Val = other.data.raw.uint64Val;
 }
@@ -102,14 +131,10 @@ LLBC_Variant::Holder::Holder(const Holder &other)
 LLBC_Variant::Holder::Holder(Holder &&other) noexcept
 : type(other.type)
 {
-    if (type == LLBC_VariantType::STR_DFT)
-        new (&data.obj.str) Str(std::move(other.data.obj.str));
-    else if (type == LLBC_VariantType::SEQ_DFT)
-        new (&data.obj.seq) Seq(std::move(other.data.obj.seq));
-    else if (type == LLBC_VariantType::DICT_DFT)
-        new (&data.obj.dict) Dict(std::move(other.data.obj.dict));
-    else
-        data.raw.uint64Val = other.data.raw.uint64Val;
+    data.raw.uint64Val = other.data.raw.uint64Val;
+
+    other.type = LLBC_VariantType::NIL;
+    other.data.raw.uint64Val = 0;
 }
 
 LLBC_Variant::Holder &LLBC_Variant::Holder::operator=(const Holder &other)
@@ -117,31 +142,23 @@ LLBC_Variant::Holder &LLBC_Variant::Holder::operator=(const Holder &other)
     if (UNLIKELY(this == &other))
         return *this;
 
-    if (type == other.type)
-    {
-        if (type == LLBC_VariantType::STR_DFT)
-            data.obj.str = other.data.obj.str;
-        else if (type == LLBC_VariantType::SEQ_DFT)
-            data.obj.seq = other.data.obj.seq;
-        else if (type == LLBC_VariantType::DICT_DFT)
-            data.obj.dict = other.data.obj.dict;
-        else
-            data.raw.uint64Val = other.data.raw.uint64Val;
-    }
-    else
+    if (type == other.type &&
+        (GetFirstType() & (LLBC_VariantType::STR | LLBC_VariantType::SEQ | LLBC_VariantType::DICT)) == 0)
     {
-        Reset();
-        type = other.type;
-        if (type == LLBC_VariantType::STR_DFT)
-            new (&data.obj.str) Str(other.data.obj.str);
-        else if (type == LLBC_VariantType::SEQ_DFT)
-            new (&data.obj.seq) Seq(other.data.obj.seq);
-        else if (type == LLBC_VariantType::DICT_DFT)
-            new (&data.obj.dict) Dict(other.data.obj.dict);
-        else
-            data.raw.uint64Val = other.data.raw.uint64Val;
+        data.raw.uint64Val = other.data.raw.uint64Val;
+        return *this;
     }
 
+    // Note: Share other payload before reset, other payload maybe owned by this holder's payload.
+    Holder otherCopy(other);
+    Reset();
+
+    type = otherCopy.type;
+    data.raw.uint64Val = otherCopy.data.raw.uint64Val;
+
+    otherCopy.type = LLBC_VariantType::NIL;
+    otherCopy.data.raw.uint64Val = 0;
+
     return *this;
 }
 
@@ -150,30 +167,15 @@ LLBC_Variant::Holder &LLBC_Variant::Holder::operator=(Holder &&other) noexcept
     if (UNLIKELY(this == &other))
         return *this;
 
-    if (type == other.type)
-    {
-        if (type == LLBC_VariantType::STR_DFT)
-            data.obj.str = std::move(other.data.obj.str);
-        else if (type == LLBC_VariantType::SEQ_DFT)
-            data.obj.seq = std::move(other.data.obj.seq);
-        else if (type == LLBC_VariantType::DICT_DFT)
-            data.obj.dict = std::move(other.data.obj.dict);
-        else
-            data.raw.uint64Val = other.data.raw.uint64Val;
-    }
-    else
-    {
-        Reset();
-        type = other.type;
-        if (type == LLBC_VariantType::STR_DFT)
-            new (&data.obj.str) Str(std::move(other.data.obj.str));
-        else if (type == LLBC_VariantType::SEQ_DFT)
-            new (&data.obj.seq) Seq(std::move(other.data.obj.seq));
-        else if (type == LLBC_VariantType::DICT_DFT)
-            new (&data.obj.dict) Dict(std::move(other.data.obj.dict));
-        else
-            data.raw.uint64Val = other.data.raw.uint64Val;
-    }
+    // Note: Take other payload before reset, other payload maybe owned by this holder's payload.
+    const LLBC_VariantType::ENUM otherType = other.type;
+    const uint64 otherData = other.data.raw.uint64Val;
+    other.type = LLBC_VariantType::NIL;
+    other.data.raw.uint64Val = 0;
+
+    Reset();
+    type = otherType;
+    data.raw.uint64Val = otherData;
 
     return *this;
 }
@@ -186,16 +188,72 @@ LLBC_VariantType::ENUM LLBC_Variant::Holder::GetFirstType() const
 void LLBC_Variant::Holder::Reset()
 {
     if (type == LLBC_VariantType::STR_DFT)
-        data.obj.str.~Str();
+    {
+        if (LLBC_AtomicFetchAndSub(&data.obj.str->refCount, 1) == 1)
+            delete data.obj.str;
+    }
     else if (type == LLBC_VariantType::SEQ_DFT)
-        data.obj.seq.~Seq();
+    {
+        if (LLBC_AtomicFetchAndSub(&data.obj.seq->refCount, 1) == 1)
+            delete data.obj.seq;
+    }
     else if (type == LLBC_VariantType::DICT_DFT)
-        data.obj.dict.~Dict();
+    {
+        if (LLBC_AtomicFetchAndSub(&data.obj.dict->refCount, 1) == 1)
+            delete data.obj.dict;
+    }
 
     data.raw.int64Val = 0;
     type = LLBC_VariantType::NIL;
 }
 
+void LLBC_Variant::Holder::ShareObj(const Holder &other)
+{
+    #if LLBC_CFG_CORE_VARIANT_COPY_ON_WRITE
+    data.raw.uint64Val = other.data.raw.uint64Val;
+    if (type == LLBC_VariantType::STR_DFT)
+        LLBC_AtomicFetchAndAdd(&data.obj.str->refCount, 1);
+    else if (type == LLBC_VariantType::SEQ_DFT)
+        LLBC_AtomicFetchAndAdd(&data.obj.seq->refCount, 1);
+    else // DICT_DFT
+        LLBC_AtomicFetchAndAdd(&data.obj.dict->refCount, 1);
+    #else // !LLBC_CFG_CORE_VARIANT_COPY_ON_WRITE
+    if (type == LLBC_VariantType::STR_DFT)
+        InitStr(other.GetStr());
+    else if (type == LLBC_VariantType::SEQ_DFT)
+        InitSeq(other.GetSeq());
+    else // DICT_DFT
+        InitDict(other.GetDict());
+    #endif // LLBC_CFG_CORE_VARIANT_COPY_ON_WRITE
+}
+
+void LLBC_Variant::Holder::DetachObj()
+{
+    // Copy payload, and release the shared payload.
+    // Note: Payload maybe released by other holder after copy, so use sub-and-check to release it.
+    if (type == LLBC_VariantType::STR_DFT)
+    {
+        SharedObj<Str> *sharedStr = data.obj.str;
+        data.obj.str = new SharedObj<Str>(sharedStr->obj);
+        if (LLBC_AtomicFetchAndSub(&sharedStr->refCount, 1) == 1)
+            delete sharedStr;
+    }
+    else if (type == LLBC_VariantType::SEQ_DFT)
+    {
+        SharedObj<Seq> *sharedSeq = data.obj.seq;
+        data.obj.seq = new SharedObj<Seq>(sharedSeq->obj);
+        if (LLBC_AtomicFetchAndSub(&sharedSeq->refCount, 1) == 1)
+            delete sharedSeq;
+    }
+    else // DICT_DFT
+    {
+        SharedObj<Dict> *sharedDict = data.obj.dict;
+        data.obj.dict = new SharedObj<Dict>(sharedDict->obj);
+        if (LLBC_AtomicFetchAndSub(&sharedDict->refCount, 1) == 1)
+            delete sharedDict;
+    }
+}
+
 LLBC_Variant::Str **LLBC_Variant::_num2StrFastAccessTbl = nullptr;
 
 void LLBC_Variant::InitNumber2StrFastAccessTable()
@@ -235,19 +293,17 @@ void LLBC_Variant::DestroyNumber2StrFastAccessTable()
 LLBC_Variant::LLBC_Variant(const char *str)
 {
     BecomeStr();
-    _holder.data.obj.str = str;
+    _holder.GetStr() = str;
 }
 
 LLBC_Variant::LLBC_Variant(const LLBC_Variant &var)
+: _holder(var._holder)
 {
-    LLBC_VariantTraits::assign(*this, var);
 }
 
 LLBC_Variant::LLBC_Variant(LLBC_Variant &&var) noexcept
-: _holder(var._holder)
+: _holder(std::move(var._holder))
 {
-    var._holder.type = LLBC_VariantType::NIL;
-    var._holder.data.raw.uint64Val = 0;
 }
 
 bool LLBC_Variant::AsBool() const
@@ -262,15 +318,15 @@ bool LLBC_Variant::AsBool() const
     }
     if (firstType == LLBC_VariantType::STR)
     {
-        return !_holder.data.obj.str.empty();
+        return !_holder.GetStr().empty();
     }
     if (firstType == LLBC_VariantType::SEQ)
     {
-        return !_holder.data.obj.seq.empty();
+        return !_holder.GetSeq().empty();
     }
     if (firstType == LLBC_VariantType::DICT)
     {
-        return !_holder.data.obj.dict.empty();
+        return !_holder.GetDict().empty();
     }
 
     return false;
@@ -280,7 +336,7 @@ bool LLBC_Variant::AsLooseBool() const
 {
     if (GetFirstType() == LLBC_VariantType::STR)
     {
-        const Str &str = _holder.data.obj.str;
+        const Str &str = _holder.GetStr();
         if (str.empty())
             return false;
 
@@ -300,7 +356,7 @@ double LLBC_Variant::AsDouble() const
 
     if (firstType == LLBC_VariantType::STR)
     {
-        const auto &str = _holder.data.obj.str;
+        const auto &str = _holder.GetStr();
         if (str.empty())
             return 0.0;
 
@@ -360,23 +416,23 @@ LLBC_String LLBC_Variant::AsStr() const
 
     if (IsStr())
     {
-        return _holder.data.obj.str;
+        return _holder.GetStr();
     }
 
     if (IsSeq())
     {
-        if (_holder.data.obj.seq.empty())
+        if (_holder.GetSeq().empty())
             return LLBC_INL_NS __g_emptySeqStr;
 
         LLBC_String content;
         content.reserve(64);
         content.append(1, '[');
-        for (SeqConstIter it = _holder.data.obj.seq.begin();
-             it != _holder.data.obj.seq.end();
+        for (SeqConstIter it = _holder.GetSeq().begin();
+             it != _holder.GetSeq().end();
              )
         {
             content.append(it->AsStr());
-            if (++it != _holder.data.obj.seq.end())
+            if (++it != _holder.GetSeq().end())
                 content.append(1, ',');
         }
 
@@ -386,22 +442,22 @@ LLBC_String LLBC_Variant::AsStr() const
 
     if (IsDict())
     {
-        if (_holder.data.obj.dict.empty())
+        if (_holder.GetDict().empty())
             return LLBC_INL_NS __g_emptyDictStr;
 
         LLBC_String content;
         content.reserve(64);
         content.append(1, '{');
 
-        for (DictConstIter it = _holder.data.obj.dict.begin();
-             it != _holder.data.obj.dict.end();
+        for (DictConstIter it = _holder.GetDict().begin();
+             it != _holder.GetDict().end();
              )
         {
             content.append(it->first.AsStr());
             content.append(1, ':');
             content.append(it->second.AsStr());
 
-            if (++it != _holder.data.obj.dict.end())
+            if (++it != _holder.GetDict().end())
                 content.append(1, ',');
         }
 
@@ -414,22 +470,22 @@ LLBC_String LLBC_Variant::AsStr() const
 
 const LLBC_Variant::Seq &LLBC_Variant::AsSeq() const
 {
-    return IsSeq() ? _holder.data.obj.seq : LLBC_INL_NS __g_emptySeq;
+    return IsSeq() ? _holder.GetSeq() : LLBC_INL_NS __g_emptySeq;
 }
 
 const LLBC_Variant::Dict &LLBC_Variant::AsDict() const
 {
-    return IsDict() ? _holder.data.obj.dict : LLBC_INL_NS __g_emptyDict;
+    return IsDict() ? _holder.GetDict() : LLBC_INL_NS __g_emptyDict;
 }
 
 bool LLBC_Variant::IsEmpty() const
 {
     if (_holder.type == LLBC_VariantType::STR_DFT)
-        return _holder.data.obj.str.empty();
+        return _holder.GetStr().empty();
     if (_holder.type == LLBC_VariantType::SEQ_DFT)
-        return _holder.data.obj.seq.empty();
+        return _holder.GetSeq().empty();
     if (_holder.type == LLBC_VariantType::DICT_DFT)
-        return _holder.data.obj.dict.empty();
+        return _holder.GetDict().empty();
 
     return true;
 }
@@ -437,11 +493,11 @@ bool LLBC_Variant::IsEmpty() const
 size_t LLBC_Variant::Size() const
 {
     if (_holder.type == LLBC_VariantType::STR_DFT)
-        return _holder.data.obj.str.size();
+        return _holder.GetStr().size();
     if (_holder.type == LLBC_VariantType::SEQ_DFT)
-        return _holder.data.obj.seq.size();
+        return _holder.GetSeq().size();
     if (_holder.type == LLBC_VariantType::DICT_DFT)
-        return _holder.data.obj.dict.size();
+        return _holder.GetDict().size();
 
     return 0;
 }
@@ -449,11 +505,11 @@ size_t LLBC_Variant::Size() const
 size_t LLBC_Variant::Capacity() const
 {
     if (_holder.type == LLBC_VariantType::STR_DFT)
-        return _holder.data.obj.str.capacity();
+        return _holder.GetStr().capacity();
     if (_holder.type == LLBC_VariantType::SEQ_DFT)
-        return _holder.data.obj.seq.capacity();
+        return _holder.GetSeq().capacity();
     if (_holder.type == LLBC_VariantType::DICT_DFT)
-        return _holder.data.obj.dict.size();
+        return _holder.GetDict().size();
 
     return 0;
 }
@@ -461,13 +517,13 @@ size_t LLBC_Variant::Capacity() const
 LLBC_Variant::SeqIter LLBC_Variant::SeqBegin()
 {
     BecomeSeq();
-    return _holder.data.obj.seq.begin();
+    return _holder.GetSeq().begin();
 }
 
 LLBC_Variant::SeqIter LLBC_Variant::SeqEnd()
 {
     BecomeSeq();
-    return _holder.data.obj.seq.end();
+    return _holder.GetSeq().end();
 }
 
 LLBC_Variant::SeqConstIter LLBC_Variant::SeqBegin() const
@@ -483,13 +539,13 @@ LLBC_Variant::SeqConstIter LLBC_Variant::SeqEnd() const
 LLBC_Variant::SeqReverseIter LLBC_Variant::SeqReverseBegin()
 {
     BecomeSeq();
-    return _holder.data.obj.seq.rbegin();
+    return _holder.GetSeq().rbegin();
 }
 
 LLBC_Variant::SeqReverseIter LLBC_Variant::SeqReverseEnd()
 {
     BecomeSeq();
-    return _holder.data.obj.seq.rend();
+    return _holder.GetSeq().rend();
 }
 
 LLBC_Variant::SeqConstReverseIter LLBC_Variant::SeqReverseBegin() const
@@ -505,13 +561,13 @@ LLBC_Variant::SeqConstReverseIter LLBC_Variant::SeqReverseEnd() const
 LLBC_Variant::Seq::reference LLBC_Variant::SeqFront()
 {
     BecomeSeq();
-    return _holder.data.obj.seq.front();
+    return _holder.GetSeq().front();
 }
 
 LLBC_Variant::Seq::reference LLBC_Variant::SeqBack()
 {
     BecomeSeq();
-    return _holder.data.obj.seq.back();
+    return _holder.GetSeq().back();
 }
 
 LLBC_Variant::Seq::const_reference LLBC_Variant::SeqFront() const
@@ -527,73 +583,73 @@ LLBC_Variant::Seq::const_reference LLBC_Variant::SeqBack() const
 LLBC_Variant::SeqIter LLBC_Variant::SeqInsert(SeqIter it, const Seq::value_type &val)
 {
     BecomeSeq();
-    return _holder.data.obj.seq.insert(it, val);
+    return _holder.GetSeq().insert(it, val);
 }
 
 void LLBC_Variant::SeqInsert(SeqIter it, Seq::size_type n, const Seq::value_type &val)
 {
     BecomeSeq();
-    _holder.data.obj.seq.insert(it, n, val);
+    _holder.GetSeq().insert(it, n, val);
 }
 
 void LLBC_Variant::SeqInsert(SeqIter it, SeqConstIter first, SeqConstIter last)
 {
     BecomeSeq();
-    _holder.data.obj.seq.insert(it, first, last);
+    _holder.GetSeq().insert(it, first, last);
 }
 
 void LLBC_Variant::SeqPopBack()
 {
     BecomeSeq();
-    if (!_holder.data.obj.seq.empty())
-        _holder.data.obj.seq.pop_back();
+    if (!_holder.GetSeq().empty())
+        _holder.GetSeq().pop_back();
 }
 
 void LLBC_Variant::SeqResize(Seq::size_type n, const Seq::value_type &val)
 {
     BecomeSeq();
-    _holder.data.obj.seq.resize(n, val);
+    _holder.GetSeq().resize(n, val);
 }
 
 void LLBC_Variant::SeqReserve(Seq::size_type n)
 {
     BecomeSeq();
-    _holder.data.obj.seq.reserve(n);
+    _holder.GetSeq().reserve(n);
 }
 
 LLBC_Variant::SeqIter LLBC_Variant::SeqErase(SeqIter it)
 {
     BecomeSeq();
-    return _holder.data.obj.seq.erase(it);
+    return _holder.GetSeq().erase(it);
 }
 
 LLBC_Variant::SeqIter LLBC_Variant::SeqErase(SeqIter first, SeqIter last)
 {
     BecomeSeq();
-    return _holder.data.obj.seq.erase(first, last);
+    return _holder.GetSeq().erase(first, last);
 }
 
 void LLBC_Variant::SeqErase(const Seq::value_type &val)
 {
     BecomeSeq();
-    if (_holder.data.obj.seq.empty())
+    if (_holder.GetSeq().empty())
         return;
 
     SeqIter it;
-    while ((it = std::find(_holder.data.obj.seq.begin(), _holder.data.obj.seq.end(), val)) != _holder.data.obj.seq.end())
-        _holder.data.obj.seq.erase(it);
+    while ((it = std::find(_holder.GetSeq().begin(), _holder.GetSeq().end(), val)) != _holder.GetSeq().end())
+        _holder.GetSeq().erase(it);
 }
 
 LLBC_Variant::DictIter LLBC_Variant::DictBegin()
 {
     BecomeDict();
-    return _holder.data.obj.dict.begin();
+    return _holder.GetDict().begin();
 }
 
 LLBC_Variant::DictIter LLBC_Variant::DictEnd()
 {
     BecomeDict();
-    return _holder.data.obj.dict.end();
+    return _holder.GetDict().end();
 }
 
 LLBC_Variant::DictConstIter LLBC_Variant::DictBegin() const
@@ -609,13 +665,13 @@ LLBC_Variant::DictConstIter LLBC_Variant::DictEnd() const
 LLBC_Variant::DictReverseIter LLBC_Variant::DictReverseBegin()
 {
     BecomeDict();
-    return _holder.data.obj.dict.rbegin();
+    return _holder.GetDict().rbegin();
 }
 
 LLBC_Variant::DictReverseIter LLBC_Variant::DictReverseEnd()
 {
     BecomeDict();
-    return _holder.data.obj.dict.rend();
+    return _holder.GetDict().rend();
 }
 
 LLBC_Variant::DictConstReverseIter LLBC_Variant::DictReverseBegin() const
@@ -631,19 +687,19 @@ LLBC_Variant::DictConstReverseIter LLBC_Variant::DictReverseEnd() const
 std::pair<LLBC_Variant::DictIter, bool> LLBC_Variant::DictInsert(const Dict::key_type &key, const Dict::mapped_type &val)
 {
     BecomeDict();
-    return _holder.data.obj.dict.emplace(key, val);
+    return _holder.GetDict().emplace(key, val);
 }
 
 std::pair<LLBC_Variant::DictIter, bool> LLBC_Variant::DictInsert(const Dict::value_type &val)
 {
     BecomeDict();
-    return _holder.data.obj.dict.insert(val);
+    return _holder.GetDict().insert(val);
 }
 
 LLBC_Variant::DictIter LLBC_Variant::DictFind(const Dict::key_type &key)
 {
     BecomeDict();
-    return _holder.data.obj.dict.find(key);
+    return _holder.GetDict().find(key);
 }
 
 LLBC_Variant::DictConstIter LLBC_Variant::DictFind(const Dict::key_type &key) const
@@ -654,13 +710,13 @@ LLBC_Variant::DictConstIter LLBC_Variant::DictFind(const Dict::key_type &key) co
 LLBC_Variant::DictIter LLBC_Variant::DictErase(DictIter it)
 {
     BecomeDict();
-    return _holder.data.obj.dict.erase(it);
+    return _holder.GetDict().erase(it);
 }
 
 LLBC_Variant::DictIter LLBC_Variant::DictErase(DictIter first, DictIter last)
 {
     BecomeDict();
-    return _holder.data.obj.dict.erase(first, last);
+    return _holder.GetDict().erase(first, last);
 }
 
 LLBC_Variant &LLBC_Variant::operator[](const LLBC_Variant &key)
@@ -668,14 +724,14 @@ LLBC_Variant &LLBC_Variant::operator[](const LLBC_Variant &key)
     if (_holder.type == LLBC_VariantType::SEQ_DFT)
     {
         const size_t idx = key;
-        if (UNLIKELY(idx >= _holder.data.obj.seq.size()))
-            _holder.data.obj.seq.resize(idx + 1);
+        if (UNLIKELY(idx >= _holder.GetSeq().size()))
+            _holder.GetSeq().resize(idx + 1);
 
-        return _holder.data.obj.seq[idx];
+        return _holder.GetSeq()[idx];
     }
 
     BecomeDict();
-    return _holder.data.obj.dict[key];
+    return _holder.GetDict()[key];
 }
 
 const LLBC_Variant &LLBC_Variant::operator[](const LLBC_Variant &key) const
@@ -683,16 +739,16 @@ const LLBC_Variant &LLBC_Variant::operator[](const LLBC_Variant &key) const
     if (_holder.type == LLBC_VariantType::SEQ_DFT)
     {
         const size_t intKey = key;
-        if (intKey >= _holder.data.obj.seq.size())
+        if (intKey >= _holder.GetSeq().size())
             return LLBC_INL_NS __g_nilVariant;
 
-        return _holder.data.obj.seq[intKey];
+        return _holder.GetSeq()[intKey];
     }
 
     if (_holder.type == LLBC_VariantType::DICT_DFT)
     {
-        const DictConstIter it = _holder.data.obj.dict.find(key);
-        return it != _holder.data.obj.dict.end() ? it->second : LLBC_INL_NS __g_nilVariant;
+        const DictConstIter it = _holder.GetDict().find(key);
+        return it != _holder.GetDict().end() ? it->second : LLBC_INL_NS __g_nilVariant;
     }
 
     return LLBC_INL_NS __g_nilVariant;
@@ -794,9 +850,9 @@ LLBC_Variant &LLBC_Variant::operator=(const char * const &str)
 
     const auto len = strlen(str);
     if(len == 0)
-        _holder.data.obj.str.clear();
+        _holder.GetStr().clear();
     else
-        _holder.data.obj.str.assign(str, len);
+        _holder.GetStr().assign(str, len);
 
     return *this;
 }
@@ -847,11 +903,11 @@ LLBC_Variant &LLBC_Variant::operator=(const std::string &str)
 
     if (str.empty())
     {
-        _holder.data.obj.str.clear();
+        _holder.GetStr().clear();
     }
     else
     {
-        _holder.data.obj.str = str;
+        _holder.GetStr() = str;
     }
 
     return *this;
@@ -862,11 +918,11 @@ LLBC_Variant &LLBC_Variant::operator=(const LLBC_String &str)
     BecomeStr();
     if (str.empty())
     {
-        _holder.data.obj.str.clear();
+        _holder.GetStr().clear();
     }
     else
     {
-        _holder.data.obj.str = str;
+        _holder.GetStr() = str;
     }
 
     return *this;
@@ -877,11 +933,11 @@ LLBC_Variant &LLBC_Variant::operator=(const LLBC_CString &str)
     BecomeStr();
     if (str.empty())
     {
-        _holder.data.obj.str.clear();
+        _holder.GetStr().clear();
     }
     else
     {
-        _holder.data.obj.str = str;
+        _holder.GetStr() = str;
     }
 
     return *this;
@@ -892,11 +948,11 @@ LLBC_Variant &LLBC_Variant::operator=(const Seq &seq)
     BecomeSeq();
     if (seq.empty())
     {
-        _holder.data.obj.seq.clear();
+        _holder.GetSeq().clear();
     }
     else
     {
-        _holder.data.obj.seq = seq;
+        _holder.GetSeq() = seq;
     }
 
     return *this;
@@ -907,11 +963,11 @@ LLBC_Variant &LLBC_Variant::operator=(const Dict &dict)
     BecomeDict();
     if (dict.empty())
     {
-        _holder.data.obj.dict.clear();
+        _holder.GetDict().clear();
     }
     else
     {
-        _holder.data.obj.dict = dict;
+        _holder.GetDict() = dict;
     }
 
     return *this;
@@ -922,11 +978,7 @@ LLBC_Variant &LLBC_Variant::operator=(LLBC_Variant &&var) noexcept
     if (this == &var)
         return *this;
 
-    _holder.Reset();
-    _holder = var._holder;
-
-    var._holder.type = LLBC_VariantType::NIL;
-    var._holder.data.raw.uint64Val = 0;
+    _holder = std::move(var._holder);
 
     return *this;
 }
@@ -941,22 +993,22 @@ void LLBC_Variant::Serialize(LLBC_Stream &stream) const
     }
     else if (IsStr())
     {
-        stream.Write(_holder.data.obj.str);
+        stream.Write(_holder.GetStr());
     }
     else if (IsSeq())
     {
-        stream.Write(static_cast<uint32>(_holder.data.obj.seq.size()));
+        stream.Write(static_cast<uint32>(_holder.GetSeq().size()));
 
-        const Seq::const_iterator seqEnd = _holder.data.obj.seq.end();
-        for (SeqConstIter it = _holder.data.obj.seq.begin(); it != seqEnd; ++it)
+        const Seq::const_iterator seqEnd = _holder.GetSeq().end();
+        for (SeqConstIter it = _holder.GetSeq().begin(); it != seqEnd; ++it)
             stream.Write(*it);
     }
     else if (IsDict())
     {
-        stream.Write(static_cast<uint32>(_holder.data.obj.dict.size()));
+        stream.Write(static_cast<uint32>(_holder.GetDict().size()));
 
-        const Dict::const_iterator dictEnd = _holder.data.obj.dict.end();
-        for (DictConstIter it = _holder.data.obj.dict.begin(); it != dictEnd; ++it)
+        const Dict::const_iterator dictEnd = _holder.GetDict().end();
+        for (DictConstIter it = _holder.GetDict().begin(); it != dictEnd; ++it)
         {
             stream.Write(it->first);
             stream.Write(it->second);
@@ -988,9 +1040,9 @@ bool LLBC_Variant::Deserialize(LLBC_Stream &stream)
     }
     else if (IsStr())
     {
-        _holder.data.obj.str.clear();
+        _holder.GetStr().clear();
 
-        if (!stream.Read(_holder.data.obj.str))
+        if (!stream.Read(_holder.GetStr()))
         {
             BecomeNil();
             return false;
@@ -1007,7 +1059,7 @@ bool LLBC_Variant::Deserialize(LLBC_Stream &stream)
             return false;
         }
 
-        _holder.data.obj.seq.clear();
+        _holder.GetSeq().clear();
 
         if (count == 0)
             return true;
@@ -1021,7 +1073,7 @@ bool LLBC_Variant::Deserialize(LLBC_Stream &stream)
                 return false;
             }
 
-            _holder.data.obj.seq.push_back(val);
+            _holder.GetSeq().push_back(val);
         }
 
         return true;
@@ -1035,7 +1087,7 @@ bool LLBC_Variant::Deserialize(LLBC_Stream &stream)
             return false;
         }
 
-        _holder.data.obj.dict.clear();
+        _holder.GetDict().clear();
 
         if (count == 0)
             return true;
@@ -1050,7 +1102,7 @@ bool LLBC_Variant::Deserialize(LLBC_Stream &stream)
                 return false;
             }
 
-            _holder.data.obj.dict.insert(std::make_pair(key, val));
+            _holder.GetDict().insert(std::make_pair(key, val));
         }
 
         return true;
@@ -1059,16 +1111,36 @@ bool LLBC_Variant::Deserialize(LLBC_Stream &stream)
     return false;
 }
 
+void LLBC_Variant::SerializeCompact(LLBC_Stream &stream) const
+{
+    LLBC_VariantView::Encode(*this, stream);
+}
+
+bool LLBC_Variant::DeserializeCompact(LLBC_Stream &stream)
+{
+    const LLBC_VariantView view(stream.GetBufStartWithReadPos(), stream.GetReadableSize());
+    const size_t encodedSize = view.GetEncodedSize();
+    if (encodedSize == 0 || !view.ToVariant(*this))
+    {
+        BecomeNil();
+        return false;
+    }
+
+    stream.SkipRead(static_cast<sint64>(encodedSize));
+
+    return true;
+}
+
 void LLBC_Variant::SeqPushBackElem(const Seq::value_type &val)
 {
     BecomeSeq();
-    _holder.data.obj.seq.push_back(val);
+    _holder.GetSeq().push_back(val);
 }
 
 LLBC_Variant::Dict::size_type LLBC_Variant::DictEraseKey(const Dict::key_type &key)
 {
     BecomeDict();
-    return _holder.data.obj.dict.erase(key);
+    return _holder.GetDict().erase(key);
 }
 
 __LLBC_NS_END
@@ -33,7 +33,8 @@
 #define __LLBC_INL_OBJ_TYPE_VARS_EQ_COMP(ty, varName)                    \
     if (!right.Is##ty())                                                 \
         return false;                                                    \
-    return lHolder.data.obj.varName == rHolder.data.obj.varName          \
+    return lHolder.data.obj.varName == rHolder.data.obj.varName ||       \
+           lHolder.Get##ty() == rHolder.Get##ty()                        \
 
 __LLBC_NS_BEGIN
 
@@ -42,33 +43,8 @@ void LLBC_VariantTraits::assign(LLBC_Variant &left, const LLBC_Variant &right)
     if (&left == &right)
         return;
 
-    // Become type.
-    left.Become(right.GetType());
-
-    // Execute assignment.
-    if (right.IsNil())// Do NIL type data assignment.
-    {
-        return;
-    }
-    else if (right.IsRaw()) // Do RAW type data assignment.
-    {
-        left.GetMutableHolder()->data.raw.uint64Val = right.GetHolder().data.raw.uint64Val;
-    }
-    else if (right.IsStr()) // Do STR type data assignment.
-    {
-        left.BecomeStr();
-        left.GetMutableHolder()->data.obj.str = right.GetHolder().data.obj.str;
-    }
-    else if (right.IsSeq()) // Do SEQ type data assignment.
-    {
-        left.BecomeSeq();
-        left.GetMutableHolder()->data.obj.seq = right.GetHolder().data.obj.seq;
-    }
-    else if (right.IsDict()) // Do DICT type data assignment.
-    {
-        left.BecomeDict();
-        left.GetMutableHolder()->data.obj.dict = right.GetHolder().data.obj.dict;
-    }
+    // Do assignment(str/seq/dict payload will be shared if enabled copy-on-write).
+    *left.GetMutableHolder() = right.GetHolder();
 }
 
 bool LLBC_VariantTraits::eq(const LLBC_Variant &left, const LLBC_Variant &right)
@@ -137,7 +113,7 @@ bool LLBC_VariantTraits::lt(const LLBC_Variant &left, const LLBC_Variant &right)
     if (left.IsDict())
     {
         if (right.IsDict()) // Dict: exec compare
-            return lHolder.data.obj.dict < rHolder.data.obj.dict;
+            return lHolder.GetDict() < rHolder.GetDict();
         else // Seq/Str/Raw/Nil: false
             return false;
     }
@@ -146,7 +122,7 @@ bool LLBC_VariantTraits::lt(const LLBC_Variant &left, const LLBC_Variant &right)
         if (right.IsDict()) // Seq<Dict: true
             return true;
         if (right.IsSeq()) // Seq: exec compare
-            return lHolder.data.obj.seq < rHolder.data.obj.seq;
+            return lHolder.GetSeq() < rHolder.GetSeq();
         else // Str/Raw/Nil: false
             return false;
     }
@@ -159,7 +135,7 @@ bool LLBC_VariantTraits::lt(const LLBC_Variant &left, const LLBC_Variant &right)
         }
         else if (right.IsStr()) // Str: exec compare
         {
-            return lHolder.data.obj.str < rHolder.data.obj.str;
+            return lHolder.GetStr() < rHolder.GetStr();
         }
         else if (right.IsRaw()) // Raw: exec compare(convert to raw)
         {
@@ -285,8 +261,8 @@ void LLBC_VariantTraits::add_equal(LLBC_Variant &left, const LLBC_Variant &right
     {
         if (right.IsDict())
         {
-            LLBC_Variant::Dict &lDict = left.GetMutableHolder()->data.obj.dict;
-            const LLBC_Variant::Dict &rDict = right.GetHolder().data.obj.dict;
+            LLBC_Variant::Dict &lDict = left.GetMutableHolder()->GetDict();
+            const LLBC_Variant::Dict &rDict = right.GetHolder().GetDict();
             if (rDict.empty())
                 return;
 
@@ -302,10 +278,10 @@ void LLBC_VariantTraits::add_equal(LLBC_Variant &left, const LLBC_Variant &right
     // > Left[Seq] + Right[Non Seq/Dict] = Left Append Right
     if (left.IsSeq())
     {
-        LLBC_Variant::Seq &lSeq = left.GetMutableHolder()->data.obj.seq;
+        LLBC_Variant::Seq &lSeq = left.GetMutableHolder()->GetSeq();
         if (right.IsDict())
         {
-            const LLBC_Variant::Dict &rDict = right.GetHolder().data.obj.dict;
+            const LLBC_Variant::Dict &rDict = right.GetHolder().GetDict();
             if (rDict.empty())
                 return;
 
@@ -318,7 +294,7 @@ void LLBC_VariantTraits::add_equal(LLBC_Variant &left, const LLBC_Variant &right
         }
         else if (right.IsSeq())
         {
-            const LLBC_Variant::Seq &rSeq = right.GetHolder().data.obj.seq;
+            const LLBC_Variant::Seq &rSeq = right.GetHolder().GetSeq();
             if (rSeq.empty())
                 return;
 
@@ -338,14 +314,14 @@ void LLBC_VariantTraits::add_equal(LLBC_Variant &left, const LLBC_Variant &right
     // Left[Str] + Right[Raw/Nil] = Left + Right.AsStr()
     if (left.IsStr())
     {
-        LLBC_Variant::Str &lStr = left.GetMutableHolder()->data.obj.str;
+        LLBC_Variant::Str &lStr = left.GetMutableHolder()->GetStr();
         if (right.IsDict() || right.IsSeq())
         {
             return;
         }
         else if (right.IsStr())
         {
-            const LLBC_Variant::Str &rStr = right.GetHolder().data.obj.str;
+            const LLBC_Variant::Str &rStr = right.GetHolder().GetStr();
             if (rStr.empty())
                 return;
 
@@ -402,13 +378,13 @@ void LLBC_VariantTraits::sub_equal(LLBC_Variant &left, const LLBC_Variant &right
     // > Left[Dict] - Right[Non Dict/Seq] = Dict[Left -Right(as key)]
     if (left.IsDict())
     {
-        LLBC_Variant::Dict &lDict = left.GetMutableHolder()->data.obj.dict;
+        LLBC_Variant::Dict &lDict = left.GetMutableHolder()->GetDict();
         if (lDict.empty())
             return;
 
         if (right.IsDict())
         {
-            const LLBC_Variant::Dict &rDict = right.GetHolder().data.obj.dict;
+            const LLBC_Variant::Dict &rDict = right.GetHolder().GetDict();
             if (rDict.empty())
                 return;
 
@@ -418,7 +394,7 @@ void LLBC_VariantTraits::sub_equal(LLBC_Variant &left, const LLBC_Variant &right
         }
         else if (right.IsSeq())
         {
-            const LLBC_Variant::Seq &rSeq = right.GetHolder().data.obj.seq;
+            const LLBC_Variant::Seq &rSeq = right.GetHolder().GetSeq();
             if (rSeq.empty())
                 return;
 
@@ -444,13 +420,13 @@ void LLBC_VariantTraits::sub_equal(LLBC_Variant &left, const LLBC_Variant &right
     // > Left[Seq] - Right[Non Seq/Dict] = Left - Right(as left element)
     if (left.IsSeq())
     {
-        LLBC_Variant::Seq &lSeq = left.GetMutableHolder()->data.obj.seq;
+        LLBC_Variant::Seq &lSeq = left.GetMutableHolder()->GetSeq();
         if (lSeq.empty())
             return;
 
         if (right.IsDict())
         {
-            const LLBC_Variant::Dict &rDict = right.GetHolder().data.obj.dict;
+            const LLBC_Variant::Dict &rDict = right.GetHolder().GetDict();
             if (rDict.empty())
                 return;
 
@@ -467,7 +443,7 @@ void LLBC_VariantTraits::sub_equal(LLBC_Variant &left, const LLBC_Variant &right
         else if (right.IsSeq())
         {
 
-            const LLBC_Variant::Seq &rSeq = right.GetHolder().data.obj.seq;
+            const LLBC_Variant::Seq &rSeq = right.GetHolder().GetSeq();
             if (rSeq.empty())
                 return;
 
@@ -495,13 +471,13 @@ void LLBC_VariantTraits::sub_equal(LLBC_Variant &left, const LLBC_Variant &right
     // Left[Str] - Right[Raw] = Left - Right.AsStr()
     if (left.IsStr())
     {
-        LLBC_Variant::Str &lStr = left.GetMutableHolder()->data.obj.str;
+        LLBC_Variant::Str &lStr = left.GetMutableHolder()->GetStr();
         if (lStr.empty())
             return;
 
         if (right.IsStr())
         {
-            const LLBC_Variant::Str &rStr = right.GetHolder().data.obj.str;
+            const LLBC_Variant::Str &rStr = right.GetHolder().GetStr();
             if (rStr.empty())
                 return;
 
@@ -571,7 +547,7 @@ void LLBC_VariantTraits::mul_equal(LLBC_Variant &left, const LLBC_Variant &right
     // > Left[Dict] * Right[Str/Raw] = Left[Dict]
     else if (left.IsDict())
     {
-        LLBC_Variant::Dict &lDict = left.GetMutableHolder()->data.obj.dict;
+        LLBC_Variant::Dict &lDict = left.GetMutableHolder()->GetDict();
         if (lDict.empty())
             return;
 
@@ -602,7 +578,7 @@ void LLBC_VariantTraits::mul_equal(LLBC_Variant &left, const LLBC_Variant &right
     // > Left[Seq] * Right[Raw] = Left[Seq] repeat right.AsInt32() times
     else if (left.IsSeq())
     {
-        LLBC_Variant::Seq &lSeq = left.GetMutableHolder()->data.obj.seq;
+        LLBC_Variant::Seq &lSeq = left.GetMutableHolder()->GetSeq();
         if (lSeq.empty())
             return;
 
@@ -658,7 +634,7 @@ void LLBC_VariantTraits::mul_equal(LLBC_Variant &left, const LLBC_Variant &right
         }
         else if (right.IsRaw())
         {
-            LLBC_Variant::Str &lStr = left.GetMutableHolder()->data.obj.str;
+            LLBC_Variant::Str &lStr = left.GetMutableHolder()->GetStr();
             if (lStr.empty())
                 return;
 
@@ -0,0 +1,804 @@
+// The MIT License (MIT)
+
+// Copyright (c) 2013 lailongwei<lailongwei@126.com>
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy of 
+// this software and associated documentation files (the "Software"), to deal in 
+// the Software without restriction, including without limitation the rights to 
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of 
+// the Software, and to permit persons to whom the Software is furnished to do so, 
+// subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all 
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS 
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER 
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN 
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+
+#include "llbc/common/Export.h"
+
+#include "llbc/core/variant/VariantView.h"
+
+__LLBC_INTERNAL_NS_BEGIN
+
+// The compact encoding magic & version.
+constexpr LLBC_NS uint8 __g_compactMagic = 0xb7;
+constexpr LLBC_NS uint8 __g_compactVersion = 0x01;
+
+// The compact encoding value tags.
+enum : LLBC_NS uint8
+{
+    __TAG_NIL = 0x00,
+    __TAG_FALSE = 0x01,
+    __TAG_TRUE = 0x02,
+
+    __TAG_SINT8 = 0x03,
+    __TAG_UINT8 = 0x04,
+    __TAG_SINT16 = 0x05,
+    __TAG_UINT16 = 0x06,
+    __TAG_SINT32 = 0x07,
+    __TAG_UINT32 = 0x08,
+    __TAG_LONG = 0x09,
+    __TAG_ULONG = 0x0a,
+    __TAG_PTR = 0x0b,
+    __TAG_SINT64 = 0x0c,
+    __TAG_UINT64 = 0x0d,
+    __TAG_FLOAT = 0x0e,
+    __TAG_DOUBLE = 0x0f,
+
+    __TAG_STR = 0x10,
+    __TAG_KEY_REF = 0x11,
+    __TAG_SEQ = 0x12,
+    __TAG_DICT = 0x13,
+
+    __TAG_SHORT_STR_BEGIN = 0x20,
+    __TAG_SHORT_STR_END = 0x3f,
+
+    __TAG_INVALID = 0xff
+};
+
+// Tag <-> Variant type mapping.
+LLBC_NS LLBC_VariantType::ENUM __TagToType(LLBC_NS uint8 tag)
+{
+    using LLBC_NS LLBC_VariantType;
+    static const LLBC_VariantType::ENUM rawTypes[] = {
+        LLBC_VariantType::NIL,
+        LLBC_VariantType::RAW_BOOL,
+        LLBC_VariantType::RAW_BOOL,
+        LLBC_VariantType::RAW_SINT8,
+        LLBC_VariantType::RAW_UINT8,
+        LLBC_VariantType::RAW_SINT16,
+        LLBC_VariantType::RAW_UINT16,
+        LLBC_VariantType::RAW_SINT32,
+        LLBC_VariantType::RAW_UINT32,
+        LLBC_VariantType::RAW_LONG,
+        LLBC_VariantType::RAW_ULONG,
+        LLBC_VariantType::RAW_PTR,
+        LLBC_VariantType::RAW_SINT64,
+        LLBC_VariantType::RAW_UINT64,
+        LLBC_VariantType::RAW_FLOAT,
+        LLBC_VariantType::RAW_DOUBLE,
+    };
+
+    if (tag <= __TAG_DOUBLE)
+        return rawTypes[tag];
+    else if (tag == __TAG_STR ||
+             tag == __TAG_KEY_REF ||
+             (tag >= __TAG_SHORT_STR_BEGIN && tag <= __TAG_SHORT_STR_END))
+        return LLBC_VariantType::STR_DFT;
+    else if (tag == __TAG_SEQ)
+        return LLBC_VariantType::SEQ_DFT;
+    else if (tag == __TAG_DICT)
+        return LLBC_VariantType::DICT_DFT;
+
+    return LLBC_VariantType::NIL;
+}
+
+LLBC_NS uint8 __RawTypeToTag(LLBC_NS LLBC_VariantType::ENUM type)
+{
+    using LLBC_NS LLBC_VariantType;
+    switch (type)
+    {
+        case LLBC_VariantType::RAW_SINT8: return __TAG_SINT8;
+        case LLBC_VariantType::RAW_UINT8: return __TAG_UINT8;
+        case LLBC_VariantType::RAW_SINT16: return __TAG_SINT16;
+        case LLBC_VariantType::RAW_UINT16: return __TAG_UINT16;
+        case LLBC_VariantType::RAW_SINT32: return __TAG_SINT32;
+        case LLBC_VariantType::RAW_UINT32: return __TAG_UINT32;
+        case LLBC_VariantType::RAW_LONG: return __TAG_LONG;
+        case LLBC_VariantType::RAW_ULONG: return __TAG_ULONG;
+        case LLBC_VariantType::RAW_PTR: return __TAG_PTR;
+        case LLBC_VariantType::RAW_SINT64: return __TAG_SINT64;
+        case LLBC_VariantType::RAW_UINT64: return __TAG_UINT64;
+        default: return __TAG_INVALID;
+    }
+}
+
+// Varint/Fixed-width integer write helpers.
+void __WriteVarint(LLBC_NS LLBC_Stream &stream, LLBC_NS uint64 val)
+{
+    LLBC_NS uint8 buf[10];
+    size_t len = 0;
+    while (val >= 0x80)
+    {
+        buf[len++] = static_cast<LLBC_NS uint8>(val | 0x80);
+        val >>= 7;
+    }
+    buf[len++] = static_cast<LLBC_NS uint8>(val);
+
+    stream.Write(buf, len);
+}
+
+template <typename _Ty>
+void __WriteFixed(LLBC_NS LLBC_Stream &stream, _Ty val)
+{
+    LLBC_NS uint8 buf[sizeof(_Ty)];
+    for (size_t i = 0; i < sizeof(_Ty); ++i)
+        buf[i] = static_cast<LLBC_NS uint8>(val >> (i * 8));
+
+    stream.Write(buf, sizeof(_Ty));
+}
+
+// Varint/Fixed-width integer read helpers(bounds checked).
+bool __ReadVarint(const LLBC_NS uint8 *buf, size_t size, size_t &off, LLBC_NS uint64 &val)
+{
+    val = 0;
+    for (int shift = 0; shift < 64 && off < size; shift += 7)
+    {
+        const LLBC_NS uint8 b = buf[off++];
+        val |= static_cast<LLBC_NS uint64>(b & 0x7f) << shift;
+        if (!(b & 0x80))
+            return true;
+    }
+
+    return false;
+}
+
+template <typename _Ty>
+bool __ReadFixed(const LLBC_NS uint8 *buf, size_t size, size_t &off, _Ty &val)
+{
+    if (off > size || size - off < sizeof(_Ty))
+        return false;
+
+    val = 0;
+    for (size_t i = 0; i < sizeof(_Ty); ++i)
+        val |= static_cast<_Ty>(static_cast<_Ty>(buf[off + i]) << (i * 8));
+    off += sizeof(_Ty);
+
+    return true;
+}
+
+// ZigZag encode/decode.
+LLBC_NS uint64 __ZigZagEncode(LLBC_NS sint64 val)
+{
+    return (static_cast<LLBC_NS uint64>(val) << 1) ^ static_cast<LLBC_NS uint64>(val >> 63);
+}
+
+LLBC_NS sint64 __ZigZagDecode(LLBC_NS uint64 val)
+{
+    return static_cast<LLBC_NS sint64>(val >> 1) ^ -static_cast<LLBC_NS sint64>(val & 1);
+}
+
+/**
+ * \brief The variant compact encoder.
+ */
+class __LLBC_VariantCompactEncoder
+{
+public:
+    explicit __LLBC_VariantCompactEncoder(LLBC_NS LLBC_Stream &stream) : _stream(stream) {  }
+
+public:
+    void Encode(const LLBC_NS LLBC_Variant &var)
+    {
+        // Collect dict str keys, only intern the keys which appears more than once.
+        CollectKeys(var);
+
+        std::vector<std::string_view> internedKeys;
+        for (auto &key : _keyOrder)
+        {
+            auto it = _keyIndexes.find(key);
+            if (it->second >= 2)
+            {
+                it->second = static_cast<LLBC_NS uint32>(internedKeys.size());
+                internedKeys.push_back(key);
+            }
+            else
+            {
+                _keyIndexes.erase(it);
+            }
+        }
+
+        // Write header.
+        const LLBC_NS uint8 header[2] = {__g_compactMagic, __g_compactVersion};
+        _stream.Write(header, sizeof(header));
+        __WriteVarint(_stream, internedKeys.size());
+
+        LLBC_NS uint32 keyOffset = 0;
+        for (auto &key : internedKeys)
+        {
+            __WriteFixed(_stream, keyOffset);
+
+            LLBC_NS uint32 lenSize = 1;
+            for (size_t len = key.size(); len >= 0x80; len >>= 7)
+                ++lenSize;
+            keyOffset += lenSize + static_cast<LLBC_NS uint32>(key.size());
+        }
+
+        for (auto &key : internedKeys)
+        {
+            __WriteVarint(_stream, key.size());
+            _stream.Write(key.data(), key.size());
+        }
+
+        // Write value.
+        WriteValue(var, false);
+    }
+
+private:
+    void CollectKeys(const LLBC_NS LLBC_Variant &var)
+    {
+        if (var.IsSeq())
+        {
+            for (auto &elem : var.AsSeq())
+                CollectKeys(elem);
+        }
+        else if (var.IsDict())
+        {
+            for (auto &[key, val] : var.AsDict())
+            {
+                if (key.IsStr())
+                {
+                    const LLBC_NS LLBC_String &keyStr = key.AsStr();
+                    auto insertRet = _keyIndexes.emplace(std::string_view(keyStr.data(), keyStr.size()), 0);
+                    if (insertRet.second)
+                        _keyOrder.push_back(insertRet.first->first);
+                    ++insertRet.first->second;
+                }
+                else
+                {
+                    CollectKeys(key);
+                }
+
+                CollectKeys(val);
+            }
+        }
+    }
+
+    void WriteValue(const LLBC_NS LLBC_Variant &var, bool isDictKey)
+    {
+        const LLBC_NS LLBC_Variant::Holder &holder = var.GetHolder();
+        if (var.IsNil())
+        {
+            WriteTag(__TAG_NIL);
+        }
+        else if (var.IsBool())
+        {
+            WriteTag(holder.data.raw.int64Val != 0 ? __TAG_TRUE : __TAG_FALSE);
+        }
+        else if (var.IsFloat())
+        {
+            WriteTag(__TAG_FLOAT);
+
+            const float floatVal = static_cast<float>(holder.data.raw.doubleVal);
+            LLBC_NS uint32 bits;
+            memcpy(&bits, &floatVal, sizeof(bits));
+            __WriteFixed(_stream, bits);
+        }
+        else if (var.IsDouble())
+        {
+            WriteTag(__TAG_DOUBLE);
+            __WriteFixed(_stream, holder.data.raw.uint64Val);
+        }
+        else if (var.IsRaw())
+        {
+            WriteTag(__RawTypeToTag(holder.type));
+            __WriteVarint(_stream,
+                          var.IsSignedRaw() ?
+                              __ZigZagEncode(holder.data.raw.int64Val) : holder.data.raw.uint64Val);
+        }
+        else if (var.IsStr())
+        {
+            const LLBC_NS LLBC_String &str = holder.GetStr();
+            if (isDictKey)
+            {
+                auto it = _keyIndexes.find(std::string_view(str.data(), str.size()));
+                if (it != _keyIndexes.end())
+                {
+                    WriteTag(__TAG_KEY_REF);
+                    __WriteVarint(_stream, it->second);
+                    return;
+                }
+            }
+
+            if (str.size() <= static_cast<size_t>(__TAG_SHORT_STR_END - __TAG_SHORT_STR_BEGIN))
+            {
+                WriteTag(static_cast<LLBC_NS uint8>(__TAG_SHORT_STR_BEGIN + str.size()));
+            }
+            else
+            {
+                WriteTag(__TAG_STR);
+                __WriteVarint(_stream, str.size());
+            }
+
+            _stream.Write(str.data(), str.size());
+        }
+        else if (var.IsSeq())
+        {
+            const LLBC_NS LLBC_Variant::Seq &seq = holder.GetSeq();
+            const size_t bodyBegin = BeginContainer(__TAG_SEQ, seq.size());
+            for (auto &elem : seq)
+                WriteValue(elem, false);
+            EndContainer(bodyBegin);
+        }
+        else // Dict.
+        {
+            const LLBC_NS LLBC_Variant::Dict &dict = holder.GetDict();
+            const size_t bodyBegin = BeginContainer(__TAG_DICT, dict.size());
+            for (auto &[key, val] : dict)
+            {
+                WriteValue(key, true);
+                WriteValue(val, false);
+            }
+            EndContainer(bodyBegin);
+        }
+    }
+
+    void WriteTag(LLBC_NS uint8 tag)
+    {
+        _stream.Write(&tag, sizeof(tag));
+    }
+
+    size_t BeginContainer(LLBC_NS uint8 tag, size_t count)
+    {
+        WriteTag(tag);
+        __WriteVarint(_stream, count);
+        __WriteFixed(_stream, static_cast<LLBC_NS uint32>(0)); // Body size placeholder.
+
+        return _stream.GetWritePos();
+    }
+
+    void EndContainer(size_t bodyBegin)
+    {
+        const LLBC_NS uint32 bodySize = static_cast<LLBC_NS uint32>(_stream.GetWritePos() - bodyBegin);
+        LLBC_NS uint8 *bodySizeBuf = _stream.GetBuf<LLBC_NS uint8>() + bodyBegin - sizeof(bodySize);
+        for (size_t i = 0; i < sizeof(bodySize); ++i)
+            bodySizeBuf[i] = static_cast<LLBC_NS uint8>(bodySize >> (i * 8));
+    }
+
+private:
+    LLBC_NS LLBC_Stream &_stream;
+
+    std::vector<std::string_view> _keyOrder;
+    std::unordered_map<std::string_view, LLBC_NS uint32> _keyIndexes;
+};
+
+__LLBC_INTERNAL_NS_END
+
+__LLBC_NS_BEGIN
+
+LLBC_VariantView::LLBC_VariantView()
+: _buf(nullptr)
+, _size(0)
+, _keyCount(0)
+, _keyOffsetsOff(0)
+, _keysOff(0)
+, _valOff(0)
+, _root(false)
+{
+}
+
+LLBC_VariantView::LLBC_VariantView(const void *buf, size_t size)
+: _buf(reinterpret_cast<const uint8 *>(buf))
+, _size(size)
+, _keyCount(0)
+, _keyOffsetsOff(0)
+, _keysOff(0)
+, _valOff(0)
+, _root(true)
+{
+    if (!_buf || !ParseHeader())
+        *this = LLBC_VariantView();
+}
+
+LLBC_VariantView::LLBC_VariantView(const LLBC_VariantView &root, size_t valOff)
+: _buf(root._buf)
+, _size(root._size)
+, _keyCount(root._keyCount)
+, _keyOffsetsOff(root._keyOffsetsOff)
+, _keysOff(root._keysOff)
+, _valOff(valOff)
+, _root(false)
+{
+}
+
+void LLBC_VariantView::Encode(const LLBC_Variant &var, LLBC_Stream &stream)
+{
+    LLBC_INL_NS __LLBC_VariantCompactEncoder(stream).Encode(var);
+}
+
+size_t LLBC_VariantView::GetEncodedSize() const
+{
+    if (!IsValid())
+        return 0;
+
+    const size_t valEnd = SkipValue(_valOff);
+    if (valEnd == 0)
+        return 0;
+
+    return _root ? valEnd : valEnd - _valOff;
+}
+
+LLBC_VariantType::ENUM LLBC_VariantView::GetType() const
+{
+    return LLBC_INL_NS __TagToType(GetTag());
+}
+
+size_t LLBC_VariantView::Size() const
+{
+    if (IsStr())
+    {
+        LLBC_CString str;
+        return GetStrValue(_valOff, str) ? str.size() : 0;
+    }
+    else if (IsSeq() || IsDict())
+    {
+        size_t count, bodyBegin, bodyEnd;
+        return ParseContainer(count, bodyBegin, bodyEnd) ? count : 0;
+    }
+
+    return 0;
+}
+
+bool LLBC_VariantView::AsBool() const
+{
+    LLBC_Variant var;
+    return ToScalarVariant(var) ? var.AsBool() : false;
+}
+
+sint32 LLBC_VariantView::AsInt32() const
+{
+    LLBC_Variant var;
+    return ToScalarVariant(var) ? var.AsInt32() : 0;
+}
+
+uint32 LLBC_VariantView::AsUInt32() const
+{
+    LLBC_Variant var;
+    return ToScalarVariant(var) ? var.AsUInt32() : 0;
+}
+
+sint64 LLBC_VariantView::AsInt64() const
+{
+    LLBC_Variant var;
+    return ToScalarVariant(var) ? var.AsInt64() : 0;
+}
+
+uint64 LLBC_VariantView::AsUInt64() const
+{
+    LLBC_Variant var;
+    return ToScalarVariant(var) ? var.AsUInt64() : 0;
+}
+
+double LLBC_VariantView::AsDouble() const
+{
+    LLBC_Variant var;
+    return ToScalarVariant(var) ? var.AsDouble() : 0.0;
+}
+
+LLBC_CString LLBC_VariantView::AsStr() const
+{
+    LLBC_CString str;
+    if (!IsStr() || !GetStrValue(_valOff, str))
+        return LLBC_CString();
+
+    return str;
+}
+
+LLBC_VariantView LLBC_VariantView::SeqAt(size_t idx) const
+{
+    LLBC_VariantView elemView;
+    size_t curIdx = 0;
+    SeqForeach([&](const LLBC_VariantView &elem) {
+        if (curIdx++ == idx)
+            elemView = elem;
+    });
+
+    return elemView;
+}
+
+LLBC_VariantView LLBC_VariantView::DictFind(const LLBC_CString &key) const
+{
+    LLBC_VariantView valView;
+    DictForeach([&](const LLBC_VariantView &keyView, const LLBC_VariantView &val) {
+        if (!valView.IsValid() && keyView.IsStr())
+        {
+            const LLBC_CString keyStr = keyView.AsStr();
+            if (keyStr.size() == key.size() && memcmp(keyStr.data(), key.data(), key.size()) == 0)
+                valView = val;
+        }
+    });
+
+    return valView;
+}
+
+LLBC_VariantView LLBC_VariantView::DictFind(sint64 key) const
+{
+    LLBC_VariantView valView;
+    DictForeach([&](const LLBC_VariantView &keyView, const LLBC_VariantView &val) {
+        if (!valView.IsValid() && keyView.IsRaw() && keyView.AsInt64() == key)
+            valView = val;
+    });
+
+    return valView;
+}
+
+bool LLBC_VariantView::ToVariant(LLBC_Variant &var) const
+{
+    if (IsSeq())
+    {
+        var.BecomeNil();
+        LLBC_Variant::Seq &seq = var.BecomeSeq().GetMutableHolder()->GetSeq();
+        seq.reserve(Size());
+
+        bool succeed = true;
+        if (!SeqForeach([&](const LLBC_VariantView &elem) {
+                seq.emplace_back();
+                succeed = succeed && elem.ToVariant(seq.back());
+            }) || !succeed)
+        {
+            var.BecomeNil();
+            return false;
+        }
+
+        return true;
+    }
+    else if (IsDict())
+    {
+        var.BecomeNil();
+        LLBC_Variant::Dict &dict = var.BecomeDict().GetMutableHolder()->GetDict();
+
+        bool succeed = true;
+        if (!DictForeach([&](const LLBC_VariantView &keyView, const LLBC_VariantView &valView) {
+                LLBC_Variant key, val;
+                succeed = succeed && keyView.ToVariant(key) && valView.ToVariant(val);
+                dict.emplace(std::move(key), std::move(val));
+            }) || !succeed)
+        {
+            var.BecomeNil();
+            return false;
+        }
+
+        return true;
+    }
+
+    return ToScalarVariant(var);
+}
+
+bool LLBC_VariantView::ParseHeader()
+{
+    if (_size < 2 ||
+        _buf[0] != LLBC_INL_NS __g_compactMagic ||
+        _buf[1] != LLBC_INL_NS __g_compactVersion)
+        return false;
+
+    size_t off = 2;
+    uint64 keyCount;
+    if (!LLBC_INL_NS __ReadVarint(_buf, _size, off, keyCount) ||
+        keyCount > (_size - off) / sizeof(uint32))
+        return false;
+
+    _keyCount = static_cast<uint32>(keyCount);
+    _keyOffsetsOff = off;
+    _keysOff = off + _keyCount * sizeof(uint32);
+
+    // Skip keys.
+    size_t keysEnd = _keysOff;
+    for (uint32 i = 0; i < _keyCount; ++i)
+    {
+        uint64 keyLen;
+        if (!LLBC_INL_NS __ReadVarint(_buf, _size, keysEnd, keyLen) || keyLen > _size - keysEnd)
+            return false;
+        keysEnd += static_cast<size_t>(keyLen);
+    }
+
+    _valOff = keysEnd;
+
+    return _valOff < _size;
+}
+
+uint8 LLBC_VariantView::GetTag() const
+{
+    return IsValid() && _valOff < _size ? _buf[_valOff] : LLBC_INL_NS __TAG_INVALID;
+}
+
+bool LLBC_VariantView::ParseContainer(size_t &count, size_t &bodyBegin, size_t &bodyEnd) const
+{
+    const uint8 tag = GetTag();
+    if (tag != LLBC_INL_NS __TAG_SEQ && tag != LLBC_INL_NS __TAG_DICT)
+        return false;
+
+    size_t off = _valOff + 1;
+    uint64 elemCount;
+    uint32 bodySize;
+    if (!LLBC_INL_NS __ReadVarint(_buf, _size, off, elemCount) ||
+        !LLBC_INL_NS __ReadFixed(_buf, _size, off, bodySize) ||
+        bodySize > _size - off)
+        return false;
+
+    count = static_cast<size_t>(elemCount);
+    bodyBegin = off;
+    bodyEnd = off + bodySize;
+
+    return true;
+}
+
+size_t LLBC_VariantView::SkipValue(size_t off) const
+{
+    if (off >= _size)
+        return 0;
+
+    const uint8 tag = _buf[off++];
+    uint64 val;
+    switch (tag)
+    {
+        case LLBC_INL_NS __TAG_NIL:
+        case LLBC_INL_NS __TAG_FALSE:
+        case LLBC_INL_NS __TAG_TRUE:
+            return off;
+
+        case LLBC_INL_NS __TAG_FLOAT:
+            return _size - off >= sizeof(uint32) ? off + sizeof(uint32) : 0;
+
+        case LLBC_INL_NS __TAG_DOUBLE:
+            return _size - off >= sizeof(uint64) ? off + sizeof(uint64) : 0;
+
+        case LLBC_INL_NS __TAG_KEY_REF:
+            return LLBC_INL_NS __ReadVarint(_buf, _size, off, val) && val < _keyCount ? off : 0;
+
+        case LLBC_INL_NS __TAG_STR:
+            return LLBC_INL_NS __ReadVarint(_buf, _size, off, val) && val <= _size - off ?
+                off + static_cast<size_t>(val) : 0;
+
+        case LLBC_INL_NS __TAG_SEQ:
+        case LLBC_INL_NS __TAG_DICT:
+        {
+            uint32 bodySize;
+            return LLBC_INL_NS __ReadVarint(_buf, _size, off, val) &&
+                   LLBC_INL_NS __ReadFixed(_buf, _size, off, bodySize) &&
+                   bodySize <= _size - off ? off + bodySize : 0;
+        }
+
+        default:
+            break;
+    }
+
+    if (tag >= LLBC_INL_NS __TAG_SINT8 && tag <= LLBC_INL_NS __TAG_UINT64)
+        return LLBC_INL_NS __ReadVarint(_buf, _size, off, val) ? off : 0;
+
+    if (tag >= LLBC_INL_NS __TAG_SHORT_STR_BEGIN && tag <= LLBC_INL_NS __TAG_SHORT_STR_END)
+    {
+        const size_t strLen = tag - LLBC_INL_NS __TAG_SHORT_STR_BEGIN;
+        return strLen <= _size - off ? off + strLen : 0;
+    }
+
+    return 0;
+}
+
+bool LLBC_VariantView::GetStrValue(size_t off, LLBC_CString &str) const
+{
+    if (off >= _size)
+        return false;
+
+    const uint8 tag = _buf[off++];
+    uint64 strLen;
+    if (tag >= LLBC_INL_NS __TAG_SHORT_STR_BEGIN && tag <= LLBC_INL_NS __TAG_SHORT_STR_END)
+    {
+        strLen = tag - LLBC_INL_NS __TAG_SHORT_STR_BEGIN;
+    }
+    else if (tag == LLBC_INL_NS __TAG_STR)
+    {
+        if (!LLBC_INL_NS __ReadVarint(_buf, _size, off, strLen))
+            return false;
+    }
+    else if (tag == LLBC_INL_NS __TAG_KEY_REF)
+    {
+        uint64 keyIdx;
+        if (!LLBC_INL_NS __ReadVarint(_buf, _size, off, keyIdx) || keyIdx >= _keyCount)
+            return false;
+
+        size_t keyOffOff = _keyOffsetsOff + static_cast<size_t>(keyIdx) * sizeof(uint32);
+        uint32 keyOff;
+        if (!LLBC_INL_NS __ReadFixed(_buf, _size, keyOffOff, keyOff))
+            return false;
+
+        off = _keysOff + keyOff;
+        if (!LLBC_INL_NS __ReadVarint(_buf, _size, off, strLen))
+            return false;
+    }
+    else
+    {
+        return false;
+    }
+
+    if (strLen > _size - off)
+        return false;
+
+    str = LLBC_CString(reinterpret_cast<const char *>(_buf + off), static_cast<size_t>(strLen));
+
+    return true;
+}
+
+bool LLBC_VariantView::ToScalarVariant(LLBC_Variant &var) const
+{
+    var.BecomeNil();
+
+    const uint8 tag = GetTag();
+    if (tag == LLBC_INL_NS __TAG_INVALID ||
+        tag == LLBC_INL_NS __TAG_SEQ ||
+        tag == LLBC_INL_NS __TAG_DICT)
+        return false;
+
+    if (IsStr())
+    {
+        LLBC_CString str;
+        if (!GetStrValue(_valOff, str))
+            return false;
+
+        var = LLBC_String(str.data(), str.size());
+        return true;
+    }
+
+    // Raw/Nil.
+    size_t off = _valOff + 1;
+    LLBC_Variant::Holder &holder = *var.GetMutableHolder();
+    if (tag == LLBC_INL_NS __TAG_NIL)
+    {
+        return true;
+    }
+    else if (tag == LLBC_INL_NS __TAG_FALSE || tag == LLBC_INL_NS __TAG_TRUE)
+    {
+        holder.data.raw.int64Val = tag == LLBC_INL_NS __TAG_TRUE ? 1 : 0;
+    }
+    else if (tag == LLBC_INL_NS __TAG_FLOAT)
+    {
+        uint32 bits;
+        if (!LLBC_INL_NS __ReadFixed(_buf, _size, off, bits))
+            return false;
+
+        float floatVal;
+        memcpy(&floatVal, &bits, sizeof(floatVal));
+        holder.data.raw.doubleVal = floatVal;
+    }
+    else if (tag == LLBC_INL_NS __TAG_DOUBLE)
+    {
+        if (!LLBC_INL_NS __ReadFixed(_buf, _size, off, holder.data.raw.uint64Val))
+            return false;
+    }
+    else if (tag >= LLBC_INL_NS __TAG_SINT8 && tag <= LLBC_INL_NS __TAG_UINT64)
+    {
+        uint64 val;
+        if (!LLBC_INL_NS __ReadVarint(_buf, _size, off, val))
+            return false;
+
+        if (LLBC_INL_NS __TagToType(tag) & LLBC_VariantType::MASK_RAW_SIGNED)
+            holder.data.raw.int64Val = LLBC_INL_NS __ZigZagDecode(val);
+        else
+            holder.data.raw.uint64Val = val;
+    }
+    else
+    {
+        return false;
+    }
+
+    holder.type = LLBC_INL_NS __TagToType(tag);
+
+    return true;
+}
+
+__LLBC_NS_END